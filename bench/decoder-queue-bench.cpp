@@ -0,0 +1,87 @@
+// decoder-queue-bench.cpp - DecoderQueue acquire/release contention benchmark
+//
+// Measures acquire/release throughput of a model's DecoderQueue as the no. of
+// contending threads grows. Every thread runs a tight acquire -> release loop
+// for a fixed duration; the pool holds as many decoders as the largest thread
+// count so the numbers reflect pool overhead rather than waiting on decoders.
+//
+// Usage: decoder-queue-bench <model_spec_toml> [max_threads] [secs_per_run]
+
+// stl includes
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// lib includes
+#include <kaldiserve/decoder.hpp>
+#include <kaldiserve/utils.hpp>
+
+using namespace kaldiserve;
+
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <model_spec_toml> [max_threads] [secs_per_run]" << ENDL;
+        return 1;
+    }
+
+    const int max_threads = argc > 2 ? std::atoi(argv[2]) : int(std::thread::hardware_concurrency());
+    const double secs_per_run = argc > 3 ? std::atof(argv[3]) : 2.0;
+
+    std::vector<ModelSpec> model_specs;
+    parse_model_specs(argv[1], model_specs);
+    if (model_specs.empty()) {
+        std::cerr << ":: No model found in toml for loading" << ENDL;
+        return 1;
+    }
+
+    ModelSpec model_spec = model_specs[0];
+    model_spec.n_decoders = model_spec.min_decoders = model_spec.max_decoders = max_threads;
+    DecoderQueue queue(model_spec);
+
+    std::cout << std::setw(10) << "threads"
+              << std::setw(18) << "ops/sec"
+              << std::setw(18) << "ns/op/thread" << ENDL;
+
+    // powers of two followed by the max thread count
+    std::vector<int> thread_counts;
+    for (int n = 1; n < max_threads; n *= 2) thread_counts.push_back(n);
+    thread_counts.push_back(max_threads);
+
+    for (int n_threads : thread_counts) {
+        std::atomic<bool> running(true);
+        std::vector<uint64_t> ops(n_threads, 0);
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < n_threads; t++) {
+            threads.emplace_back([&queue, &running, &ops, t]() {
+                uint64_t n = 0;
+                while (running.load(std::memory_order_relaxed)) {
+                    Decoder *decoder = queue.acquire();
+                    queue.release(decoder);
+                    n++;
+                }
+                ops[t] = n;
+            });
+        }
+
+        std::this_thread::sleep_for(std::chrono::duration<double>(secs_per_run));
+        running = false;
+        for (auto &thread : threads) thread.join();
+
+        uint64_t total = 0;
+        for (auto n : ops) total += n;
+
+        const double ops_per_sec = total / secs_per_run;
+        std::cout << std::setw(10) << n_threads
+                  << std::setw(18) << std::fixed << std::setprecision(0) << ops_per_sec
+                  << std::setw(18) << std::setprecision(1) << (1e9 * n_threads / ops_per_sec) << ENDL;
+    }
+
+    return 0;
+}
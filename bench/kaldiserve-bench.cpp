@@ -0,0 +1,299 @@
+// kaldiserve-bench.cpp - Offline decoding throughput & RTF benchmark
+//
+// Loads a model from a model spec toml and decodes a list of wav files with a
+// number of threads through the model's DecoderQueue (the same path the
+// servers take), then reports throughput, real-time factor, latency
+// percentiles of each decoding stage and memory usage, optionally as JSON so
+// that runs over configs and releases can be compared.
+//
+// The decoder pool is sized to the no. of threads, so that decoder waits only
+// reflect the queue's overhead. With `--parallel-segments N`, every audio is
+// split at silences and decoded on up to N decoders at once (the pool gets N
+// decoders per thread), to measure the latency gained on long audio.
+//
+// Usage: kaldiserve-bench <model_spec_toml> <wav_list> [--model NAME] [--threads N]
+//                         [--repeat N] [--warmup N] [--chunk-size SECS] [--n-best N]
+//                         [--word-level] [--parallel-segments N] [--json FILE|-]
+
+// stl includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// lib includes
+#include <kaldiserve/decoder.hpp>
+#include <kaldiserve/utils.hpp>
+
+using namespace kaldiserve;
+
+
+// an audio file of the list held in memory
+struct Audio {
+    std::string path;
+    std::string bytes;
+    double secs;
+};
+
+// measurements of decoding one utterance
+struct Record {
+    double wait_secs;
+    double total_secs;
+    DecodingStats stats;
+};
+
+// a value from /proc/self/status in MB (e.g. "VmRSS", "VmHWM")
+double proc_status_mb(const std::string &key) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, key.size() + 1, key + ":") == 0) {
+            return std::atof(line.c_str() + key.size() + 1) / 1024.0;
+        }
+    }
+    return 0;
+}
+
+// nearest-rank percentile of the values (sorts them)
+double percentile(std::vector<double> &values, const double &p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    std::size_t rank = std::size_t(std::ceil(p / 100.0 * values.size()));
+    return values[std::min(values.size(), std::max<std::size_t>(rank, 1)) - 1];
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <model_spec_toml> <wav_list> [--model NAME] [--threads N]"
+                  << " [--repeat N] [--warmup N] [--chunk-size SECS] [--n-best N] [--word-level]"
+                  << " [--parallel-segments N] [--json FILE|-]" << ENDL;
+        return 1;
+    }
+
+    std::string model_name, json_path;
+    int n_threads = int(std::thread::hardware_concurrency());
+    int n_repeat = 1, n_warmup = 0, n_best = 1, parallel_segments = 1;
+    float chunk_size = 1;
+    bool word_level = false;
+
+    for (int i = 3; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--model" && has_value) model_name = argv[++i];
+        else if (arg == "--threads" && has_value) n_threads = std::atoi(argv[++i]);
+        else if (arg == "--repeat" && has_value) n_repeat = std::atoi(argv[++i]);
+        else if (arg == "--warmup" && has_value) n_warmup = std::atoi(argv[++i]);
+        else if (arg == "--chunk-size" && has_value) chunk_size = std::atof(argv[++i]);
+        else if (arg == "--n-best" && has_value) n_best = std::atoi(argv[++i]);
+        else if (arg == "--word-level") word_level = true;
+        else if (arg == "--parallel-segments" && has_value) parallel_segments = std::atoi(argv[++i]);
+        else if (arg == "--json" && has_value) json_path = argv[++i];
+        else {
+            std::cerr << ":: Unknown option " << arg << ENDL;
+            return 1;
+        }
+    }
+    n_threads = std::max(n_threads, 1);
+    parallel_segments = std::max(parallel_segments, 1);
+
+    std::vector<ModelSpec> model_specs;
+    parse_model_specs(argv[1], model_specs);
+
+    auto spec_it = std::find_if(model_specs.begin(), model_specs.end(), [&model_name](const ModelSpec &spec) {
+        return model_name.empty() || spec.name == model_name;
+    });
+    if (spec_it == model_specs.end()) {
+        std::cerr << ":: No model " << model_name << " found in toml for loading" << ENDL;
+        return 1;
+    }
+    ModelSpec model_spec = *spec_it;
+    model_spec.n_decoders = model_spec.min_decoders = model_spec.max_decoders = n_threads * parallel_segments;
+
+    // read all the audio up front, so that disk I/O stays out of the numbers
+    std::vector<Audio> audios;
+    std::ifstream wav_list(argv[2]);
+    std::string path;
+    while (std::getline(wav_list, path)) {
+        if (path.empty()) continue;
+
+        std::ifstream wav_file(path, std::ios::binary);
+        if (!wav_file) {
+            std::cerr << ":: Could not read " << path << ENDL;
+            return 1;
+        }
+        std::stringstream wav_bytes;
+        wav_bytes << wav_file.rdbuf();
+
+        kaldi::WaveData wave_data;
+        std::stringstream wav_stream(wav_bytes.str());
+        wave_data.Read(wav_stream);
+
+        audios.push_back(Audio{path, wav_bytes.str(), wave_data.Duration()});
+    }
+    if (audios.empty()) {
+        std::cerr << ":: No audio found in " << argv[2] << ENDL;
+        return 1;
+    }
+
+    const double rss_before_mb = proc_status_mb("VmRSS");
+    auto start_time = std::chrono::steady_clock::now();
+    DecoderQueue queue(model_spec);
+    const double load_secs = elapsed_secs(start_time);
+    const double rss_loaded_mb = proc_status_mb("VmRSS");
+    const double model_mb = queue.model_memory().total_bytes() / 1048576.0;
+
+    // decodes the utterances (of the audio list, round robin) until `n_utterances` are done
+    auto run = [&](const std::size_t &n_utterances, std::vector<std::vector<Record>> &records) {
+        std::atomic<std::size_t> next(0);
+        std::vector<std::thread> threads;
+        records.assign(n_threads, std::vector<Record>());
+
+        for (int t = 0; t < n_threads; t++) {
+            threads.emplace_back([&, t]() {
+                std::size_t i;
+                while ((i = next++) < n_utterances) {
+                    const Audio &audio = audios[i % audios.size()];
+
+                    auto request_time = std::chrono::steady_clock::now();
+                    Decoder *decoder = queue.acquire();
+                    ScopedThreadAffinity affinity(queue.affinity(decoder));
+
+                    Record record;
+                    record.wait_secs = elapsed_secs(request_time);
+
+                    std::stringstream wav_stream(audio.bytes);
+                    utterance_results_t results;
+                    decoder->start_decoding();
+                    if (parallel_segments > 1) {
+                        // helpers are only taken if idle right away (as the servers do), as
+                        // blocking for them while holding a decoder can deadlock the threads
+                        std::vector<Decoder *> helpers;
+                        for (int h = 1; h < parallel_segments; h++) {
+                            Decoder *helper = queue.try_acquire(RequestPriority::LOW);
+                            if (helper == nullptr) break;
+                            helpers.push_back(helper);
+                        }
+                        decoder->decode_segmented_wav_audio(wav_stream, helpers, n_best, results, word_level, chunk_size);
+                        for (Decoder *helper : helpers) {
+                            helper->free_decoder();
+                            queue.release(helper);
+                        }
+                    } else {
+                        decoder->decode_wav_audio(wav_stream, chunk_size);
+                        decoder->get_decoded_results(n_best, results, word_level);
+                    }
+
+                    record.total_secs = elapsed_secs(request_time);
+                    record.stats = decoder->stats();
+
+                    decoder->free_decoder();
+                    queue.release(decoder);
+                    records[t].push_back(record);
+                }
+            });
+        }
+        for (auto &thread : threads) thread.join();
+    };
+
+    std::vector<std::vector<Record>> records;
+    if (n_warmup > 0) run(std::size_t(n_warmup), records);
+
+    const std::size_t n_utterances = audios.size() * std::max(n_repeat, 1);
+    start_time = std::chrono::steady_clock::now();
+    run(n_utterances, records);
+    const double wall_secs = elapsed_secs(start_time);
+
+    // aggregate
+    double audio_secs = 0, compute_secs = 0, cpu_secs = 0;
+    std::vector<std::string> stages = {"wait", "decode", "finalize", "lattice", "rescore", "nbest", "total"};
+    std::vector<std::vector<double>> stage_secs(stages.size());
+    std::vector<double> rtfs;
+
+    for (auto const &thread_records : records) {
+        for (auto const &record : thread_records) {
+            audio_secs += record.stats.audio_secs;
+            compute_secs += record.stats.compute_secs();
+            cpu_secs += record.stats.cpu_secs;
+            if (record.stats.audio_secs > 0) rtfs.push_back(record.stats.compute_secs() / record.stats.audio_secs);
+
+            const double secs[] = {record.wait_secs, record.stats.decode_secs, record.stats.finalize_secs,
+                                   record.stats.lattice_secs, record.stats.rescore_secs, record.stats.nbest_secs,
+                                   record.total_secs};
+            for (std::size_t s = 0; s < stages.size(); s++) stage_secs[s].push_back(secs[s]);
+        }
+    }
+
+    const double rtf = audio_secs > 0 ? compute_secs / audio_secs : 0;
+    const double cpu_rtf = audio_secs > 0 ? cpu_secs / audio_secs : 0;
+    const double rtf_p50 = percentile(rtfs, 50), rtf_p95 = percentile(rtfs, 95), rtf_p99 = percentile(rtfs, 99);
+    std::vector<double> p50(stages.size()), p95(stages.size()), p99(stages.size());
+    for (std::size_t s = 0; s < stages.size(); s++) {
+        p50[s] = percentile(stage_secs[s], 50);
+        p95[s] = percentile(stage_secs[s], 95);
+        p99[s] = percentile(stage_secs[s], 99);
+    }
+    const double rss_peak_mb = proc_status_mb("VmHWM");
+
+    std::cout << ":: " << model_spec.name << " (" << model_spec.language_code << "), "
+              << n_threads << " threads, " << parallel_segments << " parallel segments, " << n_utterances << " utterances, "
+              << std::fixed << std::setprecision(1) << audio_secs << "s of audio" << ENDL;
+    std::cout << std::setprecision(3)
+              << "   model load:  " << load_secs << "s" << ENDL
+              << "   wall time:   " << wall_secs << "s" << ENDL
+              << "   throughput:  " << n_utterances / wall_secs << " utterances/s, "
+              << audio_secs / wall_secs << "s of audio/s" << ENDL
+              << "   RTF:         " << std::setprecision(4) << rtf << " (per utterance p50 " << rtf_p50
+              << ", p95 " << rtf_p95 << ", p99 " << rtf_p99 << ")" << ENDL
+              << "   CPU RTF:     " << cpu_rtf << " (cpu time over audio duration)" << ENDL
+              << "   memory:      " << std::setprecision(1) << rss_loaded_mb - rss_before_mb << "MB model + pool ("
+              << model_mb << "MB estimated for the model), "
+              << rss_peak_mb << "MB peak RSS" << ENDL;
+
+    std::cout << std::setw(12) << "stage" << std::setw(12) << "p50 (ms)" << std::setw(12) << "p95 (ms)"
+              << std::setw(12) << "p99 (ms)" << ENDL;
+    for (std::size_t s = 0; s < stages.size(); s++) {
+        std::cout << std::setw(12) << stages[s] << std::setprecision(2)
+                  << std::setw(12) << 1000 * p50[s] << std::setw(12) << 1000 * p95[s]
+                  << std::setw(12) << 1000 * p99[s] << ENDL;
+    }
+
+    if (!json_path.empty()) {
+        std::ostringstream json;
+        json << std::setprecision(6)
+             << "{\"model\":\"" << model_spec.name << "\",\"language_code\":\"" << model_spec.language_code << "\""
+             << ",\"threads\":" << n_threads << ",\"parallel_segments\":" << parallel_segments
+             << ",\"utterances\":" << n_utterances
+             << ",\"audio_secs\":" << audio_secs << ",\"wall_secs\":" << wall_secs
+             << ",\"load_secs\":" << load_secs
+             << ",\"throughput\":{\"utterances_per_sec\":" << n_utterances / wall_secs
+             << ",\"audio_secs_per_sec\":" << audio_secs / wall_secs << "}"
+             << ",\"rtf\":{\"mean\":" << rtf << ",\"p50\":" << rtf_p50 << ",\"p95\":" << rtf_p95
+             << ",\"p99\":" << rtf_p99 << "}"
+             << ",\"cpu_rtf\":" << cpu_rtf
+             << ",\"latency_ms\":{";
+        for (std::size_t s = 0; s < stages.size(); s++) {
+            json << (s ? "," : "") << "\"" << stages[s] << "\":{\"p50\":" << 1000 * p50[s]
+                 << ",\"p95\":" << 1000 * p95[s] << ",\"p99\":" << 1000 * p99[s] << "}";
+        }
+        json << "},\"memory_mb\":{\"model_and_pool\":" << rss_loaded_mb - rss_before_mb
+             << ",\"model_estimate\":" << model_mb
+             << ",\"peak_rss\":" << rss_peak_mb << "}}";
+
+        if (json_path == "-") {
+            std::cout << json.str() << ENDL;
+        } else {
+            std::ofstream json_file(json_path);
+            json_file << json.str() << "\n";
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,415 @@
+// make-tiny-model.cpp - Synthetic tiny model generator
+//
+// Generates a small but structurally complete chain model directory, as read
+// by `ChainModel`, along with synthetic audio, so that the benchmarks and
+// regression runs need neither a trained model nor any data:
+//  - a lexicon of random 3 phone (word position dependent) pronunciations over
+//    a toy phone set, a unigram G and the HCLG.fst composed from them
+//    (monophone tree with the chain topology, self-loops added as for chain)
+//  - a randomly initialized 2 layer TDNN `final.mdl` taking 40 dim MFCCs and
+//    i-vectors, `words.txt` and `word_boundary.int`
+//  - an i-vector extractor (LDA, global CMVN stats, diagonal UBM and extractor)
+//    with the confs pointing at it
+//  - optionally a toy recurrent RNNLM (`rnnlm/`) for the rescoring path
+//  - `wavs/` of speech-like synthetic audio listed in `wavs.txt` and a
+//    `model-spec.toml` loading the model
+//
+// Its transcripts are meaningless but every decoding stage does real work of
+// the same kind as with a trained model, which is all a perf test needs. The
+// output is deterministic for a given seed.
+//
+// Usage: make-tiny-model <out_dir> [--words N] [--phones N] [--utterances N]
+//                        [--sample-rate HZ] [--rnnlm] [--seed N]
+
+// stl includes
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// kaldi includes
+#include "feat/wave-reader.h"
+#include "fstext/fstext-lib.h"
+#include "gmm/diag-gmm.h"
+#include "gmm/full-gmm.h"
+#include "hmm/hmm-topology.h"
+#include "hmm/hmm-utils.h"
+#include "hmm/transition-model.h"
+#include "ivector/ivector-extractor.h"
+#include "nnet3/am-nnet-simple.h"
+#include "tree/context-dep.h"
+#include "util/common-utils.h"
+
+// lib includes
+#include <boost/filesystem.hpp>
+#include <kaldiserve/utils.hpp>
+
+using namespace kaldiserve;
+
+
+// feature dims (hires MFCCs, LDA projection for the UBM and i-vectors)
+static const int MFCC_DIM = 40;
+static const int SPLICE_CONTEXT = 3;
+static const int IVECTOR_DIM = 10;
+static const int UBM_GAUSSIANS = 16;
+// hidden layer width of the TDNN and embedding dim of the RNNLM
+static const int HIDDEN_DIM = 64;
+static const int EMBEDDING_DIM = 16;
+// probability of ending the sentence after each word in G
+static const double END_PROB = 0.1;
+
+
+// Chain topology: a single state traversed once (forward pdf) or looped on
+// (self-loop pdf).
+std::string chain_topology(const int &n_phones) {
+    std::ostringstream topo;
+    topo << "<Topology>\n<TopologyEntry>\n<ForPhones>";
+    for (int phone = 1; phone <= n_phones; phone++) topo << " " << phone;
+    topo << " </ForPhones>\n"
+         << "<State> 0 <ForwardPdfClass> 0 <SelfLoopPdfClass> 1 <Transition> 0 0.5 <Transition> 1 0.5 </State>\n"
+         << "<State> 1 </State>\n"
+         << "</TopologyEntry>\n</Topology>\n";
+    return topo.str();
+}
+
+// nnet3 config of a TDNN over MFCCs (+/- 1 frame) and the i-vector
+std::string tdnn_config(const int &n_pdfs) {
+    std::ostringstream config;
+    config << "input-node name=ivector dim=" << IVECTOR_DIM << "\n"
+           << "input-node name=input dim=" << MFCC_DIM << "\n"
+           << "component name=tdnn1.affine type=NaturalGradientAffineComponent input-dim="
+           << 3 * MFCC_DIM + IVECTOR_DIM << " output-dim=" << HIDDEN_DIM << "\n"
+           << "component-node name=tdnn1.affine component=tdnn1.affine"
+           << " input=Append(Offset(input, -1), input, Offset(input, 1), ReplaceIndex(ivector, t, 0))\n"
+           << "component name=tdnn1.relu type=RectifiedLinearComponent dim=" << HIDDEN_DIM << "\n"
+           << "component-node name=tdnn1.relu component=tdnn1.relu input=tdnn1.affine\n"
+           << "component name=tdnn2.affine type=NaturalGradientAffineComponent input-dim="
+           << 3 * HIDDEN_DIM << " output-dim=" << HIDDEN_DIM << "\n"
+           << "component-node name=tdnn2.affine component=tdnn2.affine"
+           << " input=Append(Offset(tdnn1.relu, -3), tdnn1.relu, Offset(tdnn1.relu, 3))\n"
+           << "component name=tdnn2.relu type=RectifiedLinearComponent dim=" << HIDDEN_DIM << "\n"
+           << "component-node name=tdnn2.relu component=tdnn2.relu input=tdnn2.affine\n"
+           << "component name=output.affine type=NaturalGradientAffineComponent input-dim="
+           << HIDDEN_DIM << " output-dim=" << n_pdfs << "\n"
+           << "component-node name=output.affine component=output.affine input=tdnn2.relu\n"
+           << "output-node name=output input=output.affine objective=linear\n";
+    return config.str();
+}
+
+// nnet3 config of a single layer recurrent RNNLM over word embeddings
+std::string rnnlm_config() {
+    std::ostringstream config;
+    config << "input-node name=input dim=" << EMBEDDING_DIM << "\n"
+           << "component name=rnn.affine type=NaturalGradientAffineComponent input-dim="
+           << 2 * EMBEDDING_DIM << " output-dim=" << EMBEDDING_DIM << "\n"
+           << "component-node name=rnn.affine component=rnn.affine"
+           << " input=Append(input, IfDefined(Offset(rnn.relu, -1)))\n"
+           << "component name=rnn.relu type=RectifiedLinearComponent dim=" << EMBEDDING_DIM << "\n"
+           << "component-node name=rnn.relu component=rnn.relu input=rnn.affine\n"
+           << "output-node name=output input=rnn.relu objective=linear\n";
+    return config.str();
+}
+
+void write_text(const std::string &path, const std::string &text) {
+    std::ofstream file(path);
+    if (!file) KALDI_ERR << "Could not write " << path;
+    file << text;
+}
+
+// Speech-like audio: voiced bursts (harmonics of a gliding pitch under a
+// couple of formant-ish peaks) separated by short pauses, over a noise floor.
+void synthesize_audio(const double &secs, const int &sample_rate, std::mt19937 &rng, kaldi::Matrix<kaldi::BaseFloat> &samples) {
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::normal_distribution<double> noise(0, 30);
+
+    const int n_samples = int(secs * sample_rate);
+    samples.Resize(1, n_samples);
+
+    int i = 0;
+    while (i < n_samples) {
+        // pause
+        i += int((0.05 + 0.2 * uniform(rng)) * sample_rate);
+
+        // burst
+        const int burst = int((0.15 + 0.45 * uniform(rng)) * sample_rate);
+        const double f0_start = 90 + 130 * uniform(rng), f0_end = 90 + 130 * uniform(rng);
+        const double formant_1 = 300 + 600 * uniform(rng), formant_2 = 900 + 1500 * uniform(rng);
+        double phase = 0;
+        for (int j = 0; j < burst && i + j < n_samples; j++) {
+            const double t = double(j) / burst;
+            const double f0 = f0_start + (f0_end - f0_start) * t;
+            phase += 2 * M_PI * f0 / sample_rate;
+
+            double sample = 0;
+            for (int h = 1; h * f0 < sample_rate / 2; h++) {
+                const double f = h * f0;
+                const double gain = std::exp(-std::pow((f - formant_1) / 200, 2)) +
+                                    0.5 * std::exp(-std::pow((f - formant_2) / 300, 2)) + 0.05 / h;
+                sample += gain * std::sin(h * phase);
+            }
+            samples(0, i + j) = kaldi::BaseFloat(3000 * std::sin(M_PI * t) * sample);
+        }
+        i += burst;
+    }
+
+    for (int j = 0; j < n_samples; j++) {
+        samples(0, j) = std::max(-32767.0, std::min(32767.0, samples(0, j) + noise(rng)));
+    }
+}
+
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <out_dir> [--words N] [--phones N] [--utterances N]"
+                  << " [--sample-rate HZ] [--rnnlm] [--seed N]" << ENDL;
+        return 1;
+    }
+
+    int n_words = 200, n_base_phones = 12, n_utterances = 10, sample_rate = 8000, seed = 0;
+    bool with_rnnlm = false;
+
+    for (int i = 2; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--words" && has_value) n_words = std::atoi(argv[++i]);
+        else if (arg == "--phones" && has_value) n_base_phones = std::atoi(argv[++i]);
+        else if (arg == "--utterances" && has_value) n_utterances = std::atoi(argv[++i]);
+        else if (arg == "--sample-rate" && has_value) sample_rate = std::atoi(argv[++i]);
+        else if (arg == "--rnnlm") with_rnnlm = true;
+        else if (arg == "--seed" && has_value) seed = std::atoi(argv[++i]);
+        else {
+            std::cerr << ":: Unknown option " << arg << ENDL;
+            return 1;
+        }
+    }
+    if (n_base_phones < 2 || n_words < 1 || n_words > n_base_phones * n_base_phones * n_base_phones) {
+        std::cerr << ":: Need at least 2 phones and 1 to phones^3 words" << ENDL;
+        return 1;
+    }
+
+    // kaldi's random init (nnet params, i-vector extractor) draws from rand()
+    std::srand(seed);
+    std::mt19937 rng(seed);
+
+    const std::string out_dir = boost::filesystem::absolute(argv[1]).string();
+    for (auto const &dir : {"", "conf", "ivector_extractor", "wavs"}) {
+        boost::filesystem::create_directories(join_path(out_dir, dir));
+    }
+
+    // PHONES :: silence followed by the begin, internal & end variants of each base phone
+    const int n_phones = 1 + 3 * n_base_phones;
+    std::ostringstream phones_txt, word_boundary_int;
+    phones_txt << "<eps> 0\nSIL 1\n";
+    word_boundary_int << "1 nonword\n";
+    for (int b = 0; b < n_base_phones; b++) {
+        const char *const positions[] = {"B", "I", "E"};
+        const char *const roles[] = {"begin", "internal", "end"};
+        for (int p = 0; p < 3; p++) {
+            const int phone = 2 + 3 * b + p;
+            phones_txt << "p" << b << "_" << positions[p] << " " << phone << "\n";
+            word_boundary_int << phone << " " << roles[p] << "\n";
+        }
+    }
+    write_text(join_path(out_dir, "phones.txt"), phones_txt.str());
+    write_text(join_path(out_dir, "word_boundary.int"), word_boundary_int.str());
+
+    // WORDS :: <s> and </s> take the default RNNLM bos/eos indices (1, 2)
+    std::vector<std::vector<int>> prons;
+    std::set<std::vector<int>> seen;
+    std::uniform_int_distribution<int> base_phone(0, n_base_phones - 1);
+    while (int(prons.size()) < n_words) {
+        std::vector<int> pron = {2 + 3 * base_phone(rng), 3 + 3 * base_phone(rng), 4 + 3 * base_phone(rng)};
+        if (seen.insert(pron).second) prons.push_back(pron);
+    }
+
+    const int first_word = 3;
+    std::ostringstream words_txt, lexicon_txt;
+    words_txt << "<eps> 0\n<s> 1\n</s> 2\n";
+    for (int w = 0; w < n_words; w++) {
+        words_txt << "w" << w << " " << first_word + w << "\n";
+        lexicon_txt << "w" << w;
+        for (int phone : prons[w]) lexicon_txt << " p" << (phone - 2) / 3 << "_" << "BIE"[(phone - 2) % 3];
+        lexicon_txt << "\n";
+    }
+    write_text(join_path(out_dir, "words.txt"), words_txt.str());
+    write_text(join_path(out_dir, "lexicon.txt"), lexicon_txt.str());
+
+    // TRANSITION MODEL & TDNN :: final.mdl
+    kaldi::HmmTopology topo;
+    {
+        std::istringstream topo_stream(chain_topology(n_phones));
+        topo.Read(topo_stream, false);
+    }
+    std::vector<int32> phones, phone2num_pdf_classes;
+    for (int phone = 1; phone <= n_phones; phone++) phones.push_back(phone);
+    topo.GetPhoneToNumPdfClasses(&phone2num_pdf_classes);
+    std::unique_ptr<kaldi::ContextDependency> ctx_dep(kaldi::MonophoneContextDependency(phones, phone2num_pdf_classes));
+    kaldi::TransitionModel trans_model(*ctx_dep, topo);
+
+    kaldi::nnet3::Nnet nnet;
+    {
+        std::istringstream config(tdnn_config(trans_model.NumPdfs()));
+        nnet.ReadConfig(config);
+    }
+    kaldi::nnet3::AmNnetSimple am_nnet(nnet);
+    {
+        kaldi::Output ko(join_path(out_dir, "final.mdl"), true);
+        trans_model.Write(ko.Stream(), true);
+        am_nnet.Write(ko.Stream(), true);
+    }
+    kaldi::WriteKaldiObject(*ctx_dep, join_path(out_dir, "tree"), true);
+
+    // GRAMMAR :: unigram over all words
+    fst::VectorFst<fst::StdArc> g_fst;
+    g_fst.AddState();
+    g_fst.SetStart(0);
+    g_fst.SetFinal(0, fst::TropicalWeight(-std::log(END_PROB)));
+    for (int w = 0; w < n_words; w++) {
+        const int word = first_word + w;
+        g_fst.AddArc(0, fst::StdArc(word, word, fst::TropicalWeight(-std::log((1 - END_PROB) / n_words)), 0));
+    }
+
+    // LEXICON :: optional silence between words, each word output on its first phone
+    fst::VectorFst<fst::StdArc> l_fst;
+    l_fst.AddState();
+    l_fst.SetStart(0);
+    l_fst.SetFinal(0, fst::TropicalWeight::One());
+    l_fst.AddArc(0, fst::StdArc(1, 0, fst::TropicalWeight(std::log(2.0)), 0));
+    for (int w = 0; w < n_words; w++) {
+        int state = 0;
+        for (std::size_t p = 0; p < prons[w].size(); p++) {
+            const int next = p + 1 < prons[w].size() ? l_fst.AddState() : 0;
+            l_fst.AddArc(state, fst::StdArc(prons[w][p], p == 0 ? first_word + w : 0, fst::TropicalWeight::One(), next));
+            state = next;
+        }
+    }
+
+    // HCLG :: as mkgraph.sh for chain models (the monophone C is the identity)
+    fst::VectorFst<fst::StdArc> lg_fst, hclg_fst;
+    fst::ArcSort(&l_fst, fst::OLabelCompare<fst::StdArc>());
+    fst::ArcSort(&g_fst, fst::ILabelCompare<fst::StdArc>());
+    fst::TableCompose(l_fst, g_fst, &lg_fst);
+    fst::DeterminizeStarInLog(&lg_fst);
+    fst::MinimizeEncoded(&lg_fst);
+    fst::ArcSort(&lg_fst, fst::ILabelCompare<fst::StdArc>());
+
+    std::vector<std::vector<int32>> ilabel_info(n_phones + 1);
+    for (int phone = 1; phone <= n_phones; phone++) ilabel_info[phone].push_back(phone);
+    std::vector<int32> disambig_tids;
+    std::unique_ptr<fst::VectorFst<fst::StdArc>> h_fst(
+        kaldi::GetHTransducer(ilabel_info, *ctx_dep, trans_model, kaldi::HTransducerConfig(), &disambig_tids));
+
+    fst::TableCompose(*h_fst, lg_fst, &hclg_fst);
+    fst::DeterminizeStarInLog(&hclg_fst);
+    fst::RemoveEpsLocal(&hclg_fst);
+    fst::MinimizeEncoded(&hclg_fst);
+    kaldi::AddSelfLoops(trans_model, disambig_tids, 1.0, true, true, &hclg_fst);
+    fst::WriteFstKaldi(hclg_fst, join_path(out_dir, "HCLG.fst"));
+    fst::WriteFstKaldi(g_fst, join_path(out_dir, "G.fst"));
+
+    // I-VECTOR EXTRACTOR
+    const int spliced_dim = (2 * SPLICE_CONTEXT + 1) * MFCC_DIM;
+    {
+        // LDA picks out the central frame of the splice
+        kaldi::Matrix<kaldi::BaseFloat> lda(MFCC_DIM, spliced_dim);
+        for (int d = 0; d < MFCC_DIM; d++) lda(d, SPLICE_CONTEXT * MFCC_DIM + d) = 1.0;
+        kaldi::WriteKaldiObject(lda, join_path(out_dir, "ivector_extractor/final.mat"), true);
+
+        // zero mean, unit variance
+        kaldi::Matrix<double> cmvn_stats(2, MFCC_DIM + 1);
+        cmvn_stats(0, MFCC_DIM) = 100;
+        for (int d = 0; d < MFCC_DIM; d++) cmvn_stats(1, d) = 100;
+        kaldi::WriteKaldiObject(cmvn_stats, join_path(out_dir, "ivector_extractor/global_cmvn.stats"), true);
+
+        kaldi::Matrix<kaldi::BaseFloat> means(UBM_GAUSSIANS, MFCC_DIM), inv_vars(UBM_GAUSSIANS, MFCC_DIM);
+        means.SetRandn();
+        inv_vars.Set(1.0);
+        kaldi::Vector<kaldi::BaseFloat> weights(UBM_GAUSSIANS);
+        weights.Set(1.0 / UBM_GAUSSIANS);
+
+        kaldi::DiagGmm ubm(UBM_GAUSSIANS, MFCC_DIM);
+        ubm.SetWeights(weights);
+        ubm.SetInvVarsAndMeans(inv_vars, means);
+        ubm.ComputeGconsts();
+        kaldi::WriteKaldiObject(ubm, join_path(out_dir, "ivector_extractor/final.dubm"), true);
+
+        kaldi::FullGmm full_ubm;
+        full_ubm.CopyFromDiagGmm(ubm);
+        kaldi::IvectorExtractorOptions ivector_opts;
+        ivector_opts.ivector_dim = IVECTOR_DIM;
+        ivector_opts.use_weights = false;
+        kaldi::IvectorExtractor extractor(ivector_opts, full_ubm);
+        kaldi::WriteKaldiObject(extractor, join_path(out_dir, "ivector_extractor/final.ie"), true);
+    }
+
+    // CONFS (extractor paths relative to the model dir)
+    std::ostringstream mfcc_conf, ivector_conf;
+    mfcc_conf << "--use-energy=false\n--sample-frequency=" << sample_rate << "\n"
+              << "--num-mel-bins=" << MFCC_DIM << "\n--num-ceps=" << MFCC_DIM << "\n"
+              << "--low-freq=40\n--high-freq=-200\n";
+    ivector_conf << "--splice-config=conf/splice.conf\n"
+                 << "--cmvn-config=conf/online_cmvn.conf\n"
+                 << "--lda-matrix=ivector_extractor/final.mat\n"
+                 << "--global-cmvn-stats=ivector_extractor/global_cmvn.stats\n"
+                 << "--diag-ubm=ivector_extractor/final.dubm\n"
+                 << "--ivector-extractor=ivector_extractor/final.ie\n"
+                 << "--num-gselect=5\n--min-post=0.025\n--posterior-scale=0.1\n"
+                 << "--max-remembered-frames=1000\n--max-count=0\n--ivector-period=10\n";
+    write_text(join_path(out_dir, "conf/mfcc.conf"), mfcc_conf.str());
+    write_text(join_path(out_dir, "conf/ivector_extractor.conf"), ivector_conf.str());
+    write_text(join_path(out_dir, "conf/splice.conf"),
+               "--left-context=" + std::to_string(SPLICE_CONTEXT) + "\n--right-context=" + std::to_string(SPLICE_CONTEXT) + "\n");
+    write_text(join_path(out_dir, "conf/online_cmvn.conf"), "--norm-vars=false\n");
+
+    // RNNLM (embeddings indexed by words.txt, G.fst as the LM to subtract)
+    if (with_rnnlm) {
+        const std::string rnnlm_dir = join_path(out_dir, "rnnlm");
+        boost::filesystem::create_directories(rnnlm_dir);
+
+        kaldi::nnet3::Nnet rnnlm;
+        std::istringstream config(rnnlm_config());
+        rnnlm.ReadConfig(config);
+        kaldi::WriteKaldiObject(rnnlm, join_path(rnnlm_dir, "final.raw"), true);
+
+        kaldi::Matrix<kaldi::BaseFloat> word_embedding(first_word + n_words, EMBEDDING_DIM);
+        word_embedding.SetRandn();
+        word_embedding.Scale(0.1);
+        kaldi::WriteKaldiObject(word_embedding, join_path(rnnlm_dir, "word_embedding.mat"), true);
+
+        fst::WriteFstKaldi(g_fst, join_path(rnnlm_dir, "G.fst"));
+    }
+
+    // AUDIO (2-8s utterances)
+    std::ostringstream wavs_txt;
+    std::uniform_real_distribution<double> duration(2, 8);
+    for (int u = 0; u < n_utterances; u++) {
+        kaldi::Matrix<kaldi::BaseFloat> samples;
+        synthesize_audio(duration(rng), sample_rate, rng, samples);
+
+        const std::string wav_path = join_path(out_dir, "wavs/utt" + std::to_string(u) + ".wav");
+        std::ofstream wav_file(wav_path, std::ios::binary);
+        kaldi::WaveData(kaldi::BaseFloat(sample_rate), samples).Write(wav_file);
+        wavs_txt << wav_path << "\n";
+    }
+    write_text(join_path(out_dir, "wavs.txt"), wavs_txt.str());
+
+    std::ostringstream toml;
+    toml << "# generated by make-tiny-model (seed " << seed << ")\n"
+         << "[[model]]\n"
+         << "name = \"tiny\"\n"
+         << "language_code = \"en\"\n"
+         << "path = \"" << out_dir << "\"\n"
+         << "n_decoders = 4\n";
+    write_text(join_path(out_dir, "model-spec.toml"), toml.str());
+
+    std::cout << ":: Generated a " << n_words << " word, " << trans_model.NumPdfs() << " pdf model"
+              << (with_rnnlm ? " (with RNNLM)" : "") << " and " << n_utterances << " utterances in " << out_dir << ENDL;
+    return 0;
+}
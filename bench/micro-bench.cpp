@@ -0,0 +1,258 @@
+// micro-bench.cpp - Micro-benchmarks of the library's hot paths
+//
+// Times the per-request hot paths in isolation: raw PCM and wav chunk parsing,
+// DecoderQueue acquire/release under contention, n-best extraction off
+// recorded lattices (`find_alternatives`, with and without word level timings
+// and RNNLM rescoring, copying the lattice included), symbol table lookups and
+// `string_join`. Every case is run for a doubling no. of iterations until it
+// takes at least `min_secs`, and reported in ns per op.
+//
+// Cases needing a model only run when a model spec toml is given, and the
+// `find_alternatives` ones also need lattices recorded by the model, e.g.
+// `ark:gunzip -c exp/decode/lat.1.gz |`.
+//
+// Usage: micro-bench [--model-spec TOML] [--lattices RSPECIFIER] [--filter SUBSTR] [--min-secs SECS]
+
+// stl includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// lib includes
+#include <kaldiserve/decoder.hpp>
+#include <kaldiserve/model.hpp>
+#include <kaldiserve/utils.hpp>
+
+using namespace kaldiserve;
+
+
+// max lattices read off the rspecifier
+static const std::size_t MAX_LATTICES = 200;
+
+// a benchmark case: runs its op `n` times and returns the no. of ops done
+struct Case {
+    std::string name;
+    std::function<std::size_t(const std::size_t &)> run;
+};
+
+// keeps results of the ops alive so that the compiler can't drop them
+static std::atomic<std::size_t> sink(0);
+
+
+// 16-bit mono PCM of a sine tone
+std::string sine_pcm(const double &secs, const int &sample_rate) {
+    std::string pcm;
+    const std::size_t n_samples = std::size_t(secs * sample_rate);
+    for (std::size_t i = 0; i < n_samples; i++) {
+        const int16_t sample = int16_t(8000 * std::sin(2 * M_PI * 440 * double(i) / sample_rate));
+        pcm += char(sample & 0xff);
+        pcm += char((sample >> 8) & 0xff);
+    }
+    return pcm;
+}
+
+// PCM prefixed with a canonical 44 byte wav header
+std::string wav_chunk(const std::string &pcm, const int &sample_rate) {
+    auto u32 = [](std::string &out, const uint32_t &value) {
+        for (int i = 0; i < 4; i++) out += char((value >> (8 * i)) & 0xff);
+    };
+    auto u16 = [](std::string &out, const uint16_t &value) {
+        out += char(value & 0xff);
+        out += char((value >> 8) & 0xff);
+    };
+
+    std::string wav = "RIFF";
+    u32(wav, 36 + pcm.size());
+    wav += "WAVEfmt ";
+    u32(wav, 16);
+    u16(wav, 1);                // PCM
+    u16(wav, 1);                // mono
+    u32(wav, sample_rate);
+    u32(wav, sample_rate * 2);  // byte rate
+    u16(wav, 2);                // block align
+    u16(wav, 16);               // bits per sample
+    wav += "data";
+    u32(wav, pcm.size());
+    return wav + pcm;
+}
+
+// n acquire/release pairs on each of `n_threads` threads
+std::size_t acquire_release(DecoderQueue &queue, const int &n_threads, const std::size_t &n) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n_threads; t++) {
+        threads.emplace_back([&queue, &n]() {
+            for (std::size_t i = 0; i < n; i++) {
+                Decoder *decoder = queue.acquire();
+                queue.release(decoder);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+    return n * n_threads;
+}
+
+
+int main(int argc, char *argv[]) {
+    std::string model_spec_toml, lattices_rspecifier, filter;
+    double min_secs = 0.5;
+
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--model-spec" && has_value) model_spec_toml = argv[++i];
+        else if (arg == "--lattices" && has_value) lattices_rspecifier = argv[++i];
+        else if (arg == "--filter" && has_value) filter = argv[++i];
+        else if (arg == "--min-secs" && has_value) min_secs = std::atof(argv[++i]);
+        else {
+            std::cerr << "usage: " << argv[0] << " [--model-spec TOML] [--lattices RSPECIFIER]"
+                      << " [--filter SUBSTR] [--min-secs SECS]" << ENDL;
+            return 1;
+        }
+    }
+
+    std::vector<Case> cases;
+
+    // audio parsing (a 0.5s chunk at 8kHz, as streamed by clients)
+    const int sample_rate = 8000;
+    const std::string pcm = sine_pcm(0.5, sample_rate);
+    const std::string wav = wav_chunk(pcm, sample_rate);
+
+    cases.push_back({"read_raw_wav_stream/0.5s", [&pcm](const std::size_t &n) {
+        for (std::size_t i = 0; i < n; i++) {
+            std::stringstream stream(pcm);
+            kaldi::Matrix<kaldi::BaseFloat> wav_data;
+            read_raw_wav_stream(stream, pcm.size(), wav_data);
+            sink += wav_data.NumCols();
+        }
+        return n;
+    }});
+    cases.push_back({"WaveData::Read/0.5s", [&wav](const std::size_t &n) {
+        for (std::size_t i = 0; i < n; i++) {
+            std::stringstream stream(wav);
+            kaldi::WaveData wave_data;
+            wave_data.Read(stream);
+            sink += wave_data.Data().NumCols();
+        }
+        return n;
+    }});
+
+    // string joining (a 20 word transcript)
+    const std::vector<std::string> words(20, "transcript");
+    cases.push_back({"string_join/20", [&words](const std::size_t &n) {
+        std::string output;
+        for (std::size_t i = 0; i < n; i++) {
+            string_join(words, " ", output);
+            sink += output.size();
+        }
+        return n;
+    }});
+
+    std::vector<ModelSpec> model_specs;
+    if (!model_spec_toml.empty()) parse_model_specs(model_spec_toml, model_specs);
+
+    std::unique_ptr<DecoderQueue> queue;
+    std::unique_ptr<ChainModel> model;
+    std::vector<kaldi::CompactLattice> lattices;
+
+    if (!model_specs.empty()) {
+        const int max_threads = std::max(int(std::thread::hardware_concurrency()), 1);
+
+        ModelSpec model_spec = model_specs[0];
+        model_spec.n_decoders = model_spec.min_decoders = model_spec.max_decoders = max_threads;
+        queue = make_uniq<DecoderQueue>(model_spec);
+        model = make_uniq<ChainModel>(model_specs[0]);
+
+        // acquire/release (powers of two followed by the max thread count)
+        std::vector<int> thread_counts;
+        for (int t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+        thread_counts.push_back(max_threads);
+        for (int n_threads : thread_counts) {
+            DecoderQueue *const q = queue.get();
+            cases.push_back({"DecoderQueue::acquire+release/threads:" + std::to_string(n_threads),
+                             [q, n_threads](const std::size_t &n) { return acquire_release(*q, n_threads, n); }});
+        }
+
+        // symbol lookups, both ways
+        fst::SymbolTable *const word_syms = model->word_syms.get();
+        const int64 n_syms = std::max<int64>(word_syms->NumSymbols(), 1);
+        cases.push_back({"SymbolTable::Find(id)", [word_syms, n_syms](const std::size_t &n) {
+            for (std::size_t i = 0; i < n; i++) sink += word_syms->Find(int64(i) % n_syms).size();
+            return n;
+        }});
+        std::vector<std::string> symbols;
+        for (int64 i = 0; i < std::min<int64>(n_syms, 1000); i++) symbols.push_back(word_syms->Find(i));
+        cases.push_back({"SymbolTable::Find(word)", [word_syms, symbols](const std::size_t &n) {
+            for (std::size_t i = 0; i < n; i++) sink += word_syms->Find(symbols[i % symbols.size()]);
+            return n;
+        }});
+
+        if (!lattices_rspecifier.empty()) {
+            kaldi::SequentialCompactLatticeReader reader(lattices_rspecifier);
+            for (; !reader.Done() && lattices.size() < MAX_LATTICES; reader.Next()) {
+                lattices.push_back(reader.Value());
+            }
+        }
+
+        for (const bool rnnlm : {false, true}) {
+            if (lattices.empty() || (rnnlm && model->rnnlm_info == nullptr)) continue;
+
+            for (const bool word_level : {false, true}) {
+                if (word_level && model->wb_info == nullptr) continue;
+
+                for (const std::size_t n_best : {1, 10}) {
+                    ChainModel *const m = model.get();
+                    const std::vector<kaldi::CompactLattice> *const lats = &lattices;
+                    const DecoderOptions options{word_level, rnnlm};
+
+                    cases.push_back({"find_alternatives/n_best:" + std::to_string(n_best) +
+                                         (word_level ? "/word_level" : "") + (rnnlm ? "/rnnlm" : ""),
+                                     [m, lats, options, n_best, word_level](const std::size_t &n) {
+                        for (std::size_t i = 0; i < n; i++) {
+                            kaldi::CompactLattice clat = (*lats)[i % lats->size()];
+                            utterance_results_t results;
+                            find_alternatives(clat, n_best, results, word_level, m, options);
+                            sink += results.size();
+                        }
+                        return n;
+                    }});
+                }
+            }
+        }
+    }
+
+    std::cout << std::setw(52) << std::left << "case" << std::right
+              << std::setw(14) << "iterations" << std::setw(16) << "ns/op" << ENDL;
+
+    for (auto const &c : cases) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+
+        c.run(1); // warm up
+
+        std::size_t n = 1, ops = 0;
+        double secs = 0;
+        while (true) {
+            const auto start = std::chrono::steady_clock::now();
+            ops = c.run(n);
+            secs = elapsed_secs(start);
+            if (secs >= min_secs) break;
+            n *= 2;
+        }
+
+        std::cout << std::setw(52) << std::left << c.name << std::right
+                  << std::setw(14) << n
+                  << std::setw(16) << std::fixed << std::setprecision(1) << 1e9 * secs / ops << ENDL;
+    }
+
+    return 0;
+}
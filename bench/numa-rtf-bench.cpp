@@ -0,0 +1,130 @@
+// numa-rtf-bench.cpp - Decoding real-time factor across NUMA nodes benchmark
+//
+// Decodes a wav file over and over from threads pinned to each NUMA node in
+// turn, once with a single copy of the model allocated on node 0 (remote for
+// the threads of every other node) and once with a NUMA-aware pool that keeps
+// a model replica per node, and reports the real-time factor (decoding time /
+// audio duration, lower is better) of each combination.
+//
+// Usage: numa-rtf-bench <model_spec_toml> <wav_file> [threads_per_node] [decodes_per_thread]
+
+// stl includes
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// lib includes
+#include <kaldiserve/decoder.hpp>
+#include <kaldiserve/utils.hpp>
+
+using namespace kaldiserve;
+
+
+// decodes the audio from threads pinned to the given cpus, returns the RTF
+double run(DecoderQueue &queue, const std::string &wav_bytes, const double &audio_secs,
+           const std::vector<int> &cpus, const int &n_threads, const int &n_decodes) {
+    std::vector<double> decode_secs(n_threads, 0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < n_threads; t++) {
+        threads.emplace_back([&, t]() {
+            ScopedThreadAffinity worker_affinity(cpus);
+
+            for (int i = 0; i < n_decodes; i++) {
+                Decoder *decoder = queue.acquire();
+                // same as the server: follow the decoder to its node
+                ScopedThreadAffinity decoder_affinity(queue.affinity(decoder));
+
+                auto start_time = std::chrono::steady_clock::now();
+
+                std::stringstream wav_stream(wav_bytes);
+                utterance_results_t results;
+                decoder->start_decoding();
+                decoder->decode_wav_audio(wav_stream);
+                decoder->get_decoded_results(1, results);
+                decoder->free_decoder();
+
+                decode_secs[t] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+                queue.release(decoder);
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+
+    double total = 0;
+    for (auto secs : decode_secs) total += secs;
+    return total / (audio_secs * n_threads * n_decodes);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <model_spec_toml> <wav_file> [threads_per_node] [decodes_per_thread]" << ENDL;
+        return 1;
+    }
+
+    const int threads_per_node = argc > 3 ? std::atoi(argv[3]) : 4;
+    const int decodes_per_thread = argc > 4 ? std::atoi(argv[4]) : 5;
+
+    std::vector<ModelSpec> model_specs;
+    parse_model_specs(argv[1], model_specs);
+    if (model_specs.empty()) {
+        std::cerr << ":: No model found in toml for loading" << ENDL;
+        return 1;
+    }
+
+    std::ifstream wav_file(argv[2], std::ios::binary);
+    std::stringstream wav_bytes;
+    wav_bytes << wav_file.rdbuf();
+
+    kaldi::WaveData wave_data;
+    std::stringstream wav_stream(wav_bytes.str());
+    wave_data.Read(wav_stream);
+    const double audio_secs = wave_data.Duration();
+
+    std::vector<std::vector<int>> node_cpus;
+    numa_node_cpus(node_cpus);
+    if (node_cpus.size() < 2) {
+        std::cerr << ":: Found a single NUMA node, there's no cross-node traffic to measure" << ENDL;
+        if (node_cpus.empty()) node_cpus.assign(1, std::vector<int>());
+    }
+    const int n_nodes = node_cpus.size();
+
+    ModelSpec model_spec = model_specs[0];
+    model_spec.n_decoders = model_spec.min_decoders = model_spec.max_decoders = threads_per_node * n_nodes;
+
+    std::cout << std::setw(12) << "model" << std::setw(14) << "worker node" << std::setw(10) << "RTF" << ENDL;
+
+    // a single model copy, first touched from node 0
+    {
+        model_spec.numa_aware = false;
+        std::unique_ptr<DecoderQueue> queue;
+        {
+            ScopedThreadAffinity affinity(node_cpus[0]);
+            queue = make_uniq<DecoderQueue>(model_spec);
+        }
+        for (int node = 0; node < n_nodes; node++) {
+            double rtf = run(*queue, wav_bytes.str(), audio_secs, node_cpus[node], threads_per_node, decodes_per_thread);
+            std::cout << std::setw(12) << "node 0" << std::setw(14) << node
+                      << std::setw(10) << std::fixed << std::setprecision(4) << rtf << ENDL;
+        }
+    }
+
+    // a model replica per node
+    {
+        model_spec.numa_aware = true;
+        DecoderQueue queue(model_spec);
+        for (int node = 0; node < n_nodes; node++) {
+            double rtf = run(queue, wav_bytes.str(), audio_secs, node_cpus[node], threads_per_node, decodes_per_thread);
+            std::cout << std::setw(12) << "per node" << std::setw(14) << node
+                      << std::setw(10) << std::fixed << std::setprecision(4) << rtf << ENDL;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+// Batched acoustic model inference across decoders.
+#pragma once
+
+// stl includes
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// kaldi includes
+#include "base/kaldi-common.h"
+#include "decoder/lattice-faster-online-decoder.h"
+#include "fstext/fstext-lib.h"
+#include "hmm/transition-model.h"
+#include "itf/decodable-itf.h"
+#include "itf/online-feature-itf.h"
+#include "lat/determinize-lattice-pruned.h"
+#include "nnet3/nnet-batch-compute.h"
+#include "online2/online-nnet2-feature-pipeline.h"
+
+// local includes
+#include "config.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+// Batching inference scheduler shared by all the decoders of a model.
+// Decoders submit fixed size feature chunks as inference tasks, a single
+// compute thread gathers the pending tasks across decoders into minibatches,
+// evaluates the acoustic model on them in one go and scatters the
+// log-likelihoods back to the waiting decoders.
+class NnetBatchScheduler final {
+
+  public:
+    NnetBatchScheduler(const ModelSpec &model_spec, const kaldi::nnet3::Nnet &nnet);
+
+    NnetBatchScheduler(const NnetBatchScheduler &) = delete; // disable copying
+
+    NnetBatchScheduler &operator=(const NnetBatchScheduler &) = delete; // disable assignment
+
+    ~NnetBatchScheduler();
+
+    // submits the tasks for batched computation and blocks
+    // until the outputs of all of them are available
+    void compute(std::vector<kaldi::nnet3::NnetInferenceTask> &tasks);
+
+    // no. of (non-subsampled) output frames per task
+    inline int32 frames_per_chunk() const noexcept { return frames_per_chunk_; }
+
+    inline int32 frame_subsampling_factor() const noexcept { return frame_subsampling_factor_; }
+
+    // input frames of context needed on either side of a chunk
+    inline int32 left_context() const noexcept { return left_context_; }
+    inline int32 right_context() const noexcept { return right_context_; }
+
+  private:
+    // compute loop of the scheduler thread
+    void run_();
+
+    int32 frames_per_chunk_;
+    int32 frame_subsampling_factor_;
+    int32 left_context_;
+    int32 right_context_;
+
+    // how long a partial minibatch is held open for other decoders to join
+    std::chrono::milliseconds max_delay_;
+
+    // priors are not used for chain models (kept empty)
+    kaldi::Vector<kaldi::BaseFloat> priors_;
+    std::unique_ptr<kaldi::nnet3::NnetBatchComputer> computer_;
+
+    bool pending_ = false;
+    bool stopped_ = false;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::thread thread_;
+};
+
+
+// Online decodable that computes the acoustic model log-likelihoods chunk-wise
+// through the model's `NnetBatchScheduler` instead of running a per-decoder
+// looped computation. Follows the frame readiness semantics of
+// `kaldi::nnet3::DecodableAmNnetLoopedOnline`.
+class DecodableNnetBatchedOnline final : public kaldi::DecodableInterface {
+
+  public:
+    DecodableNnetBatchedOnline(const kaldi::TransitionModel &trans_model,
+                               NnetBatchScheduler *const scheduler,
+                               kaldi::OnlineFeatureInterface *input_features,
+                               kaldi::OnlineFeatureInterface *ivector_features,
+                               std::vector<Span> *const spans=nullptr);
+
+    kaldi::BaseFloat LogLikelihood(int32 subsampled_frame, int32 index) override;
+
+    bool IsLastFrame(int32 subsampled_frame) const override;
+
+    int32 NumFramesReady() const override;
+
+    int32 NumIndices() const override { return trans_model_.NumTransitionIds(); }
+
+  private:
+    // submits all the chunks that are ready at the input (at least up to
+    // `subsampled_frame`) as one set of tasks and collects their outputs
+    void compute_ready_chunks_(int32 subsampled_frame);
+
+    const kaldi::TransitionModel &trans_model_;
+    NnetBatchScheduler *scheduler_;
+
+    kaldi::OnlineFeatureInterface *input_features_;
+    kaldi::OnlineFeatureInterface *ivector_features_;
+
+    // records the batched computations as spans (if tracing)
+    std::vector<Span> *spans_;
+
+    // log-likelihoods for the most recently computed chunks
+    kaldi::Matrix<kaldi::BaseFloat> log_likes_;
+    // subsampled frame index of the first row of `log_likes_`
+    int32 log_likes_offset_ = 0;
+    int32 num_chunks_computed_ = 0;
+};
+
+
+// Drop-in counterpart of `kaldi::SingleUtteranceNnet3Decoder` (same method
+// names and semantics) that evaluates the acoustic model via batched inference.
+class BatchedNnet3Decoder final {
+
+  public:
+    BatchedNnet3Decoder(const kaldi::LatticeFasterDecoderConfig &decoder_opts,
+                        const kaldi::TransitionModel &trans_model,
+                        NnetBatchScheduler *const scheduler,
+                        const fst::Fst<fst::StdArc> &fst,
+                        kaldi::OnlineNnet2FeaturePipeline *features,
+                        std::vector<Span> *const spans=nullptr);
+
+    void InitDecoding();
+
+    void AdvanceDecoding();
+
+    void FinalizeDecoding();
+
+    int32 NumFramesDecoded() const;
+
+    void GetLattice(bool end_of_utterance, kaldi::CompactLattice *clat) const;
+
+    const kaldi::LatticeFasterOnlineDecoder &Decoder() const { return decoder_; }
+
+  private:
+    const kaldi::LatticeFasterDecoderConfig &decoder_opts_;
+    const kaldi::TransitionModel &trans_model_;
+
+    DecodableNnetBatchedOnline decodable_;
+    kaldi::LatticeFasterOnlineDecoder decoder_;
+};
+
+} // namespace kaldiserve
@@ -2,12 +2,22 @@
 #pragma once
 
 // stl includes
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <iostream>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 // kaldi includes
@@ -29,6 +39,7 @@
 #include "util/kaldi-thread.h"
 
 // local includes
+#include "batch.hpp"
 #include "config.hpp"
 #include "types.hpp"
 #include "model.hpp"
@@ -41,6 +52,15 @@ namespace kaldiserve {
 class ChainModel;
 
 
+// Thrown by the decoding methods when the cancellation token
+// of the utterance reports that its caller has gone away.
+class DecodingCancelledError final : public std::runtime_error {
+
+  public:
+    DecodingCancelledError() : std::runtime_error("decoding cancelled") {}
+};
+
+
 class Decoder final {
 
   public:
@@ -49,7 +69,13 @@ class Decoder final {
     ~Decoder() noexcept;
 
     // SETUP METHODS
-    void start_decoding(const std::string &uuid="") noexcept;
+
+    // `is_cancelled` is checked between chunks and before lattice processing,
+    // decoding is abandoned with a `DecodingCancelledError` once it returns true;
+    // with `tracing` each stage of decoding is recorded as a span
+    void start_decoding(const std::string &uuid="",
+                        const std::function<bool()> &is_cancelled=nullptr,
+                        const bool &tracing=false) noexcept;
 
     void free_decoder() noexcept;
 
@@ -77,6 +103,46 @@ class Decoder final {
                               const int &data_bytes,
                               const float &chunk_size=1);
 
+    // decodes an (independent) long wav audio split at silences into segments
+    // of at most the model's `max_segment_length`, in parallel on this decoder
+    // and the `helpers` (other decoders of the model, started along with it),
+    // and gets the results of the segments stitched in order, with word
+    // timings relative to the start of the audio and the helpers' stats
+    // added into this decoder's. The helpers decode on tasks run by the
+    // `executor` (e.g. the caller's worker pool) or, without one, on a
+    // thread each (which adds up to as many threads as helpers on top of the
+    // caller's).
+    void decode_segmented_wav_audio(std::istream &wav_stream,
+                                    const std::vector<Decoder *> &helpers,
+                                    const int &n_best,
+                                    utterance_results_t &results,
+                                    const bool &word_level=false,
+                                    const float &chunk_size=1,
+                                    const task_executor_t &executor=nullptr);
+
+    // same as above for a raw headerless wav audio stream
+    void decode_segmented_raw_wav_audio(std::istream &wav_stream,
+                                        const float &samp_freq,
+                                        const int &data_bytes,
+                                        const std::vector<Decoder *> &helpers,
+                                        const int &n_best,
+                                        utterance_results_t &results,
+                                        const bool &word_level=false,
+                                        const float &chunk_size=1,
+                                        const task_executor_t &executor=nullptr);
+
+    // CONTINUOUS STREAM METHODS
+
+    // true once the current segment reached an endpoint (trailing silence
+    // or max length, as per the model's endpointing rules; only the latter
+    // for models without silence phones)
+    bool endpoint_detected();
+
+    // starts decoding the next segment (after its results were taken),
+    // carrying over the speaker adaptation (i-vector) state; word timings of
+    // later segments are relative to the start of the stream
+    void start_next_segment();
+
     // LATTICE DECODING METHODS
 
     // get the final utterances based on the compact lattice
@@ -85,14 +151,64 @@ class Decoder final {
                              const bool &word_level=false,
                              const bool &bidi_streaming=false);
 
+    // audio fed into the current utterance and time spent on it so far
+    inline const DecodingStats &stats() const noexcept {
+        return stats_;
+    }
+
+    // memory held by the current utterance's state (read it from the
+    // thread using the decoder)
+    DecoderMemory memory() const;
+
+    // stages of the current utterance timed so far (if tracing)
+    inline const std::vector<Span> &spans() const noexcept {
+        return spans_;
+    }
+
     DecoderOptions options{false, false};
 
   private:
+    // throws if the utterance got cancelled
+    void _check_cancelled() const;
+
+    // span list to record the stages into (nullptr if not tracing)
+    inline std::vector<Span> *_trace() noexcept {
+        return tracing_ ? &spans_ : nullptr;
+    }
+
+    // sets up the feature pipeline and the search of a new segment
+    void _init_segment();
+
+    // tears down the feature pipeline and the search of the current segment
+    void _free_segment() noexcept;
+
+    // decodes a whole audio in chunks of `chunk_size` seconds
+    void _decode_chunked(const kaldi::VectorBase<kaldi::BaseFloat> &data,
+                         const kaldi::BaseFloat &samp_freq,
+                         const float &chunk_size);
+
+    // decodes the segments of an audio on this decoder and the helpers
+    void _decode_segmented(const kaldi::VectorBase<kaldi::BaseFloat> &data,
+                           const kaldi::BaseFloat &samp_freq,
+                           const std::vector<Decoder *> &helpers,
+                           const int &n_best,
+                           utterance_results_t &results,
+                           const bool &word_level,
+                           const float &chunk_size,
+                           const task_executor_t &executor);
+
     // decodes an intermediate wavepart
     void _decode_wave(kaldi::SubVector<kaldi::BaseFloat> &wave_part,
                       std::vector<std::pair<int32, kaldi::BaseFloat>> &delta_weights,
                       const kaldi::BaseFloat &samp_freq);
 
+    // search helpers dispatching to the looped or batched nnet3 decoder
+    void _advance_decoding();
+    void _finalize_decoding();
+    int32 _num_frames_decoded() const;
+    void _get_lattice(kaldi::CompactLattice &clat) const;
+    const kaldi::LatticeFasterOnlineDecoder &_search_decoder() const;
+
     // gets the final decoded transcripts from lattice
     void _find_alternatives(kaldi::CompactLattice &clat,
                             const std::size_t &n_best,
@@ -104,12 +220,30 @@ class Decoder final {
 
     // decoder vars (per utterance)
     kaldi::SingleUtteranceNnet3Decoder *decoder_;
+    BatchedNnet3Decoder *batched_decoder_;
     kaldi::OnlineNnet2FeaturePipeline *feature_pipeline_;
     kaldi::OnlineSilenceWeighting *silence_weighting_;
     kaldi::OnlineIvectorExtractorAdaptationState *adaptation_state_;
 
     // req-specific vars
     std::string uuid_;
+    std::function<bool()> is_cancelled_;
+    DecodingStats stats_;
+    std::size_t lattice_bytes_ = 0;
+    // audio before the current segment of a continuous stream
+    double segment_start_secs_ = 0;
+    bool tracing_ = false;
+    std::vector<Span> spans_;
+
+    // set by the queue when the decoder was handed out against the
+    // low priority share of the pool
+    friend class DecoderQueue;
+    bool low_priority_slot_ = false;
+    int tenant_ = -1;
+    int numa_node_ = 0;
+    // CPUs of the decoder's NUMA node (empty if the pool isn't NUMA-aware),
+    // for the threads decoding segments on it as a helper
+    std::vector<int> cpus_;
 };
 
 
@@ -126,6 +260,9 @@ class DecoderFactory final {
         return new Decoder(model_.get());
     }
 
+    // memory held by the model shared by the decoders
+    const ModelMemory &model_memory() const noexcept;
+
     // friendly alias for the producer method
     inline Decoder *operator()() const {
         return produce();
@@ -138,10 +275,23 @@ class DecoderFactory final {
 
 // Decoder Queue for providing thread safety to multiple request handler
 // threads producing and consuming decoder instances on demand.
+// The pool is elastic: it starts with `min_decoders`, grows up to `max_decoders`
+// when requests have to wait and reaps decoders left idle for too long.
+// Idle decoders are kept in per-core shards so that uncontended acquire/release
+// only touch a core-local lock (with `numa_aware`, shards are grouped per NUMA
+// node, each node producing decoders off its own model replica and handing out
+// its own decoders first); threads fall back to waiting in a shared list
+// only when no decoder is available, from which released decoders are handed
+// to the next waiter by policy:
+//  - high priority requests first, low priority ones can't take the last
+//    `reserved_decoders` of the pool unless waiting longer than `priority_aging`
+//  - then the tenant with the least decoders in use relative to its weight
+//    (tenants at their concurrency cap are skipped)
+//  - then in order of arrival
 class DecoderQueue final {
 
   public:
-    explicit DecoderQueue(const ModelSpec &);
+    explicit DecoderQueue(const ModelSpec &, const std::vector<TenantSpec> &tenant_specs = {});
 
     DecoderQueue(const DecoderQueue &) = delete; // disable copying
 
@@ -151,40 +301,228 @@ class DecoderQueue final {
 
     // friendly alias for `pop`
     inline Decoder *acquire() {
-        return pop_();
+        return pop_(AcquireOptions());
     }
 
+    // acquires a decoder waiting no longer than the given deadline, returns
+    // nullptr if the deadline expires or `is_cancelled` reports that the
+    // caller has gone away while waiting
+    inline Decoder *acquire(const std::chrono::system_clock::time_point &deadline,
+                            const std::function<bool()> &is_cancelled = nullptr) {
+        AcquireOptions options;
+        options.deadline = deadline;
+        options.is_cancelled = is_cancelled;
+        return pop_(options);
+    }
+
+    // acquires a decoder honouring the deadline, cancellation, priority and tenant in `options`
+    inline Decoder *acquire(const AcquireOptions &options) {
+        return pop_(options);
+    }
+
+    // takes a decoder only if one is free right away and nobody is waiting
+    // for one, returns nullptr otherwise without ever queueing (so it doesn't
+    // count as a wait, timeout or cancellation of the tenant)
+    Decoder *try_acquire(const RequestPriority &priority = RequestPriority::HIGH, const std::string &tenant = "");
+
+    // acquires a decoder without blocking the caller: `on_acquired` gets the
+    // decoder (or nullptr on deadline expiry/cancellation) either right away
+    // or later from a thread releasing a decoder, with the queue locked, so
+    // it must return quickly and not call back into the queue
+    void acquire_async(const AcquireOptions &options, std::function<void(Decoder *)> on_acquired);
+
     // friendly alias for `push`
     inline void release(Decoder *const decoder) {
         return push_(decoder);
     }
 
+    // no. of decoders currently alive (idle + in use)
+    std::size_t size();
+
+    // no. of decoders sitting idle in the queue
+    std::size_t idle();
+
+    // no. of requests waiting for a decoder
+    inline std::size_t waiting() const {
+        return n_waiters_.load();
+    }
+
+    // max no. of decoders the pool can grow to
+    inline std::size_t capacity() const noexcept {
+        return max_decoders_;
+    }
+
+    // usage counters of the configured tenants
+    void tenant_stats(std::vector<TenantStats> &stats);
+
+    // memory held by the model (summed over its NUMA replicas)
+    ModelMemory model_memory() const;
+
+    // CPUs of the NUMA node a decoder belongs to, to run its requests on
+    // (empty if the pool isn't NUMA-aware)
+    inline const std::vector<int> &affinity(const Decoder *const decoder) const {
+        return nodes_[decoder->numa_node_].cpus;
+    }
+
   private:
     // Push method that supports multi-threaded thread-safe concurrency
     // pushes a decoder object onto the queue
     void push_(Decoder *const);
 
     // Pop method that supports multi-threaded thread-safe concurrency
-    // pops a decoder object from the queue
-    Decoder *pop_();
-
-    // underlying STL "unsafe" queue for storing decoder objects
-    std::queue<Decoder*> queue_;
-    // custom mutex to make queue "thread-safe"
+    // pops a decoder object from the queue (or gives up at the deadline/on cancellation)
+    Decoder *pop_(const AcquireOptions &options);
+
+    // Housekeeping loop that deletes decoders idle for longer than the idle
+    // timeout while there are more than `min_decoders_` alive, and expires
+    // (and ages) the async waiters which have no thread of their own to do so
+    void reap_();
+
+    // hands nullptr to async waiters past their deadline or cancelled (`mutex_` held)
+    void expire_async_waiters_();
+
+    // non-blocking pop from the shards, starting at the caller's home shard
+    // and going through the shards of the caller's NUMA node first
+    Decoder *try_pop_();
+
+    // produces a new decoder off the node's model replica
+    Decoder *produce_(const int &node);
+
+    // reserves a slot for a new decoder if the pool is below `max_decoders_`
+    bool try_grow_();
+
+    // NUMA node of a CPU (0 if unknown)
+    int cpu_node_(const int &cpu) const;
+
+    // reserves a decoder for a low priority request if within the cap
+    bool try_reserve_low_();
+
+    // reserves a decoder for the tenant if below its concurrency cap
+    bool try_reserve_tenant_(const int &tenant);
+
+    // takes an idle (or new) decoder for a request of the given class and
+    // tenant if the reservation and the tenant cap allow for it
+    Decoder *take_(const RequestPriority &priority, const int &tenant);
+
+    struct Waiter;
+
+    // hands idle decoders to the waiters picked by policy (`mutex_` held)
+    void dispatch_();
+
+    // best waiter eligible for a decoder right now (`mutex_` held)
+    Waiter *select_waiter_(const std::chrono::system_clock::time_point &now);
+
+    // tenant index for a tenant key (-1 if fair-sharing is disabled)
+    int tenant_index_(const std::string &tenant) const;
+
+    using idle_decoder_t = std::pair<Decoder*, std::chrono::steady_clock::time_point>;
+
+    // per-core shard holding idle decoder objects along with the time they were
+    // released (used as a stack to keep recently used decoders hot)
+    struct Shard {
+        std::mutex mutex;
+        std::deque<idle_decoder_t> decoders;
+    };
+
+    // a thread blocked in `pop_` until a decoder gets handed to it, or
+    // an `acquire_async` call waiting for its callback
+    struct Waiter {
+        RequestPriority priority;
+        int tenant;
+        std::chrono::system_clock::time_point promote_time;
+        const std::function<bool()> *is_cancelled;
+        Decoder *granted = nullptr;
+        std::condition_variable cond;
+
+        // async waiters only
+        std::chrono::system_clock::time_point deadline;
+        std::function<bool()> is_cancelled_fn;
+        std::function<void(Decoder *)> on_acquired;
+    };
+
+    // fair-share state and counters of a tenant
+    struct Tenant {
+        std::string name;
+        double weight;
+        std::size_t max_concurrency;
+        std::atomic<std::size_t> in_flight{0};
+        std::atomic<std::size_t> waiting{0};
+        std::atomic<std::size_t> acquired{0};
+        std::atomic<std::size_t> timed_out{0};
+        std::atomic<std::size_t> cancelled{0};
+    };
+
+    // NUMA node with its own model replica and the shards of its decoders
+    // (a single node with no CPUs to pin to if the pool isn't NUMA-aware)
+    struct Node {
+        std::vector<int> cpus;
+        std::unique_ptr<DecoderFactory> decoder_factory;
+        std::vector<std::size_t> shards;
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::vector<Node> nodes_;
+    std::vector<int> cpu_nodes_;
+
+    // mutex guarding the waiters list for the blocking fallback
     std::mutex mutex_;
-    // helper for holding mutex and notification on waiting threads when concerned resources are available
-    std::condition_variable cond_;
-    // factory for producing new decoders on demand
-    std::unique_ptr<DecoderFactory> decoder_factory_;
+    // waiting threads in order of arrival
+    std::list<Waiter*> waiters_;
+    // no. of waiters (lets `push_` skip the shared lock)
+    std::atomic<std::size_t> n_waiters_{0};
+    // no. of async waiters among them (guarded by `mutex_`)
+    std::size_t n_async_waiters_ = 0;
+
+    // elastic pool bounds and no. of decoders alive
+    std::size_t min_decoders_;
+    std::size_t max_decoders_;
+    std::atomic<std::size_t> n_decoders_{0};
+    std::chrono::milliseconds idle_timeout_;
+
+    // no. of decoders held by low priority requests and the cap on it
+    std::atomic<std::size_t> n_low_busy_{0};
+    std::size_t max_low_busy_;
+    std::chrono::milliseconds priority_aging_;
+
+    // tenants (fixed after construction, so lookups need no locking);
+    // keys not configured fall into the "default" tenant
+    std::vector<std::unique_ptr<Tenant>> tenants_;
+    std::unordered_map<std::string, int> tenant_ids_;
+    int default_tenant_ = -1;
+
+    bool stopped_ = false;
+    std::condition_variable reaper_cond_;
+    std::thread reaper_;
 };
 
 
+// Splits an audio into segments of at most `max_segment_secs` (as sample
+// ranges), cutting each one at the quietest stretch of its second half.
+void split_at_silences(const kaldi::VectorBase<kaldi::BaseFloat> &data,
+                       const kaldi::BaseFloat &samp_freq,
+                       const float &max_segment_secs,
+                       std::vector<std::pair<int32, int32>> &segments);
+
+// Stitches the results of consecutive segments of an audio: the first
+// alternative joins the best of every segment, the next ones swap in one
+// segment's alternative at a time, ordered by the cost it adds (so they are
+// the n-best differing from the best in a single segment, not an exact
+// n-best of the whole audio). Scores add up and confidences are averaged
+// weighing them by the segments' durations. Like unsegmented results, only
+// the first alternative has word timings.
+void stitch_segment_results(const std::vector<utterance_results_t> &segment_results,
+                            const std::vector<double> &segment_secs,
+                            utterance_results_t &results);
+
+
 void find_alternatives(kaldi::CompactLattice &clat,
                        const std::size_t &n_best,
                        utterance_results_t &results,
                        const bool &word_level,
                        ChainModel *const model,
-                       const DecoderOptions &options);
+                       const DecoderOptions &options,
+                       DecodingStats *const stats=nullptr,
+                       std::vector<Span> *const spans=nullptr);
 
 
 // Find confidence by merging lm and am scores. Taken from
@@ -10,12 +10,14 @@
 #include "rnnlm/rnnlm-lattice-rescoring.h"
 #include "fstext/fstext-lib.h"
 #include "nnet3/nnet-utils.h"
+#include "online2/online-endpoint.h"
 #include "online2/online-nnet2-feature-pipeline.h"
 #include "online2/online-nnet3-decoding.h"
 #include "online2/onlinebin-util.h"
 #include "util/kaldi-thread.h"
 
 // local includes
+#include "batch.hpp"
 #include "config.hpp"
 #include "types.hpp"
 #include "decoder.hpp"
@@ -53,6 +55,9 @@ class ChainModel final {
     kaldi::LatticeFasterDecoderConfig lattice_faster_decoder_config;
     kaldi::nnet3::NnetSimpleLoopedComputationOptions decodable_opts;
 
+    // Endpointing rules (for segmenting continuous streams)
+    kaldi::OnlineEndpointConfig endpoint_config;
+
     // Word Boundary info (for word level timings)
     std::unique_ptr<kaldi::WordBoundaryInfo> wb_info;
 
@@ -71,6 +76,12 @@ class ChainModel final {
     kaldi::rnnlm::RnnlmComputeStateComputationOptions rnnlm_opts;
     // LM composition options
     kaldi::ComposeLatticePrunedOptions compose_opts;
+
+    // Batched NNet3 inference scheduler shared by the decoders (optional)
+    std::unique_ptr<NnetBatchScheduler> batch_scheduler;
+
+    // Memory held by the components above (set once loaded)
+    ModelMemory memory;
 };
 
 } // namespace kaldiserve
\ No newline at end of file
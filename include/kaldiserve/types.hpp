@@ -2,6 +2,8 @@
 #pragma once
 
 // stl includes
+#include <chrono>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -20,6 +22,27 @@ struct ModelSpec {
     std::string path;
     int n_decoders = 1;
 
+    // elastic decoder pool bounds (default to a fixed pool of `n_decoders`)
+    int min_decoders = -1;
+    int max_decoders = -1;
+    // seconds after which idle decoders above `min_decoders` are reaped
+    float decoder_idle_timeout = 60.0;
+
+    // decoders only high priority requests may take
+    int reserved_decoders = 0;
+    // seconds after which a waiting low priority request is treated as high priority (0 disables)
+    float priority_aging = 5.0;
+
+    // split the pool per NUMA node with a model replica on each node
+    bool numa_aware = false;
+
+    // admission control (0 or less disables a bound): max requests waiting for a decoder,
+    // max expected wait (secs), max recent real-time factor and max host cpu utilization (0-1)
+    int admission_max_waiting = 0;
+    float admission_max_wait = 0.0;
+    float admission_max_rtf = 0.0;
+    float admission_max_cpu = 0.0;
+
     // decoding parameters
     int min_active = 200;
     int max_active = 7000;
@@ -28,12 +51,23 @@ struct ModelSpec {
     float lattice_beam = 6.0;
     float acoustic_scale = 1.0;
     float silence_weight = 1.0;
+    // colon separated silence phone ids (for silence weighting and endpointing)
+    std::string silence_phones = "";
+    // max seconds of a segment of a continuous stream before it gets endpointed
+    // (and of the segments a long audio gets split into for parallel decoding)
+    float max_segment_length = 20.0;
     
     // rnnlm config
     int max_ngram_order = 3;
     float rnnlm_weight = 0.5;
     std::string bos_index = "1";
     std::string eos_index = "2";
+
+    // batched nnet3 inference across decoders
+    bool batch_inference = false;
+    int batch_size = 32;
+    int batch_frames_per_chunk = 51;
+    int batch_max_delay_ms = 5;
 };
 
 struct Word {
@@ -56,10 +90,129 @@ struct DecoderOptions {
     bool enable_rnnlm;
 };
 
+// Severity of a log message
+enum class LogLevel { DEBUG = 0, INFO = 1, WARN = 2, ERROR = 3 };
+
+// Priority class of a decoder request
+// (high priority requests are served first and may use reserved decoders)
+enum class RequestPriority { LOW = 0, HIGH = 1 };
+
+// Options for acquiring a decoder from a `DecoderQueue`
+struct AcquireOptions {
+    // give up waiting at this point in time
+    std::chrono::system_clock::time_point deadline = std::chrono::system_clock::time_point::max();
+    // tells if the caller has gone away (checked while waiting)
+    std::function<bool()> is_cancelled = nullptr;
+    RequestPriority priority = RequestPriority::HIGH;
+    // tenant key for fair-share scheduling across clients
+    std::string tenant = "";
+};
+
+// Tenant specification for fair-share decoder scheduling
+struct TenantSpec {
+    std::string name;
+    // share of contended decoders relative to other tenants
+    float weight = 1.0;
+    // max decoders held at once per model (0 = unlimited)
+    int max_concurrency = 0;
+};
+
+// Decoder usage counters of a tenant (for a model)
+struct TenantStats {
+    std::string name;
+    std::size_t in_flight;
+    std::size_t waiting;
+    std::size_t acquired;
+    std::size_t timed_out;
+    std::size_t cancelled;
+};
+
+// Time spent in each stage of decoding an utterance (in secs)
+struct DecodingStats {
+    // audio fed into the decoder
+    double audio_secs = 0;
+    // feature extraction and search as the audio comes in
+    double decode_secs = 0;
+    // finalizing the search at the end of the audio
+    double finalize_secs = 0;
+    // getting the determinized lattice
+    double lattice_secs = 0;
+    // rescoring the lattice with the rnnlm
+    double rescore_secs = 0;
+    // extracting the n-best alternatives (and word level details)
+    double nbest_secs = 0;
+
+    // cpu time of the threads handling the utterance, across all its chunks and
+    // stages (wav parsing included; nnet3 evaluation of batched inference runs
+    // on the batch scheduler's thread and isn't accounted for)
+    double cpu_secs = 0;
+
+    // total compute time for the utterance
+    inline double compute_secs() const noexcept {
+        return decode_secs + finalize_secs + lattice_secs + rescore_secs + nbest_secs;
+    }
+
+    // adds up the stats of parts of an utterance decoded apart
+    inline DecodingStats &operator+=(const DecodingStats &other) noexcept {
+        audio_secs += other.audio_secs;
+        decode_secs += other.decode_secs;
+        finalize_secs += other.finalize_secs;
+        lattice_secs += other.lattice_secs;
+        rescore_secs += other.rescore_secs;
+        nbest_secs += other.nbest_secs;
+        cpu_secs += other.cpu_secs;
+        return *this;
+    }
+};
+
+// Memory held by the components of a loaded model (in bytes, estimated
+// from the sizes of their data structures)
+struct ModelMemory {
+    // HCLG.fst graph
+    std::size_t hclg_bytes = 0;
+    // nnet3 acoustic model parameters
+    std::size_t am_nnet_bytes = 0;
+    // i-vector extractor and its diagonal UBM
+    std::size_t ivector_extractor_bytes = 0;
+    // rnnlm parameters, its word embedding matrix and the G.fst subtracted when rescoring
+    std::size_t rnnlm_bytes = 0;
+    std::size_t word_embedding_bytes = 0;
+    std::size_t lm_fst_bytes = 0;
+    // word symbol table
+    std::size_t word_syms_bytes = 0;
+
+    inline std::size_t total_bytes() const noexcept {
+        return hclg_bytes + am_nnet_bytes + ivector_extractor_bytes + rnnlm_bytes +
+               word_embedding_bytes + lm_fst_bytes + word_syms_bytes;
+    }
+};
+
+// Memory held by the per-utterance state of a decoder (in bytes, estimated)
+struct DecoderMemory {
+    // features (and i-vectors) computed for the audio so far
+    std::size_t feature_bytes = 0;
+    // determinized lattice of the last results taken off the decoder
+    std::size_t lattice_bytes = 0;
+
+    inline std::size_t total_bytes() const noexcept {
+        return feature_bytes + lattice_bytes;
+    }
+};
+
+// A timed stage of handling a request (for per-request tracing)
+struct Span {
+    std::string name;
+    std::chrono::system_clock::time_point start_time;
+    std::chrono::system_clock::time_point end_time;
+};
+
 // Result for one continuous utterance
 using utterance_results_t = std::vector<Alternative>;
 
 // a pair of model_name and language_code
 using model_id_t = std::pair<std::string, std::string>;
 
+// runs a task asynchronously (e.g. on a worker pool)
+using task_executor_t = std::function<void(std::function<void()>)>;
+
 } // namespace kaldiserve
\ No newline at end of file
@@ -2,8 +2,11 @@
 #pragma once
 
 // stl includes
+#include <chrono>
 #include <string>
 #include <vector>
+#include <sched.h>
+#include <time.h>
 
 // local includes
 #include "config.hpp"
@@ -22,6 +25,92 @@ bool exists(std::string path);
 // Fills a list of model specifications from the config
 void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &model_specs);
 
+// Fills a list of tenant specifications (for fair-share scheduling) from the config
+void parse_tenant_specs(const std::string &toml_path, std::vector<TenantSpec> &tenant_specs);
+
+// Lists the CPUs of each NUMA node (from sysfs), empty if the topology is unknown
+void numa_node_cpus(std::vector<std::vector<int>> &node_cpus);
+
+// Pins the calling thread to the given CPUs for the lifetime of the object
+// and restores its previous affinity afterwards (no-op for no CPUs)
+class ScopedThreadAffinity final {
+
+  public:
+    explicit ScopedThreadAffinity(const std::vector<int> &cpus) noexcept;
+
+    ScopedThreadAffinity(const ScopedThreadAffinity &) = delete; // disable copying
+
+    ScopedThreadAffinity &operator=(const ScopedThreadAffinity &) = delete; // disable assignment
+
+    ~ScopedThreadAffinity() noexcept;
+
+  private:
+    bool pinned_ = false;
+    cpu_set_t previous_;
+};
+
+// Records its own lifetime as a span named `name` into `spans`
+// (no-op for no span list, i.e. when tracing is disabled)
+class ScopedSpan final {
+
+  public:
+    ScopedSpan(std::vector<Span> *const spans, const char *const name) noexcept;
+
+    ScopedSpan(const ScopedSpan &) = delete; // disable copying
+
+    ScopedSpan &operator=(const ScopedSpan &) = delete; // disable assignment
+
+    ~ScopedSpan() noexcept;
+
+  private:
+    std::vector<Span> *spans_;
+    const char *name_;
+    std::chrono::system_clock::time_point start_time_;
+};
+
+// Seconds elapsed since the given time point
+inline double elapsed_secs(const std::chrono::steady_clock::time_point &start) noexcept {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// CPU time consumed by the calling thread so far (in secs)
+inline double thread_cpu_secs() noexcept {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return 0;
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Adds the CPU time the calling thread spends during its lifetime to `total`
+class ScopedCpuTimer final {
+
+  public:
+    explicit ScopedCpuTimer(double *const total) noexcept
+        : total_(total), start_(thread_cpu_secs()) {}
+
+    ScopedCpuTimer(const ScopedCpuTimer &) = delete; // disable copying
+
+    ScopedCpuTimer &operator=(const ScopedCpuTimer &) = delete; // disable assignment
+
+    ~ScopedCpuTimer() noexcept {
+        *total_ += thread_cpu_secs() - start_;
+    }
+
+  private:
+    double *total_;
+    double start_;
+};
+
+// Sets the least severe level of messages that get logged (INFO by default)
+void set_log_level(const LogLevel &level) noexcept;
+
+// Logs a printf-style message without blocking the caller: the message is
+// formatted into a slot of a lock-free ring buffer and written to stdout,
+// timestamped, by a background thread (dropped if the buffer is full)
+void log_debug(const char *const format, ...) noexcept __attribute__((format(printf, 1, 2)));
+void log_info(const char *const format, ...) noexcept __attribute__((format(printf, 1, 2)));
+void log_warn(const char *const format, ...) noexcept __attribute__((format(printf, 1, 2)));
+void log_error(const char *const format, ...) noexcept __attribute__((format(printf, 1, 2)));
+
 // Joins vector of strings together using a separator token
 void string_join(const std::vector<std::string> &strings, std::string separator, std::string &output);
 
@@ -1,7 +1,7 @@
 from google.protobuf.empty_pb2 import Empty
 import grpc
 
-from kaldi_serve.kaldi_serve_pb2 import RecognitionConfig, RecognizeRequest
+from kaldi_serve.kaldi_serve_pb2 import BatchRecognizeRequest, RecognitionConfig, RecognizeRequest
 from kaldi_serve.kaldi_serve_pb2_grpc import KaldiServeStub
 from kaldi_serve.kaldi_serve_pb2_grpc import google_dot_protobuf_dot_empty__pb2 as proto_empty
 
@@ -20,10 +20,17 @@ class KaldiServeClient(object):
     def list_models(self, timeout=None):
         return self._client.ListModels(proto_empty.Empty(), timeout=timeout)
 
+    def get_server_stats(self, timeout=None):
+        return self._client.GetServerStats(proto_empty.Empty(), timeout=timeout)
+
     def recognize(self, config: RecognitionConfig, audio, uuid: str, timeout=None):
         request = RecognizeRequest(config=config, audio=audio, uuid=uuid)
         return self._client.Recognize(request, timeout=timeout)
 
+    def batch_recognize(self, config: RecognitionConfig, audios, uuid: str, max_parallel: int = 0, timeout=None):
+        request = BatchRecognizeRequest(config=config, audios=audios, uuid=uuid, max_parallel=max_parallel)
+        return self._client.BatchRecognize(request, timeout=timeout)
+
     def streaming_recognize(self, config: RecognitionConfig, audio_chunks_gen, uuid: str, timeout=None):
         request_gen = (RecognizeRequest(config=config, audio=chunk, uuid=uuid) for chunk in audio_chunks_gen)
         return self._client.StreamingRecognize(request_gen, timeout=timeout)
@@ -1,12 +1,10 @@
 # -*- coding: utf-8 -*-
 # Generated by the protocol buffer compiler.  DO NOT EDIT!
 # source: kaldi_serve.proto
-
-import sys
-_b=sys.version_info[0]<3 and (lambda x:x) or (lambda x:x.encode('latin1'))
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
 from google.protobuf import descriptor as _descriptor
-from google.protobuf import message as _message
-from google.protobuf import reflection as _reflection
+from google.protobuf import descriptor_pool as _descriptor_pool
 from google.protobuf import symbol_database as _symbol_database
 # @@protoc_insertion_point(imports)
 
@@ -16,658 +14,49 @@ _sym_db = _symbol_database.Default()
 from google.protobuf import empty_pb2 as google_dot_protobuf_dot_empty__pb2
 
 
-DESCRIPTOR = _descriptor.FileDescriptor(
-  name='kaldi_serve.proto',
-  package='kaldi_serve',
-  syntax='proto3',
-  serialized_options=None,
-  serialized_pb=_b('\n\x11kaldi_serve.proto\x12\x0bkaldi_serve\x1a\x1bgoogle/protobuf/empty.proto\"/\n\tModelList\x12\"\n\x06models\x18\x01 \x03(\x0b\x32\x12.kaldi_serve.Model\",\n\x05Model\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x15\n\rlanguage_code\x18\x02 \x01(\t\"~\n\x10RecognizeRequest\x12.\n\x06\x63onfig\x18\x01 \x01(\x0b\x32\x1e.kaldi_serve.RecognitionConfig\x12,\n\x05\x61udio\x18\x02 \x01(\x0b\x32\x1d.kaldi_serve.RecognitionAudio\x12\x0c\n\x04uuid\x18\x03 \x01(\t\"J\n\x11RecognizeResponse\x12\x35\n\x07results\x18\x01 \x03(\x0b\x32$.kaldi_serve.SpeechRecognitionResult\"\x8d\x03\n\x11RecognitionConfig\x12>\n\x08\x65ncoding\x18\x01 \x01(\x0e\x32,.kaldi_serve.RecognitionConfig.AudioEncoding\x12\x19\n\x11sample_rate_hertz\x18\x02 \x01(\x05\x12\x15\n\rlanguage_code\x18\x03 \x01(\t\x12\x18\n\x10max_alternatives\x18\x04 \x01(\x05\x12\x13\n\x0bpunctuation\x18\x05 \x01(\x08\x12\x33\n\x0fspeech_contexts\x18\x06 \x03(\x0b\x32\x1a.kaldi_serve.SpeechContext\x12\x1b\n\x13\x61udio_channel_count\x18\x07 \x01(\x05\x12\r\n\x05model\x18\n \x01(\t\x12\x0b\n\x03raw\x18\x0b \x01(\x08\x12\x12\n\ndata_bytes\x18\x0c \x01(\x05\x12\x12\n\nword_level\x18\r \x01(\x08\"A\n\rAudioEncoding\x12\x18\n\x14\x45NCODING_UNSPECIFIED\x10\x00\x12\x0c\n\x08LINEAR16\x10\x01\x12\x08\n\x04\x46LAC\x10\x02\"D\n\x10RecognitionAudio\x12\x11\n\x07\x63ontent\x18\x01 \x01(\x0cH\x00\x12\r\n\x03uri\x18\x02 \x01(\tH\x00\x42\x0e\n\x0c\x61udio_source\"Z\n\x17SpeechRecognitionResult\x12?\n\x0c\x61lternatives\x18\x01 \x03(\x0b\x32).kaldi_serve.SpeechRecognitionAlternative\"\x8c\x01\n\x1cSpeechRecognitionAlternative\x12\x12\n\ntranscript\x18\x01 \x01(\t\x12\x12\n\nconfidence\x18\x02 \x01(\x02\x12\x10\n\x08\x61m_score\x18\x03 \x01(\x02\x12\x10\n\x08lm_score\x18\x04 \x01(\x02\x12 \n\x05words\x18\x05 \x03(\x0b\x32\x11.kaldi_serve.Word\"N\n\x04Word\x12\x12\n\nstart_time\x18\x01 \x01(\x02\x12\x10\n\x08\x65nd_time\x18\x02 \x01(\x02\x12\x0c\n\x04word\x18\x03 \x01(\t\x12\x12\n\nconfidence\x18\x04 \x01(\x02\".\n\rSpeechContext\x12\x0f\n\x07phrases\x18\x01 \x03(\t\x12\x0c\n\x04type\x18\x02 \x01(\t2\xd2\x02\n\nKaldiServe\x12>\n\nListModels\x12\x16.google.protobuf.Empty\x1a\x16.kaldi_serve.ModelList\"\x00\x12L\n\tRecognize\x12\x1d.kaldi_serve.RecognizeRequest\x1a\x1e.kaldi_serve.RecognizeResponse\"\x00\x12W\n\x12StreamingRecognize\x12\x1d.kaldi_serve.RecognizeRequest\x1a\x1e.kaldi_serve.RecognizeResponse\"\x00(\x01\x12]\n\x16\x42idiStreamingRecognize\x12\x1d.kaldi_serve.RecognizeRequest\x1a\x1e.kaldi_serve.RecognizeResponse\"\x00(\x01\x30\x01\x62\x06proto3')
-  ,
-  dependencies=[google_dot_protobuf_dot_empty__pb2.DESCRIPTOR,])
-
-
-
-_RECOGNITIONCONFIG_AUDIOENCODING = _descriptor.EnumDescriptor(
-  name='AudioEncoding',
-  full_name='kaldi_serve.RecognitionConfig.AudioEncoding',
-  filename=None,
-  file=DESCRIPTOR,
-  values=[
-    _descriptor.EnumValueDescriptor(
-      name='ENCODING_UNSPECIFIED', index=0, number=0,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='LINEAR16', index=1, number=1,
-      serialized_options=None,
-      type=None),
-    _descriptor.EnumValueDescriptor(
-      name='FLAC', index=2, number=2,
-      serialized_options=None,
-      type=None),
-  ],
-  containing_type=None,
-  serialized_options=None,
-  serialized_start=695,
-  serialized_end=760,
-)
-_sym_db.RegisterEnumDescriptor(_RECOGNITIONCONFIG_AUDIOENCODING)
-
-
-_MODELLIST = _descriptor.Descriptor(
-  name='ModelList',
-  full_name='kaldi_serve.ModelList',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='models', full_name='kaldi_serve.ModelList.models', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=63,
-  serialized_end=110,
-)
-
-
-_MODEL = _descriptor.Descriptor(
-  name='Model',
-  full_name='kaldi_serve.Model',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='name', full_name='kaldi_serve.Model.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='language_code', full_name='kaldi_serve.Model.language_code', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=112,
-  serialized_end=156,
-)
-
-
-_RECOGNIZEREQUEST = _descriptor.Descriptor(
-  name='RecognizeRequest',
-  full_name='kaldi_serve.RecognizeRequest',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='config', full_name='kaldi_serve.RecognizeRequest.config', index=0,
-      number=1, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='audio', full_name='kaldi_serve.RecognizeRequest.audio', index=1,
-      number=2, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='uuid', full_name='kaldi_serve.RecognizeRequest.uuid', index=2,
-      number=3, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=158,
-  serialized_end=284,
-)
-
-
-_RECOGNIZERESPONSE = _descriptor.Descriptor(
-  name='RecognizeResponse',
-  full_name='kaldi_serve.RecognizeResponse',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='results', full_name='kaldi_serve.RecognizeResponse.results', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=286,
-  serialized_end=360,
-)
-
-
-_RECOGNITIONCONFIG = _descriptor.Descriptor(
-  name='RecognitionConfig',
-  full_name='kaldi_serve.RecognitionConfig',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='encoding', full_name='kaldi_serve.RecognitionConfig.encoding', index=0,
-      number=1, type=14, cpp_type=8, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='sample_rate_hertz', full_name='kaldi_serve.RecognitionConfig.sample_rate_hertz', index=1,
-      number=2, type=5, cpp_type=1, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='language_code', full_name='kaldi_serve.RecognitionConfig.language_code', index=2,
-      number=3, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='max_alternatives', full_name='kaldi_serve.RecognitionConfig.max_alternatives', index=3,
-      number=4, type=5, cpp_type=1, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='punctuation', full_name='kaldi_serve.RecognitionConfig.punctuation', index=4,
-      number=5, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='speech_contexts', full_name='kaldi_serve.RecognitionConfig.speech_contexts', index=5,
-      number=6, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='audio_channel_count', full_name='kaldi_serve.RecognitionConfig.audio_channel_count', index=6,
-      number=7, type=5, cpp_type=1, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='model', full_name='kaldi_serve.RecognitionConfig.model', index=7,
-      number=10, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='raw', full_name='kaldi_serve.RecognitionConfig.raw', index=8,
-      number=11, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='data_bytes', full_name='kaldi_serve.RecognitionConfig.data_bytes', index=9,
-      number=12, type=5, cpp_type=1, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='word_level', full_name='kaldi_serve.RecognitionConfig.word_level', index=10,
-      number=13, type=8, cpp_type=7, label=1,
-      has_default_value=False, default_value=False,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-    _RECOGNITIONCONFIG_AUDIOENCODING,
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=363,
-  serialized_end=760,
-)
-
-
-_RECOGNITIONAUDIO = _descriptor.Descriptor(
-  name='RecognitionAudio',
-  full_name='kaldi_serve.RecognitionAudio',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='content', full_name='kaldi_serve.RecognitionAudio.content', index=0,
-      number=1, type=12, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b(""),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='uri', full_name='kaldi_serve.RecognitionAudio.uri', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-    _descriptor.OneofDescriptor(
-      name='audio_source', full_name='kaldi_serve.RecognitionAudio.audio_source',
-      index=0, containing_type=None, fields=[]),
-  ],
-  serialized_start=762,
-  serialized_end=830,
-)
-
-
-_SPEECHRECOGNITIONRESULT = _descriptor.Descriptor(
-  name='SpeechRecognitionResult',
-  full_name='kaldi_serve.SpeechRecognitionResult',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='alternatives', full_name='kaldi_serve.SpeechRecognitionResult.alternatives', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=832,
-  serialized_end=922,
-)
-
-
-_SPEECHRECOGNITIONALTERNATIVE = _descriptor.Descriptor(
-  name='SpeechRecognitionAlternative',
-  full_name='kaldi_serve.SpeechRecognitionAlternative',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='transcript', full_name='kaldi_serve.SpeechRecognitionAlternative.transcript', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='confidence', full_name='kaldi_serve.SpeechRecognitionAlternative.confidence', index=1,
-      number=2, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='am_score', full_name='kaldi_serve.SpeechRecognitionAlternative.am_score', index=2,
-      number=3, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='lm_score', full_name='kaldi_serve.SpeechRecognitionAlternative.lm_score', index=3,
-      number=4, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='words', full_name='kaldi_serve.SpeechRecognitionAlternative.words', index=4,
-      number=5, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=925,
-  serialized_end=1065,
-)
-
-
-_WORD = _descriptor.Descriptor(
-  name='Word',
-  full_name='kaldi_serve.Word',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='start_time', full_name='kaldi_serve.Word.start_time', index=0,
-      number=1, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='end_time', full_name='kaldi_serve.Word.end_time', index=1,
-      number=2, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='word', full_name='kaldi_serve.Word.word', index=2,
-      number=3, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='confidence', full_name='kaldi_serve.Word.confidence', index=3,
-      number=4, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=float(0),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1067,
-  serialized_end=1145,
-)
-
-
-_SPEECHCONTEXT = _descriptor.Descriptor(
-  name='SpeechContext',
-  full_name='kaldi_serve.SpeechContext',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    _descriptor.FieldDescriptor(
-      name='phrases', full_name='kaldi_serve.SpeechContext.phrases', index=0,
-      number=1, type=9, cpp_type=9, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-    _descriptor.FieldDescriptor(
-      name='type', full_name='kaldi_serve.SpeechContext.type', index=1,
-      number=2, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=_b("").decode('utf-8'),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      serialized_options=None, file=DESCRIPTOR),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  serialized_options=None,
-  is_extendable=False,
-  syntax='proto3',
-  extension_ranges=[],
-  oneofs=[
-  ],
-  serialized_start=1147,
-  serialized_end=1193,
-)
-
-_MODELLIST.fields_by_name['models'].message_type = _MODEL
-_RECOGNIZEREQUEST.fields_by_name['config'].message_type = _RECOGNITIONCONFIG
-_RECOGNIZEREQUEST.fields_by_name['audio'].message_type = _RECOGNITIONAUDIO
-_RECOGNIZERESPONSE.fields_by_name['results'].message_type = _SPEECHRECOGNITIONRESULT
-_RECOGNITIONCONFIG.fields_by_name['encoding'].enum_type = _RECOGNITIONCONFIG_AUDIOENCODING
-_RECOGNITIONCONFIG.fields_by_name['speech_contexts'].message_type = _SPEECHCONTEXT
-_RECOGNITIONCONFIG_AUDIOENCODING.containing_type = _RECOGNITIONCONFIG
-_RECOGNITIONAUDIO.oneofs_by_name['audio_source'].fields.append(
-  _RECOGNITIONAUDIO.fields_by_name['content'])
-_RECOGNITIONAUDIO.fields_by_name['content'].containing_oneof = _RECOGNITIONAUDIO.oneofs_by_name['audio_source']
-_RECOGNITIONAUDIO.oneofs_by_name['audio_source'].fields.append(
-  _RECOGNITIONAUDIO.fields_by_name['uri'])
-_RECOGNITIONAUDIO.fields_by_name['uri'].containing_oneof = _RECOGNITIONAUDIO.oneofs_by_name['audio_source']
-_SPEECHRECOGNITIONRESULT.fields_by_name['alternatives'].message_type = _SPEECHRECOGNITIONALTERNATIVE
-_SPEECHRECOGNITIONALTERNATIVE.fields_by_name['words'].message_type = _WORD
-DESCRIPTOR.message_types_by_name['ModelList'] = _MODELLIST
-DESCRIPTOR.message_types_by_name['Model'] = _MODEL
-DESCRIPTOR.message_types_by_name['RecognizeRequest'] = _RECOGNIZEREQUEST
-DESCRIPTOR.message_types_by_name['RecognizeResponse'] = _RECOGNIZERESPONSE
-DESCRIPTOR.message_types_by_name['RecognitionConfig'] = _RECOGNITIONCONFIG
-DESCRIPTOR.message_types_by_name['RecognitionAudio'] = _RECOGNITIONAUDIO
-DESCRIPTOR.message_types_by_name['SpeechRecognitionResult'] = _SPEECHRECOGNITIONRESULT
-DESCRIPTOR.message_types_by_name['SpeechRecognitionAlternative'] = _SPEECHRECOGNITIONALTERNATIVE
-DESCRIPTOR.message_types_by_name['Word'] = _WORD
-DESCRIPTOR.message_types_by_name['SpeechContext'] = _SPEECHCONTEXT
-_sym_db.RegisterFileDescriptor(DESCRIPTOR)
-
-ModelList = _reflection.GeneratedProtocolMessageType('ModelList', (_message.Message,), {
-  'DESCRIPTOR' : _MODELLIST,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.ModelList)
-  })
-_sym_db.RegisterMessage(ModelList)
-
-Model = _reflection.GeneratedProtocolMessageType('Model', (_message.Message,), {
-  'DESCRIPTOR' : _MODEL,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.Model)
-  })
-_sym_db.RegisterMessage(Model)
-
-RecognizeRequest = _reflection.GeneratedProtocolMessageType('RecognizeRequest', (_message.Message,), {
-  'DESCRIPTOR' : _RECOGNIZEREQUEST,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.RecognizeRequest)
-  })
-_sym_db.RegisterMessage(RecognizeRequest)
-
-RecognizeResponse = _reflection.GeneratedProtocolMessageType('RecognizeResponse', (_message.Message,), {
-  'DESCRIPTOR' : _RECOGNIZERESPONSE,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.RecognizeResponse)
-  })
-_sym_db.RegisterMessage(RecognizeResponse)
-
-RecognitionConfig = _reflection.GeneratedProtocolMessageType('RecognitionConfig', (_message.Message,), {
-  'DESCRIPTOR' : _RECOGNITIONCONFIG,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.RecognitionConfig)
-  })
-_sym_db.RegisterMessage(RecognitionConfig)
-
-RecognitionAudio = _reflection.GeneratedProtocolMessageType('RecognitionAudio', (_message.Message,), {
-  'DESCRIPTOR' : _RECOGNITIONAUDIO,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.RecognitionAudio)
-  })
-_sym_db.RegisterMessage(RecognitionAudio)
-
-SpeechRecognitionResult = _reflection.GeneratedProtocolMessageType('SpeechRecognitionResult', (_message.Message,), {
-  'DESCRIPTOR' : _SPEECHRECOGNITIONRESULT,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.SpeechRecognitionResult)
-  })
-_sym_db.RegisterMessage(SpeechRecognitionResult)
-
-SpeechRecognitionAlternative = _reflection.GeneratedProtocolMessageType('SpeechRecognitionAlternative', (_message.Message,), {
-  'DESCRIPTOR' : _SPEECHRECOGNITIONALTERNATIVE,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.SpeechRecognitionAlternative)
-  })
-_sym_db.RegisterMessage(SpeechRecognitionAlternative)
-
-Word = _reflection.GeneratedProtocolMessageType('Word', (_message.Message,), {
-  'DESCRIPTOR' : _WORD,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.Word)
-  })
-_sym_db.RegisterMessage(Word)
-
-SpeechContext = _reflection.GeneratedProtocolMessageType('SpeechContext', (_message.Message,), {
-  'DESCRIPTOR' : _SPEECHCONTEXT,
-  '__module__' : 'kaldi_serve_pb2'
-  # @@protoc_insertion_point(class_scope:kaldi_serve.SpeechContext)
-  })
-_sym_db.RegisterMessage(SpeechContext)
-
-
-
-_KALDISERVE = _descriptor.ServiceDescriptor(
-  name='KaldiServe',
-  full_name='kaldi_serve.KaldiServe',
-  file=DESCRIPTOR,
-  index=0,
-  serialized_options=None,
-  serialized_start=1196,
-  serialized_end=1534,
-  methods=[
-  _descriptor.MethodDescriptor(
-    name='ListModels',
-    full_name='kaldi_serve.KaldiServe.ListModels',
-    index=0,
-    containing_service=None,
-    input_type=google_dot_protobuf_dot_empty__pb2._EMPTY,
-    output_type=_MODELLIST,
-    serialized_options=None,
-  ),
-  _descriptor.MethodDescriptor(
-    name='Recognize',
-    full_name='kaldi_serve.KaldiServe.Recognize',
-    index=1,
-    containing_service=None,
-    input_type=_RECOGNIZEREQUEST,
-    output_type=_RECOGNIZERESPONSE,
-    serialized_options=None,
-  ),
-  _descriptor.MethodDescriptor(
-    name='StreamingRecognize',
-    full_name='kaldi_serve.KaldiServe.StreamingRecognize',
-    index=2,
-    containing_service=None,
-    input_type=_RECOGNIZEREQUEST,
-    output_type=_RECOGNIZERESPONSE,
-    serialized_options=None,
-  ),
-  _descriptor.MethodDescriptor(
-    name='BidiStreamingRecognize',
-    full_name='kaldi_serve.KaldiServe.BidiStreamingRecognize',
-    index=3,
-    containing_service=None,
-    input_type=_RECOGNIZEREQUEST,
-    output_type=_RECOGNIZERESPONSE,
-    serialized_options=None,
-  ),
-])
-_sym_db.RegisterServiceDescriptor(_KALDISERVE)
-
-DESCRIPTOR.services_by_name['KaldiServe'] = _KALDISERVE
-
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11kaldi_serve.proto\x12\x0bkaldi_serve\x1a\x1bgoogle/protobuf/empty.proto\"/\n\tModelList\x12\"\n\x06models\x18\x01 \x03(\x0b\x32\x12.kaldi_serve.Model\",\n\x05Model\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x15\n\rlanguage_code\x18\x02 \x01(\t\"P\n\x0bServerStats\x12\'\n\x06models\x18\x01 \x03(\x0b\x32\x17.kaldi_serve.ModelStats\x12\x18\n\x10memory_rss_bytes\x18\x02 \x01(\x03\"\xe7\x01\n\nModelStats\x12!\n\x05model\x18\x01 \x01(\x0b\x32\x12.kaldi_serve.Model\x12\x10\n\x08\x64\x65\x63oders\x18\x02 \x01(\x05\x12\x15\n\ridle_decoders\x18\x03 \x01(\x05\x12\x14\n\x0cmax_decoders\x18\x04 \x01(\x05\x12\x18\n\x10waiting_requests\x18\x05 \x01(\x05\x12\x18\n\x10real_time_factor\x18\x06 \x01(\x02\x12\x19\n\x11\x64\x65\x63oder_hold_secs\x18\x07 \x01(\x02\x12(\n\x06memory\x18\x08 \x01(\x0b\x32\x18.kaldi_serve.ModelMemory\"\xd0\x01\n\x0bModelMemory\x12\x12\n\nhclg_bytes\x18\x01 \x01(\x03\x12\x15\n\ram_nnet_bytes\x18\x02 \x01(\x03\x12\x1f\n\x17ivector_extractor_bytes\x18\x03 \x01(\x03\x12\x13\n\x0brnnlm_bytes\x18\x04 \x01(\x03\x12\x1c\n\x14word_embedding_bytes\x18\x05 \x01(\x03\x12\x14\n\x0clm_fst_bytes\x18\x06 \x01(\x03\x12\x17\n\x0fword_syms_bytes\x18\x07 \x01(\x03\x12\x13\n\x0btotal_bytes\x18\x08 \x01(\x03\"\x8e\x01\n\x10RecognizeRequest\x12.\n\x06\x63onfig\x18\x01 \x01(\x0b\x32\x1e.kaldi_serve.RecognitionConfig\x12,\n\x05\x61udio\x18\x02 \x01(\x0b\x32\x1d.kaldi_serve.RecognitionAudio\x12\x0c\n\x04uuid\x18\x03 \x01(\t\x12\x0e\n\x06tenant\x18\x04 \x01(\t\"\xaa\x01\n\x15\x42\x61tchRecognizeRequest\x12.\n\x06\x63onfig\x18\x01 \x01(\x0b\x32\x1e.kaldi_serve.RecognitionConfig\x12-\n\x06\x61udios\x18\x02 \x03(\x0b\x32\x1d.kaldi_serve.RecognitionAudio\x12\x0c\n\x04uuid\x18\x03 \x01(\t\x12\x0e\n\x06tenant\x18\x04 \x01(\t\x12\x14\n\x0cmax_parallel\x18\x05 \x01(\x05\"\x84\x01\n\x16\x42\x61tchRecognizeResponse\x12\r\n\x05index\x18\x01 \x01(\x05\x12\x30\n\x08response\x18\x02 \x01(\x0b\x32\x1e.kaldi_serve.RecognizeResponse\x12\x12\n\nerror_code\x18\x03 \x01(\x05\x12\x15\n\rerror_message\x18\x04 \x01(\t\"u\n\x11RecognizeResponse\x12\x35\n\x07results\x18\x01 \x03(\x0b\x32$.kaldi_serve.SpeechRecognitionResult\x12)\n\x05usage\x18\x02 \x01(\x0b\x32\x1a.kaldi_serve.ResourceUsage\"5\n\rResourceUsage\x12\x12\n\naudio_secs\x18\x01 \x01(\x02\x12\x10\n\x08\x63pu_secs\x18\x02 \x01(\x02\"\xe9\x04\n\x11RecognitionConfig\x12>\n\x08\x65ncoding\x18\x01 \x01(\x0e\x32,.kaldi_serve.RecognitionConfig.AudioEncoding\x12\x19\n\x11sample_rate_hertz\x18\x02 \x01(\x05\x12\x15\n\rlanguage_code\x18\x03 \x01(\t\x12\x18\n\x10max_alternatives\x18\x04 \x01(\x05\x12\x13\n\x0bpunctuation\x18\x05 \x01(\x08\x12\x33\n\x0fspeech_contexts\x18\x06 \x03(\x0b\x32\x1a.kaldi_serve.SpeechContext\x12\x1b\n\x13\x61udio_channel_count\x18\x07 \x01(\x05\x12\r\n\x05model\x18\n \x01(\t\x12\x0b\n\x03raw\x18\x0b \x01(\x08\x12\x12\n\ndata_bytes\x18\x0c \x01(\x05\x12\x12\n\nword_level\x18\r \x01(\x08\x12\x39\n\x08priority\x18\x0e \x01(\x0e\x32\'.kaldi_serve.RecognitionConfig.Priority\x12\x14\n\x0creport_usage\x18\x0f \x01(\x08\x12!\n\x19interim_results_on_change\x18\x10 \x01(\x08\x12\x12\n\ncontinuous\x18\x11 \x01(\x08\x12\x19\n\x11parallel_segments\x18\x12 \x01(\x05\"A\n\rAudioEncoding\x12\x18\n\x14\x45NCODING_UNSPECIFIED\x10\x00\x12\x0c\n\x08LINEAR16\x10\x01\x12\x08\n\x04\x46LAC\x10\x02\"7\n\x08Priority\x12\x18\n\x14PRIORITY_UNSPECIFIED\x10\x00\x12\x07\n\x03LOW\x10\x01\x12\x08\n\x04HIGH\x10\x02\"D\n\x10RecognitionAudio\x12\x11\n\x07\x63ontent\x18\x01 \x01(\x0cH\x00\x12\r\n\x03uri\x18\x02 \x01(\tH\x00\x42\x0e\n\x0c\x61udio_source\"\x7f\n\x17SpeechRecognitionResult\x12?\n\x0c\x61lternatives\x18\x01 \x03(\x0b\x32).kaldi_serve.SpeechRecognitionAlternative\x12\x10\n\x08is_final\x18\x02 \x01(\x08\x12\x11\n\tstability\x18\x03 \x01(\x02\"\x8c\x01\n\x1cSpeechRecognitionAlternative\x12\x12\n\ntranscript\x18\x01 \x01(\t\x12\x12\n\nconfidence\x18\x02 \x01(\x02\x12\x10\n\x08\x61m_score\x18\x03 \x01(\x02\x12\x10\n\x08lm_score\x18\x04 \x01(\x02\x12 \n\x05words\x18\x05 \x03(\x0b\x32\x11.kaldi_serve.Word\"N\n\x04Word\x12\x12\n\nstart_time\x18\x01 \x01(\x02\x12\x10\n\x08\x65nd_time\x18\x02 \x01(\x02\x12\x0c\n\x04word\x18\x03 \x01(\t\x12\x12\n\nconfidence\x18\x04 \x01(\x02\".\n\rSpeechContext\x12\x0f\n\x07phrases\x18\x01 \x03(\t\x12\x0c\n\x04type\x18\x02 \x01(\t2\xf7\x03\n\nKaldiServe\x12>\n\nListModels\x12\x16.google.protobuf.Empty\x1a\x16.kaldi_serve.ModelList\"\x00\x12\x44\n\x0eGetServerStats\x12\x16.google.protobuf.Empty\x1a\x18.kaldi_serve.ServerStats\"\x00\x12L\n\tRecognize\x12\x1d.kaldi_serve.RecognizeRequest\x1a\x1e.kaldi_serve.RecognizeResponse\"\x00\x12W\n\x12StreamingRecognize\x12\x1d.kaldi_serve.RecognizeRequest\x1a\x1e.kaldi_serve.RecognizeResponse\"\x00(\x01\x12]\n\x16\x42idiStreamingRecognize\x12\x1d.kaldi_serve.RecognizeRequest\x1a\x1e.kaldi_serve.RecognizeResponse\"\x00(\x01\x30\x01\x12]\n\x0e\x42\x61tchRecognize\x12\".kaldi_serve.BatchRecognizeRequest\x1a#.kaldi_serve.BatchRecognizeResponse\"\x00\x30\x01\x62\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'kaldi_serve_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _MODELLIST._serialized_start=63
+  _MODELLIST._serialized_end=110
+  _MODEL._serialized_start=112
+  _MODEL._serialized_end=156
+  _SERVERSTATS._serialized_start=158
+  _SERVERSTATS._serialized_end=238
+  _MODELSTATS._serialized_start=241
+  _MODELSTATS._serialized_end=472
+  _MODELMEMORY._serialized_start=475
+  _MODELMEMORY._serialized_end=683
+  _RECOGNIZEREQUEST._serialized_start=686
+  _RECOGNIZEREQUEST._serialized_end=828
+  _BATCHRECOGNIZEREQUEST._serialized_start=831
+  _BATCHRECOGNIZEREQUEST._serialized_end=1001
+  _BATCHRECOGNIZERESPONSE._serialized_start=1004
+  _BATCHRECOGNIZERESPONSE._serialized_end=1136
+  _RECOGNIZERESPONSE._serialized_start=1138
+  _RECOGNIZERESPONSE._serialized_end=1255
+  _RESOURCEUSAGE._serialized_start=1257
+  _RESOURCEUSAGE._serialized_end=1310
+  _RECOGNITIONCONFIG._serialized_start=1313
+  _RECOGNITIONCONFIG._serialized_end=1930
+  _RECOGNITIONCONFIG_AUDIOENCODING._serialized_start=1808
+  _RECOGNITIONCONFIG_AUDIOENCODING._serialized_end=1873
+  _RECOGNITIONCONFIG_PRIORITY._serialized_start=1875
+  _RECOGNITIONCONFIG_PRIORITY._serialized_end=1930
+  _RECOGNITIONAUDIO._serialized_start=1932
+  _RECOGNITIONAUDIO._serialized_end=2000
+  _SPEECHRECOGNITIONRESULT._serialized_start=2002
+  _SPEECHRECOGNITIONRESULT._serialized_end=2129
+  _SPEECHRECOGNITIONALTERNATIVE._serialized_start=2132
+  _SPEECHRECOGNITIONALTERNATIVE._serialized_end=2272
+  _WORD._serialized_start=2274
+  _WORD._serialized_end=2352
+  _SPEECHCONTEXT._serialized_start=2354
+  _SPEECHCONTEXT._serialized_end=2400
+  _KALDISERVE._serialized_start=2403
+  _KALDISERVE._serialized_end=2906
 # @@protoc_insertion_point(module_scope)
@@ -1,4 +1,5 @@
 # Generated by the gRPC Python protocol compiler plugin. DO NOT EDIT!
+"""Client and server classes corresponding to protobuf-defined services."""
 import grpc
 
 from google.protobuf import empty_pb2 as google_dot_protobuf_dot_empty__pb2
@@ -6,95 +7,235 @@ import kaldi_serve.kaldi_serve_pb2 as kaldi__serve__pb2
 
 
 class KaldiServeStub(object):
-  # missing associated documentation comment in .proto file
-  pass
-
-  def __init__(self, channel):
-    """Constructor.
-
-    Args:
-      channel: A grpc.Channel.
-    """
-    self.ListModels = channel.unary_unary(
-        '/kaldi_serve.KaldiServe/ListModels',
-        request_serializer=google_dot_protobuf_dot_empty__pb2.Empty.SerializeToString,
-        response_deserializer=kaldi__serve__pb2.ModelList.FromString,
-        )
-    self.Recognize = channel.unary_unary(
-        '/kaldi_serve.KaldiServe/Recognize',
-        request_serializer=kaldi__serve__pb2.RecognizeRequest.SerializeToString,
-        response_deserializer=kaldi__serve__pb2.RecognizeResponse.FromString,
-        )
-    self.StreamingRecognize = channel.stream_unary(
-        '/kaldi_serve.KaldiServe/StreamingRecognize',
-        request_serializer=kaldi__serve__pb2.RecognizeRequest.SerializeToString,
-        response_deserializer=kaldi__serve__pb2.RecognizeResponse.FromString,
-        )
-    self.BidiStreamingRecognize = channel.stream_stream(
-        '/kaldi_serve.KaldiServe/BidiStreamingRecognize',
-        request_serializer=kaldi__serve__pb2.RecognizeRequest.SerializeToString,
-        response_deserializer=kaldi__serve__pb2.RecognizeResponse.FromString,
-        )
+    """Missing associated documentation comment in .proto file."""
+
+    def __init__(self, channel):
+        """Constructor.
+
+        Args:
+            channel: A grpc.Channel.
+        """
+        self.ListModels = channel.unary_unary(
+                '/kaldi_serve.KaldiServe/ListModels',
+                request_serializer=google_dot_protobuf_dot_empty__pb2.Empty.SerializeToString,
+                response_deserializer=kaldi__serve__pb2.ModelList.FromString,
+                )
+        self.GetServerStats = channel.unary_unary(
+                '/kaldi_serve.KaldiServe/GetServerStats',
+                request_serializer=google_dot_protobuf_dot_empty__pb2.Empty.SerializeToString,
+                response_deserializer=kaldi__serve__pb2.ServerStats.FromString,
+                )
+        self.Recognize = channel.unary_unary(
+                '/kaldi_serve.KaldiServe/Recognize',
+                request_serializer=kaldi__serve__pb2.RecognizeRequest.SerializeToString,
+                response_deserializer=kaldi__serve__pb2.RecognizeResponse.FromString,
+                )
+        self.StreamingRecognize = channel.stream_unary(
+                '/kaldi_serve.KaldiServe/StreamingRecognize',
+                request_serializer=kaldi__serve__pb2.RecognizeRequest.SerializeToString,
+                response_deserializer=kaldi__serve__pb2.RecognizeResponse.FromString,
+                )
+        self.BidiStreamingRecognize = channel.stream_stream(
+                '/kaldi_serve.KaldiServe/BidiStreamingRecognize',
+                request_serializer=kaldi__serve__pb2.RecognizeRequest.SerializeToString,
+                response_deserializer=kaldi__serve__pb2.RecognizeResponse.FromString,
+                )
+        self.BatchRecognize = channel.unary_stream(
+                '/kaldi_serve.KaldiServe/BatchRecognize',
+                request_serializer=kaldi__serve__pb2.BatchRecognizeRequest.SerializeToString,
+                response_deserializer=kaldi__serve__pb2.BatchRecognizeResponse.FromString,
+                )
 
 
 class KaldiServeServicer(object):
-  # missing associated documentation comment in .proto file
-  pass
-
-  def ListModels(self, request, context):
-    """Lists all the available loaded models
-    """
-    context.set_code(grpc.StatusCode.UNIMPLEMENTED)
-    context.set_details('Method not implemented!')
-    raise NotImplementedError('Method not implemented!')
-
-  def Recognize(self, request, context):
-    """Performs synchronous non-streaming speech recognition.
-    """
-    context.set_code(grpc.StatusCode.UNIMPLEMENTED)
-    context.set_details('Method not implemented!')
-    raise NotImplementedError('Method not implemented!')
-
-  def StreamingRecognize(self, request_iterator, context):
-    """Performs synchronous client-to-server streaming speech recognition: 
-    receive results after all audio has been streamed and processed.
-    """
-    context.set_code(grpc.StatusCode.UNIMPLEMENTED)
-    context.set_details('Method not implemented!')
-    raise NotImplementedError('Method not implemented!')
-
-  def BidiStreamingRecognize(self, request_iterator, context):
-    """Performs synchronous bidirectional streaming speech recognition: 
-    receive results as the audio is being streamed and processed.
-    """
-    context.set_code(grpc.StatusCode.UNIMPLEMENTED)
-    context.set_details('Method not implemented!')
-    raise NotImplementedError('Method not implemented!')
+    """Missing associated documentation comment in .proto file."""
+
+    def ListModels(self, request, context):
+        """Lists all the available loaded models
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def GetServerStats(self, request, context):
+        """Live load of the loaded models (cheap enough for load balancers to poll)
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def Recognize(self, request, context):
+        """Performs synchronous non-streaming speech recognition.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def StreamingRecognize(self, request_iterator, context):
+        """Performs synchronous client-to-server streaming speech recognition: 
+        receive results after all audio has been streamed and processed.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def BidiStreamingRecognize(self, request_iterator, context):
+        """Performs synchronous bidirectional streaming speech recognition: 
+        receive results as the audio is being streamed and processed.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
+
+    def BatchRecognize(self, request, context):
+        """Performs non-streaming speech recognition of a batch of audios with one model:
+        audios are decoded in parallel and results streamed back as each one is done.
+        """
+        context.set_code(grpc.StatusCode.UNIMPLEMENTED)
+        context.set_details('Method not implemented!')
+        raise NotImplementedError('Method not implemented!')
 
 
 def add_KaldiServeServicer_to_server(servicer, server):
-  rpc_method_handlers = {
-      'ListModels': grpc.unary_unary_rpc_method_handler(
-          servicer.ListModels,
-          request_deserializer=google_dot_protobuf_dot_empty__pb2.Empty.FromString,
-          response_serializer=kaldi__serve__pb2.ModelList.SerializeToString,
-      ),
-      'Recognize': grpc.unary_unary_rpc_method_handler(
-          servicer.Recognize,
-          request_deserializer=kaldi__serve__pb2.RecognizeRequest.FromString,
-          response_serializer=kaldi__serve__pb2.RecognizeResponse.SerializeToString,
-      ),
-      'StreamingRecognize': grpc.stream_unary_rpc_method_handler(
-          servicer.StreamingRecognize,
-          request_deserializer=kaldi__serve__pb2.RecognizeRequest.FromString,
-          response_serializer=kaldi__serve__pb2.RecognizeResponse.SerializeToString,
-      ),
-      'BidiStreamingRecognize': grpc.stream_stream_rpc_method_handler(
-          servicer.BidiStreamingRecognize,
-          request_deserializer=kaldi__serve__pb2.RecognizeRequest.FromString,
-          response_serializer=kaldi__serve__pb2.RecognizeResponse.SerializeToString,
-      ),
-  }
-  generic_handler = grpc.method_handlers_generic_handler(
-      'kaldi_serve.KaldiServe', rpc_method_handlers)
-  server.add_generic_rpc_handlers((generic_handler,))
+    rpc_method_handlers = {
+            'ListModels': grpc.unary_unary_rpc_method_handler(
+                    servicer.ListModels,
+                    request_deserializer=google_dot_protobuf_dot_empty__pb2.Empty.FromString,
+                    response_serializer=kaldi__serve__pb2.ModelList.SerializeToString,
+            ),
+            'GetServerStats': grpc.unary_unary_rpc_method_handler(
+                    servicer.GetServerStats,
+                    request_deserializer=google_dot_protobuf_dot_empty__pb2.Empty.FromString,
+                    response_serializer=kaldi__serve__pb2.ServerStats.SerializeToString,
+            ),
+            'Recognize': grpc.unary_unary_rpc_method_handler(
+                    servicer.Recognize,
+                    request_deserializer=kaldi__serve__pb2.RecognizeRequest.FromString,
+                    response_serializer=kaldi__serve__pb2.RecognizeResponse.SerializeToString,
+            ),
+            'StreamingRecognize': grpc.stream_unary_rpc_method_handler(
+                    servicer.StreamingRecognize,
+                    request_deserializer=kaldi__serve__pb2.RecognizeRequest.FromString,
+                    response_serializer=kaldi__serve__pb2.RecognizeResponse.SerializeToString,
+            ),
+            'BidiStreamingRecognize': grpc.stream_stream_rpc_method_handler(
+                    servicer.BidiStreamingRecognize,
+                    request_deserializer=kaldi__serve__pb2.RecognizeRequest.FromString,
+                    response_serializer=kaldi__serve__pb2.RecognizeResponse.SerializeToString,
+            ),
+            'BatchRecognize': grpc.unary_stream_rpc_method_handler(
+                    servicer.BatchRecognize,
+                    request_deserializer=kaldi__serve__pb2.BatchRecognizeRequest.FromString,
+                    response_serializer=kaldi__serve__pb2.BatchRecognizeResponse.SerializeToString,
+            ),
+    }
+    generic_handler = grpc.method_handlers_generic_handler(
+            'kaldi_serve.KaldiServe', rpc_method_handlers)
+    server.add_generic_rpc_handlers((generic_handler,))
+
+
+ # This class is part of an EXPERIMENTAL API.
+class KaldiServe(object):
+    """Missing associated documentation comment in .proto file."""
+
+    @staticmethod
+    def ListModels(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(request, target, '/kaldi_serve.KaldiServe/ListModels',
+            google_dot_protobuf_dot_empty__pb2.Empty.SerializeToString,
+            kaldi__serve__pb2.ModelList.FromString,
+            options, channel_credentials,
+            insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
+
+    @staticmethod
+    def GetServerStats(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(request, target, '/kaldi_serve.KaldiServe/GetServerStats',
+            google_dot_protobuf_dot_empty__pb2.Empty.SerializeToString,
+            kaldi__serve__pb2.ServerStats.FromString,
+            options, channel_credentials,
+            insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
+
+    @staticmethod
+    def Recognize(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_unary(request, target, '/kaldi_serve.KaldiServe/Recognize',
+            kaldi__serve__pb2.RecognizeRequest.SerializeToString,
+            kaldi__serve__pb2.RecognizeResponse.FromString,
+            options, channel_credentials,
+            insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
+
+    @staticmethod
+    def StreamingRecognize(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_unary(request_iterator, target, '/kaldi_serve.KaldiServe/StreamingRecognize',
+            kaldi__serve__pb2.RecognizeRequest.SerializeToString,
+            kaldi__serve__pb2.RecognizeResponse.FromString,
+            options, channel_credentials,
+            insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
+
+    @staticmethod
+    def BidiStreamingRecognize(request_iterator,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.stream_stream(request_iterator, target, '/kaldi_serve.KaldiServe/BidiStreamingRecognize',
+            kaldi__serve__pb2.RecognizeRequest.SerializeToString,
+            kaldi__serve__pb2.RecognizeResponse.FromString,
+            options, channel_credentials,
+            insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
+
+    @staticmethod
+    def BatchRecognize(request,
+            target,
+            options=(),
+            channel_credentials=None,
+            call_credentials=None,
+            insecure=False,
+            compression=None,
+            wait_for_ready=None,
+            timeout=None,
+            metadata=None):
+        return grpc.experimental.unary_stream(request, target, '/kaldi_serve.KaldiServe/BatchRecognize',
+            kaldi__serve__pb2.BatchRecognizeRequest.SerializeToString,
+            kaldi__serve__pb2.BatchRecognizeResponse.FromString,
+            options, channel_credentials,
+            insecure, call_credentials, compression, wait_for_ready, timeout, metadata)
@@ -1,11 +1,13 @@
+import io
 import threading
 import time
 
 import pytest
 import yaml
+from pydub import AudioSegment
 
 from kaldi_serve import KaldiServeClient, RecognitionAudio, RecognitionConfig
-from kaldi_serve.utils import chunks_from_file
+from kaldi_serve.utils import chunks_from_audio_segment, chunks_from_file
 
 
 def read_items(file_path: str):
@@ -26,7 +28,11 @@ class TranscriptionSpecFile(pytest.File):
     def collect(self):
         client = KaldiServeClient()
         for i, item in enumerate(read_items(self.fspath)):
-            yield TranscriptionItem(f"item-{i}", self, item, client)
+            # a list of audios to stream in parallel, or a case of some rpc
+            if isinstance(item, list):
+                yield TranscriptionItem(f"item-{i}", self, item, client)
+            else:
+                yield RPC_ITEMS[item["rpc"]](f"item-{i}-{item['rpc']}", self, item, client)
 
 
 def dreamer(source_gen, sleep_time: int):
@@ -35,6 +41,40 @@ def dreamer(source_gen, sleep_time: int):
         time.sleep(sleep_time)
 
 
+def make_config(**kwargs) -> RecognitionConfig:
+    # NOTE: These are only assumptions for now so test failures might not
+    #       necessarily mean error in model/server.
+    return RecognitionConfig(
+        sample_rate_hertz=8000,
+        encoding=RecognitionConfig.AudioEncoding.LINEAR16,
+        language_code="hi",
+        max_alternatives=10,
+        model="general",
+        **kwargs
+    )
+
+
+def audio_from_files(files) -> AudioSegment:
+    """
+    Concatenate the audio files (one after the other) into a single audio
+    """
+
+    audio = AudioSegment.empty()
+    for filename in files:
+        audio += AudioSegment.from_file(filename, format="wav", frame_rate=8000, channels=1, sample_width=2)
+    return audio
+
+
+def wav_bytes(audio: AudioSegment) -> bytes:
+    audio_stream = io.BytesIO()
+    audio.export(audio_stream, format="wav")
+    return audio_stream.getvalue()
+
+
+def best_transcript(result) -> str:
+    return result.alternatives[0].transcript if result.alternatives else ""
+
+
 class TranscriptionItem(pytest.Item):
     """
     Each item tells which files to read and throw at the server in parallel.
@@ -51,18 +91,8 @@ class TranscriptionItem(pytest.Item):
         self.results = [None for _ in item]
 
     def decode_audio(self, index: int):
-        # NOTE: These are only assumptions for now so test failures might not
-        #       necessarily mean error in model/server.
-        config = RecognitionConfig(
-            sample_rate_hertz=8000,
-            encoding=RecognitionConfig.AudioEncoding.LINEAR16,
-            language_code="hi",
-            max_alternatives=10,
-            model="general"
-        )
-
         audio = dreamer((RecognitionAudio(content=chunk) for chunk in self.audios[index][0]), 1)
-        self.results[index] = self.client.streaming_recognize(config, audio, uuid="")
+        self.results[index] = self.client.streaming_recognize(make_config(), audio, uuid="")
 
     def runtest(self):
         threads = []
@@ -78,3 +108,165 @@ class TranscriptionItem(pytest.Item):
 
     def reportinfo(self):
         return self.fspath, 0, self.name
+
+
+class ServerStatsItem(pytest.Item):
+    """
+    Checks that the live load figures of a served model add up.
+    """
+
+    def __init__(self, name, parent, item, client):
+        super().__init__(name, parent)
+        self.model = item["model"]
+        self.language_code = item["language_code"]
+        self.client = client
+
+    def runtest(self):
+        stats = self.client.get_server_stats()
+        assert stats.memory_rss_bytes > 0
+
+        models = [m for m in stats.models
+                  if m.model.name == self.model and m.model.language_code == self.language_code]
+        assert len(models) == 1
+
+        model = models[0]
+        assert model.max_decoders > 0
+        assert 0 <= model.idle_decoders <= model.decoders <= model.max_decoders
+        assert model.waiting_requests >= 0
+        assert model.memory.total_bytes > 0
+
+    def reportinfo(self):
+        return self.fspath, 0, self.name
+
+
+class BatchItem(pytest.Item):
+    """
+    Decodes a batch of audios in one call. Each audio is either a file with
+    its expected transcription or some (undecodable) content with the error
+    code expected for it instead.
+    """
+
+    def __init__(self, name, parent, item, client):
+        super().__init__(name, parent)
+        self.specs = item["audios"]
+        self.max_parallel = item.get("max_parallel", 0)
+        self.client = client
+
+    def runtest(self):
+        audios = []
+        for spec in self.specs:
+            if "file" in spec:
+                content = wav_bytes(audio_from_files([spec["file"]]))
+            else:
+                content = spec["content"].encode("utf-8")
+            audios.append(RecognitionAudio(content=content))
+
+        responses = list(self.client.batch_recognize(make_config(), audios, uuid="", max_parallel=self.max_parallel))
+
+        # a result per audio, tagged with its index, whatever the order
+        assert sorted(response.index for response in responses) == list(range(len(self.specs)))
+
+        for response in responses:
+            spec = self.specs[response.index]
+            if "transcription" in spec:
+                assert response.error_code == 0
+                assert best_transcript(response.response.results[0]) == spec["transcription"]
+            else:
+                # a failed audio doesn't fail the others
+                assert response.error_code == spec["error_code"]
+                assert response.error_message != ""
+
+    def reportinfo(self):
+        return self.fspath, 0, self.name
+
+
+class BidiItem(pytest.Item):
+    """
+    Streams the (concatenated) files in real time to the bidi streaming rpc
+    and checks the interim and final results coming back. With `continuous`
+    set, the transcripts of the final results of the segments make up the
+    expected transcription.
+    """
+
+    def __init__(self, name, parent, item, client):
+        super().__init__(name, parent)
+        self.chunks = chunks_from_audio_segment(audio_from_files(item["files"]))
+        self.transcription = item["transcription"]
+        self.continuous = item.get("continuous", False)
+        self.client = client
+
+    def runtest(self):
+        config = make_config(continuous=self.continuous)
+        audio = dreamer((RecognitionAudio(content=chunk) for chunk in self.chunks), 1)
+        results = [response.results[0] for response in self.client.bidi_streaming_recognize(config, audio, uuid="")]
+
+        for result in results:
+            assert 0.0 <= result.stability <= 1.0
+            if result.is_final:
+                assert result.stability == 1.0
+
+        # the stream always ends with a final result
+        assert results[-1].is_final
+
+        finals = [best_transcript(result) for result in results if result.is_final]
+        if self.continuous:
+            assert " ".join(t for t in finals if t) == self.transcription
+        else:
+            assert len(finals) == 1
+            assert finals[0] == self.transcription
+
+    def reportinfo(self):
+        return self.fspath, 0, self.name
+
+
+class RecognizeItem(pytest.Item):
+    """
+    Decodes the (concatenated) files in a single recognize call, optionally
+    split into `parallel_segments`, and checks that the word timings are
+    relative to the start of the whole audio.
+    """
+
+    def __init__(self, name, parent, item, client):
+        super().__init__(name, parent)
+        self.files = item["files"]
+        self.transcription = item["transcription"]
+        self.parallel_segments = item.get("parallel_segments", 0)
+        self.client = client
+
+    def runtest(self):
+        audio = audio_from_files(self.files)
+        config = make_config(word_level=True, parallel_segments=self.parallel_segments)
+        response = self.client.recognize(config, RecognitionAudio(content=wav_bytes(audio)), uuid="")
+
+        alternative = response.results[0].alternatives[0]
+        assert alternative.transcript == self.transcription
+
+        words = alternative.words
+        assert len(words) > 0
+        assert " ".join(word.word for word in words) == alternative.transcript
+
+        # only the best alternative carries word timings, the others would
+        # miss the words of the segments they differ in
+        for other in response.results[0].alternatives[1:]:
+            assert len(other.words) == 0
+
+        previous_start = 0.0
+        for word in words:
+            assert previous_start <= word.start_time <= word.end_time <= audio.duration_seconds + 0.1
+            previous_start = word.start_time
+
+        # words of the last file are timed from the start of the audio, not of
+        # the segment they were decoded in
+        last_file_start = audio.duration_seconds - audio_from_files(self.files[-1:]).duration_seconds
+        assert words[-1].end_time > last_file_start
+
+    def reportinfo(self):
+        return self.fspath, 0, self.name
+
+
+RPC_ITEMS = {
+    "server_stats": ServerStatsItem,
+    "batch": BatchItem,
+    "bidi": BidiItem,
+    "recognize": RecognizeItem,
+}
@@ -7,24 +7,23 @@
 #include "kaldi_serve.pb.h"
 
 #include <functional>
-#include <grpc/impl/codegen/port_platform.h>
-#include <grpcpp/impl/codegen/async_generic_service.h>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/client_context.h>
-#include <grpcpp/impl/codegen/completion_queue.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
-#include <grpcpp/impl/codegen/rpc_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
 #include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
 #include <grpcpp/impl/codegen/status.h>
-#include <grpcpp/impl/codegen/stub_options.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
 
 namespace kaldi_serve {
 
@@ -44,6 +43,14 @@ class KaldiServe final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ModelList>> PrepareAsyncListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ModelList>>(PrepareAsyncListModelsRaw(context, request, cq));
     }
+    // Live load of the loaded models (cheap enough for load balancers to poll)
+    virtual ::grpc::Status GetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::kaldi_serve::ServerStats* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ServerStats>> AsyncGetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ServerStats>>(AsyncGetServerStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ServerStats>> PrepareAsyncGetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ServerStats>>(PrepareAsyncGetServerStatsRaw(context, request, cq));
+    }
     // Performs synchronous non-streaming speech recognition.
     virtual ::grpc::Status Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::kaldi_serve::RecognizeResponse* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::RecognizeResponse>> AsyncRecognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::grpc::CompletionQueue* cq) {
@@ -74,60 +81,47 @@ class KaldiServe final {
     std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>> PrepareAsyncBidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>>(PrepareAsyncBidiStreamingRecognizeRaw(context, cq));
     }
-    class experimental_async_interface {
+    // Performs non-streaming speech recognition of a batch of audios with one model:
+    //    audios are decoded in parallel and results streamed back as each one is done.
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::kaldi_serve::BatchRecognizeResponse>> BatchRecognize(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::kaldi_serve::BatchRecognizeResponse>>(BatchRecognizeRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::kaldi_serve::BatchRecognizeResponse>> AsyncBatchRecognize(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::kaldi_serve::BatchRecognizeResponse>>(AsyncBatchRecognizeRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::kaldi_serve::BatchRecognizeResponse>> PrepareAsyncBatchRecognize(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::kaldi_serve::BatchRecognizeResponse>>(PrepareAsyncBatchRecognizeRaw(context, request, cq));
+    }
+    class async_interface {
      public:
-      virtual ~experimental_async_interface() {}
+      virtual ~async_interface() {}
       // Lists all the available loaded models
       virtual void ListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ListModels(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::ModelList* response, std::function<void(::grpc::Status)>) = 0;
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void ListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      #else
-      virtual void ListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      virtual void ListModels(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::ModelList* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      #else
-      virtual void ListModels(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::ModelList* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
-      #endif
+      // Live load of the loaded models (cheap enough for load balancers to poll)
+      virtual void GetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ServerStats* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ServerStats* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       // Performs synchronous non-streaming speech recognition.
       virtual void Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Recognize(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::RecognizeResponse* response, std::function<void(::grpc::Status)>) = 0;
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      #else
-      virtual void Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      virtual void Recognize(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::RecognizeResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      #else
-      virtual void Recognize(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::RecognizeResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
-      #endif
       // Performs synchronous client-to-server streaming speech recognition: 
       //    receive results after all audio has been streamed and processed.
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void StreamingRecognize(::grpc::ClientContext* context, ::kaldi_serve::RecognizeResponse* response, ::grpc::ClientWriteReactor< ::kaldi_serve::RecognizeRequest>* reactor) = 0;
-      #else
-      virtual void StreamingRecognize(::grpc::ClientContext* context, ::kaldi_serve::RecognizeResponse* response, ::grpc::experimental::ClientWriteReactor< ::kaldi_serve::RecognizeRequest>* reactor) = 0;
-      #endif
       // Performs synchronous bidirectional streaming speech recognition: 
       //    receive results as the audio is being streamed and processed.
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       virtual void BidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::kaldi_serve::RecognizeRequest,::kaldi_serve::RecognizeResponse>* reactor) = 0;
-      #else
-      virtual void BidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::kaldi_serve::RecognizeRequest,::kaldi_serve::RecognizeResponse>* reactor) = 0;
-      #endif
+      // Performs non-streaming speech recognition of a batch of audios with one model:
+      //    audios are decoded in parallel and results streamed back as each one is done.
+      virtual void BatchRecognize(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest* request, ::grpc::ClientReadReactor< ::kaldi_serve::BatchRecognizeResponse>* reactor) = 0;
     };
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    typedef class experimental_async_interface async_interface;
-    #endif
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-    async_interface* async() { return experimental_async(); }
-    #endif
-    virtual class experimental_async_interface* experimental_async() { return nullptr; }
-  private:
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ModelList>* AsyncListModelsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ModelList>* PrepareAsyncListModelsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ServerStats>* AsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::ServerStats>* PrepareAsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::RecognizeResponse>* AsyncRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::kaldi_serve::RecognizeResponse>* PrepareAsyncRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientWriterInterface< ::kaldi_serve::RecognizeRequest>* StreamingRecognizeRaw(::grpc::ClientContext* context, ::kaldi_serve::RecognizeResponse* response) = 0;
@@ -136,10 +130,13 @@ class KaldiServe final {
     virtual ::grpc::ClientReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* BidiStreamingRecognizeRaw(::grpc::ClientContext* context) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* AsyncBidiStreamingRecognizeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
     virtual ::grpc::ClientAsyncReaderWriterInterface< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* PrepareAsyncBidiStreamingRecognizeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::kaldi_serve::BatchRecognizeResponse>* BatchRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::kaldi_serve::BatchRecognizeResponse>* AsyncBatchRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::kaldi_serve::BatchRecognizeResponse>* PrepareAsyncBatchRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel);
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
     ::grpc::Status ListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::kaldi_serve::ModelList* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ModelList>> AsyncListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ModelList>>(AsyncListModelsRaw(context, request, cq));
@@ -147,6 +144,13 @@ class KaldiServe final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ModelList>> PrepareAsyncListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ModelList>>(PrepareAsyncListModelsRaw(context, request, cq));
     }
+    ::grpc::Status GetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::kaldi_serve::ServerStats* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ServerStats>> AsyncGetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ServerStats>>(AsyncGetServerStatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ServerStats>> PrepareAsyncGetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ServerStats>>(PrepareAsyncGetServerStatsRaw(context, request, cq));
+    }
     ::grpc::Status Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::kaldi_serve::RecognizeResponse* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::RecognizeResponse>> AsyncRecognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::kaldi_serve::RecognizeResponse>>(AsyncRecognizeRaw(context, request, cq));
@@ -172,56 +176,42 @@ class KaldiServe final {
     std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>> PrepareAsyncBidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>>(PrepareAsyncBidiStreamingRecognizeRaw(context, cq));
     }
-    class experimental_async final :
-      public StubInterface::experimental_async_interface {
+    std::unique_ptr< ::grpc::ClientReader< ::kaldi_serve::BatchRecognizeResponse>> BatchRecognize(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::kaldi_serve::BatchRecognizeResponse>>(BatchRecognizeRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::kaldi_serve::BatchRecognizeResponse>> AsyncBatchRecognize(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::kaldi_serve::BatchRecognizeResponse>>(AsyncBatchRecognizeRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::kaldi_serve::BatchRecognizeResponse>> PrepareAsyncBatchRecognize(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::kaldi_serve::BatchRecognizeResponse>>(PrepareAsyncBatchRecognizeRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
      public:
       void ListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response, std::function<void(::grpc::Status)>) override;
-      void ListModels(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::ModelList* response, std::function<void(::grpc::Status)>) override;
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void ListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response, ::grpc::ClientUnaryReactor* reactor) override;
-      #else
-      void ListModels(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      void ListModels(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::ModelList* response, ::grpc::ClientUnaryReactor* reactor) override;
-      #else
-      void ListModels(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::ModelList* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
-      #endif
+      void GetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ServerStats* response, std::function<void(::grpc::Status)>) override;
+      void GetServerStats(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ServerStats* response, ::grpc::ClientUnaryReactor* reactor) override;
       void Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response, std::function<void(::grpc::Status)>) override;
-      void Recognize(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::RecognizeResponse* response, std::function<void(::grpc::Status)>) override;
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      #else
-      void Recognize(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      void Recognize(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::RecognizeResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      #else
-      void Recognize(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::kaldi_serve::RecognizeResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void StreamingRecognize(::grpc::ClientContext* context, ::kaldi_serve::RecognizeResponse* response, ::grpc::ClientWriteReactor< ::kaldi_serve::RecognizeRequest>* reactor) override;
-      #else
-      void StreamingRecognize(::grpc::ClientContext* context, ::kaldi_serve::RecognizeResponse* response, ::grpc::experimental::ClientWriteReactor< ::kaldi_serve::RecognizeRequest>* reactor) override;
-      #endif
-      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
       void BidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::kaldi_serve::RecognizeRequest,::kaldi_serve::RecognizeResponse>* reactor) override;
-      #else
-      void BidiStreamingRecognize(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::kaldi_serve::RecognizeRequest,::kaldi_serve::RecognizeResponse>* reactor) override;
-      #endif
+      void BatchRecognize(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest* request, ::grpc::ClientReadReactor< ::kaldi_serve::BatchRecognizeResponse>* reactor) override;
      private:
       friend class Stub;
-      explicit experimental_async(Stub* stub): stub_(stub) { }
+      explicit async(Stub* stub): stub_(stub) { }
       Stub* stub() { return stub_; }
       Stub* stub_;
     };
-    class experimental_async_interface* experimental_async() override { return &async_stub_; }
+    class async* async() override { return &async_stub_; }
 
    private:
     std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class experimental_async async_stub_{this};
+    class async async_stub_{this};
     ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ModelList>* AsyncListModelsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ModelList>* PrepareAsyncListModelsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ServerStats>* AsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::kaldi_serve::ServerStats>* PrepareAsyncGetServerStatsRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::kaldi_serve::RecognizeResponse>* AsyncRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::kaldi_serve::RecognizeResponse>* PrepareAsyncRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::RecognizeRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientWriter< ::kaldi_serve::RecognizeRequest>* StreamingRecognizeRaw(::grpc::ClientContext* context, ::kaldi_serve::RecognizeResponse* response) override;
@@ -230,10 +220,15 @@ class KaldiServe final {
     ::grpc::ClientReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* BidiStreamingRecognizeRaw(::grpc::ClientContext* context) override;
     ::grpc::ClientAsyncReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* AsyncBidiStreamingRecognizeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
     ::grpc::ClientAsyncReaderWriter< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* PrepareAsyncBidiStreamingRecognizeRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::kaldi_serve::BatchRecognizeResponse>* BatchRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request) override;
+    ::grpc::ClientAsyncReader< ::kaldi_serve::BatchRecognizeResponse>* AsyncBatchRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::kaldi_serve::BatchRecognizeResponse>* PrepareAsyncBatchRecognizeRaw(::grpc::ClientContext* context, const ::kaldi_serve::BatchRecognizeRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_ListModels_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetServerStats_;
     const ::grpc::internal::RpcMethod rpcmethod_Recognize_;
     const ::grpc::internal::RpcMethod rpcmethod_StreamingRecognize_;
     const ::grpc::internal::RpcMethod rpcmethod_BidiStreamingRecognize_;
+    const ::grpc::internal::RpcMethod rpcmethod_BatchRecognize_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -243,6 +238,8 @@ class KaldiServe final {
     virtual ~Service();
     // Lists all the available loaded models
     virtual ::grpc::Status ListModels(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response);
+    // Live load of the loaded models (cheap enough for load balancers to poll)
+    virtual ::grpc::Status GetServerStats(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ServerStats* response);
     // Performs synchronous non-streaming speech recognition.
     virtual ::grpc::Status Recognize(::grpc::ServerContext* context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response);
     // Performs synchronous client-to-server streaming speech recognition: 
@@ -251,6 +248,9 @@ class KaldiServe final {
     // Performs synchronous bidirectional streaming speech recognition: 
     //    receive results as the audio is being streamed and processed.
     virtual ::grpc::Status BidiStreamingRecognize(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::kaldi_serve::RecognizeResponse, ::kaldi_serve::RecognizeRequest>* stream);
+    // Performs non-streaming speech recognition of a batch of audios with one model:
+    //    audios are decoded in parallel and results streamed back as each one is done.
+    virtual ::grpc::Status BatchRecognize(::grpc::ServerContext* context, const ::kaldi_serve::BatchRecognizeRequest* request, ::grpc::ServerWriter< ::kaldi_serve::BatchRecognizeResponse>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_ListModels : public BaseClass {
@@ -273,12 +273,32 @@ class KaldiServe final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetServerStats(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::kaldi_serve::ServerStats>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_Recognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_Recognize() {
-      ::grpc::Service::MarkMethodAsync(1);
+      ::grpc::Service::MarkMethodAsync(2);
     }
     ~WithAsyncMethod_Recognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -289,7 +309,7 @@ class KaldiServe final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestRecognize(::grpc::ServerContext* context, ::kaldi_serve::RecognizeRequest* request, ::grpc::ServerAsyncResponseWriter< ::kaldi_serve::RecognizeResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -298,7 +318,7 @@ class KaldiServe final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_StreamingRecognize() {
-      ::grpc::Service::MarkMethodAsync(2);
+      ::grpc::Service::MarkMethodAsync(3);
     }
     ~WithAsyncMethod_StreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -309,7 +329,7 @@ class KaldiServe final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestStreamingRecognize(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::kaldi_serve::RecognizeResponse, ::kaldi_serve::RecognizeRequest>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncClientStreaming(2, context, reader, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncClientStreaming(3, context, reader, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -318,7 +338,7 @@ class KaldiServe final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_BidiStreamingRecognize() {
-      ::grpc::Service::MarkMethodAsync(3);
+      ::grpc::Service::MarkMethodAsync(4);
     }
     ~WithAsyncMethod_BidiStreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -329,41 +349,47 @@ class KaldiServe final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestBidiStreamingRecognize(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::kaldi_serve::RecognizeResponse, ::kaldi_serve::RecognizeRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_BatchRecognize : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_BatchRecognize() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_BatchRecognize() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BatchRecognize(::grpc::ServerContext* /*context*/, const ::kaldi_serve::BatchRecognizeRequest* /*request*/, ::grpc::ServerWriter< ::kaldi_serve::BatchRecognizeResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestBatchRecognize(::grpc::ServerContext* context, ::kaldi_serve::BatchRecognizeRequest* request, ::grpc::ServerAsyncWriter< ::kaldi_serve::BatchRecognizeResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(5, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_ListModels<WithAsyncMethod_Recognize<WithAsyncMethod_StreamingRecognize<WithAsyncMethod_BidiStreamingRecognize<Service > > > > AsyncService;
+  typedef WithAsyncMethod_ListModels<WithAsyncMethod_GetServerStats<WithAsyncMethod_Recognize<WithAsyncMethod_StreamingRecognize<WithAsyncMethod_BidiStreamingRecognize<WithAsyncMethod_BatchRecognize<Service > > > > > > AsyncService;
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_ListModels : public BaseClass {
+  class WithCallbackMethod_ListModels : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_ListModels() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodCallback(0,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::kaldi_serve::ModelList>(
+    WithCallbackMethod_ListModels() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::kaldi_serve::ModelList>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response) { return this->ListModels(context, request, response); }));}
+                   ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ModelList* response) { return this->ListModels(context, request, response); }));}
     void SetMessageAllocatorFor_ListModels(
-        ::grpc::experimental::MessageAllocator< ::google::protobuf::Empty, ::kaldi_serve::ModelList>* allocator) {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+        ::grpc::MessageAllocator< ::google::protobuf::Empty, ::kaldi_serve::ModelList>* allocator) {
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-    #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(0);
-    #endif
-      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::kaldi_serve::ModelList>*>(handler)
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::kaldi_serve::ModelList>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~ExperimentalWithCallbackMethod_ListModels() override {
+    ~WithCallbackMethod_ListModels() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -371,46 +397,53 @@ class KaldiServe final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerUnaryReactor* ListModels(
-      ::grpc::CallbackServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ModelList* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerUnaryReactor* ListModels(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ModelList* /*response*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ModelList* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_Recognize : public BaseClass {
+  class WithCallbackMethod_GetServerStats : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_Recognize() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodCallback(1,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(
+    WithCallbackMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::kaldi_serve::ServerStats>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response) { return this->Recognize(context, request, response); }));}
-    void SetMessageAllocatorFor_Recognize(
-        ::grpc::experimental::MessageAllocator< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* allocator) {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::kaldi_serve::ServerStats* response) { return this->GetServerStats(context, request, response); }));}
+    void SetMessageAllocatorFor_GetServerStats(
+        ::grpc::MessageAllocator< ::google::protobuf::Empty, ::kaldi_serve::ServerStats>* allocator) {
       ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-    #else
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(1);
-    #endif
-      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>*>(handler)
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::kaldi_serve::ServerStats>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetServerStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ServerStats* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Recognize : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Recognize() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::kaldi_serve::RecognizeRequest* request, ::kaldi_serve::RecognizeResponse* response) { return this->Recognize(context, request, response); }));}
+    void SetMessageAllocatorFor_Recognize(
+        ::grpc::MessageAllocator< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>*>(handler)
               ->SetMessageAllocator(allocator);
     }
-    ~ExperimentalWithCallbackMethod_Recognize() override {
+    ~WithCallbackMethod_Recognize() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -418,37 +451,21 @@ class KaldiServe final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerUnaryReactor* Recognize(
-      ::grpc::CallbackServerContext* /*context*/, const ::kaldi_serve::RecognizeRequest* /*request*/, ::kaldi_serve::RecognizeResponse* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerUnaryReactor* Recognize(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::kaldi_serve::RecognizeRequest* /*request*/, ::kaldi_serve::RecognizeResponse* /*response*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, const ::kaldi_serve::RecognizeRequest* /*request*/, ::kaldi_serve::RecognizeResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_StreamingRecognize : public BaseClass {
+  class WithCallbackMethod_StreamingRecognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_StreamingRecognize() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodCallback(2,
-          new ::grpc_impl::internal::CallbackClientStreamingHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(
+    WithCallbackMethod_StreamingRecognize() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, ::kaldi_serve::RecognizeResponse* response) { return this->StreamingRecognize(context, response); }));
+                   ::grpc::CallbackServerContext* context, ::kaldi_serve::RecognizeResponse* response) { return this->StreamingRecognize(context, response); }));
     }
-    ~ExperimentalWithCallbackMethod_StreamingRecognize() override {
+    ~WithCallbackMethod_StreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -456,37 +473,21 @@ class KaldiServe final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerReadReactor< ::kaldi_serve::RecognizeRequest>* StreamingRecognize(
-      ::grpc::CallbackServerContext* /*context*/, ::kaldi_serve::RecognizeResponse* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerReadReactor< ::kaldi_serve::RecognizeRequest>* StreamingRecognize(
-      ::grpc::experimental::CallbackServerContext* /*context*/, ::kaldi_serve::RecognizeResponse* /*response*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, ::kaldi_serve::RecognizeResponse* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithCallbackMethod_BidiStreamingRecognize : public BaseClass {
+  class WithCallbackMethod_BidiStreamingRecognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithCallbackMethod_BidiStreamingRecognize() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodCallback(3,
-          new ::grpc_impl::internal::CallbackBidiHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(
+    WithCallbackMethod_BidiStreamingRecognize() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context) { return this->BidiStreamingRecognize(context); }));
+                   ::grpc::CallbackServerContext* context) { return this->BidiStreamingRecognize(context); }));
     }
-    ~ExperimentalWithCallbackMethod_BidiStreamingRecognize() override {
+    ~WithCallbackMethod_BidiStreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -494,20 +495,34 @@ class KaldiServe final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerBidiReactor< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* BidiStreamingRecognize(
       ::grpc::CallbackServerContext* /*context*/)
-    #else
-    virtual ::grpc::experimental::ServerBidiReactor< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* BidiStreamingRecognize(
-      ::grpc::experimental::CallbackServerContext* /*context*/)
-    #endif
       { return nullptr; }
   };
-  #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_ListModels<ExperimentalWithCallbackMethod_Recognize<ExperimentalWithCallbackMethod_StreamingRecognize<ExperimentalWithCallbackMethod_BidiStreamingRecognize<Service > > > > CallbackService;
-  #endif
-
-  typedef ExperimentalWithCallbackMethod_ListModels<ExperimentalWithCallbackMethod_Recognize<ExperimentalWithCallbackMethod_StreamingRecognize<ExperimentalWithCallbackMethod_BidiStreamingRecognize<Service > > > > ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_BatchRecognize : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_BatchRecognize() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::kaldi_serve::BatchRecognizeRequest, ::kaldi_serve::BatchRecognizeResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::kaldi_serve::BatchRecognizeRequest* request) { return this->BatchRecognize(context, request); }));
+    }
+    ~WithCallbackMethod_BatchRecognize() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BatchRecognize(::grpc::ServerContext* /*context*/, const ::kaldi_serve::BatchRecognizeRequest* /*request*/, ::grpc::ServerWriter< ::kaldi_serve::BatchRecognizeResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::kaldi_serve::BatchRecognizeResponse>* BatchRecognize(
+      ::grpc::CallbackServerContext* /*context*/, const ::kaldi_serve::BatchRecognizeRequest* /*request*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_ListModels<WithCallbackMethod_GetServerStats<WithCallbackMethod_Recognize<WithCallbackMethod_StreamingRecognize<WithCallbackMethod_BidiStreamingRecognize<WithCallbackMethod_BatchRecognize<Service > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_ListModels : public BaseClass {
    private:
@@ -526,12 +541,29 @@ class KaldiServe final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithGenericMethod_Recognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_Recognize() {
-      ::grpc::Service::MarkMethodGeneric(1);
+      ::grpc::Service::MarkMethodGeneric(2);
     }
     ~WithGenericMethod_Recognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -548,7 +580,7 @@ class KaldiServe final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_StreamingRecognize() {
-      ::grpc::Service::MarkMethodGeneric(2);
+      ::grpc::Service::MarkMethodGeneric(3);
     }
     ~WithGenericMethod_StreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -565,7 +597,7 @@ class KaldiServe final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithGenericMethod_BidiStreamingRecognize() {
-      ::grpc::Service::MarkMethodGeneric(3);
+      ::grpc::Service::MarkMethodGeneric(4);
     }
     ~WithGenericMethod_BidiStreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -577,6 +609,23 @@ class KaldiServe final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_BatchRecognize : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_BatchRecognize() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_BatchRecognize() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BatchRecognize(::grpc::ServerContext* /*context*/, const ::kaldi_serve::BatchRecognizeRequest* /*request*/, ::grpc::ServerWriter< ::kaldi_serve::BatchRecognizeResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_ListModels : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -597,12 +646,32 @@ class KaldiServe final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetServerStats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Recognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_Recognize() {
-      ::grpc::Service::MarkMethodRaw(1);
+      ::grpc::Service::MarkMethodRaw(2);
     }
     ~WithRawMethod_Recognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -613,7 +682,7 @@ class KaldiServe final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestRecognize(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -622,7 +691,7 @@ class KaldiServe final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_StreamingRecognize() {
-      ::grpc::Service::MarkMethodRaw(2);
+      ::grpc::Service::MarkMethodRaw(3);
     }
     ~WithRawMethod_StreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -633,7 +702,7 @@ class KaldiServe final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestStreamingRecognize(::grpc::ServerContext* context, ::grpc::ServerAsyncReader< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* reader, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncClientStreaming(2, context, reader, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncClientStreaming(3, context, reader, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -642,7 +711,7 @@ class KaldiServe final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_BidiStreamingRecognize() {
-      ::grpc::Service::MarkMethodRaw(3);
+      ::grpc::Service::MarkMethodRaw(4);
     }
     ~WithRawMethod_BidiStreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -653,31 +722,41 @@ class KaldiServe final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestBidiStreamingRecognize(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncBidiStreaming(3, context, stream, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncBidiStreaming(4, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_BatchRecognize : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_BatchRecognize() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_BatchRecognize() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BatchRecognize(::grpc::ServerContext* /*context*/, const ::kaldi_serve::BatchRecognizeRequest* /*request*/, ::grpc::ServerWriter< ::kaldi_serve::BatchRecognizeResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestBatchRecognize(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(5, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
-  class ExperimentalWithRawCallbackMethod_ListModels : public BaseClass {
+  class WithRawCallbackMethod_ListModels : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithRawCallbackMethod_ListModels() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodRawCallback(0,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawCallbackMethod_ListModels() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ListModels(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ListModels(context, request, response); }));
     }
-    ~ExperimentalWithRawCallbackMethod_ListModels() override {
+    ~WithRawCallbackMethod_ListModels() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -685,37 +764,43 @@ class KaldiServe final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerUnaryReactor* ListModels(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerUnaryReactor* ListModels(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetServerStats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetServerStats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithRawCallbackMethod_Recognize : public BaseClass {
+  class WithRawCallbackMethod_Recognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithRawCallbackMethod_Recognize() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodRawCallback(1,
-          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawCallbackMethod_Recognize() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Recognize(context, request, response); }));
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Recognize(context, request, response); }));
     }
-    ~ExperimentalWithRawCallbackMethod_Recognize() override {
+    ~WithRawCallbackMethod_Recognize() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -723,37 +808,21 @@ class KaldiServe final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerUnaryReactor* Recognize(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerUnaryReactor* Recognize(
-      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithRawCallbackMethod_StreamingRecognize : public BaseClass {
+  class WithRawCallbackMethod_StreamingRecognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithRawCallbackMethod_StreamingRecognize() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodRawCallback(2,
-          new ::grpc_impl::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawCallbackMethod_StreamingRecognize() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackClientStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context, ::grpc::ByteBuffer* response) { return this->StreamingRecognize(context, response); }));
+                   ::grpc::CallbackServerContext* context, ::grpc::ByteBuffer* response) { return this->StreamingRecognize(context, response); }));
     }
-    ~ExperimentalWithRawCallbackMethod_StreamingRecognize() override {
+    ~WithRawCallbackMethod_StreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -761,37 +830,21 @@ class KaldiServe final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerReadReactor< ::grpc::ByteBuffer>* StreamingRecognize(
-      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)
-    #else
-    virtual ::grpc::experimental::ServerReadReactor< ::grpc::ByteBuffer>* StreamingRecognize(
-      ::grpc::experimental::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)
-    #endif
-      { return nullptr; }
+      ::grpc::CallbackServerContext* /*context*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
-  class ExperimentalWithRawCallbackMethod_BidiStreamingRecognize : public BaseClass {
+  class WithRawCallbackMethod_BidiStreamingRecognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    ExperimentalWithRawCallbackMethod_BidiStreamingRecognize() {
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-      ::grpc::Service::
-    #else
-      ::grpc::Service::experimental().
-    #endif
-        MarkMethodRawCallback(3,
-          new ::grpc_impl::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+    WithRawCallbackMethod_BidiStreamingRecognize() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-                   ::grpc::CallbackServerContext*
-    #else
-                   ::grpc::experimental::CallbackServerContext*
-    #endif
-                     context) { return this->BidiStreamingRecognize(context); }));
+                   ::grpc::CallbackServerContext* context) { return this->BidiStreamingRecognize(context); }));
     }
-    ~ExperimentalWithRawCallbackMethod_BidiStreamingRecognize() override {
+    ~WithRawCallbackMethod_BidiStreamingRecognize() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
@@ -799,23 +852,47 @@ class KaldiServe final {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* BidiStreamingRecognize(
       ::grpc::CallbackServerContext* /*context*/)
-    #else
-    virtual ::grpc::experimental::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* BidiStreamingRecognize(
-      ::grpc::experimental::CallbackServerContext* /*context*/)
-    #endif
       { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_BatchRecognize : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_BatchRecognize() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->BatchRecognize(context, request); }));
+    }
+    ~WithRawCallbackMethod_BatchRecognize() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BatchRecognize(::grpc::ServerContext* /*context*/, const ::kaldi_serve::BatchRecognizeRequest* /*request*/, ::grpc::ServerWriter< ::kaldi_serve::BatchRecognizeResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* BatchRecognize(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_ListModels : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_ListModels() {
       ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler< ::google::protobuf::Empty, ::kaldi_serve::ModelList>(std::bind(&WithStreamedUnaryMethod_ListModels<BaseClass>::StreamedListModels, this, std::placeholders::_1, std::placeholders::_2)));
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::google::protobuf::Empty, ::kaldi_serve::ModelList>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::google::protobuf::Empty, ::kaldi_serve::ModelList>* streamer) {
+                       return this->StreamedListModels(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_ListModels() override {
       BaseClassMustBeDerivedFromService(this);
@@ -829,13 +906,47 @@ class KaldiServe final {
     virtual ::grpc::Status StreamedListModels(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::kaldi_serve::ModelList>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_GetServerStats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetServerStats() {
+      ::grpc::Service::MarkMethodStreamed(1,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::google::protobuf::Empty, ::kaldi_serve::ServerStats>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::google::protobuf::Empty, ::kaldi_serve::ServerStats>* streamer) {
+                       return this->StreamedGetServerStats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetServerStats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetServerStats(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::kaldi_serve::ServerStats* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetServerStats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::kaldi_serve::ServerStats>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Recognize : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_Recognize() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler< ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(std::bind(&WithStreamedUnaryMethod_Recognize<BaseClass>::StreamedRecognize, this, std::placeholders::_1, std::placeholders::_2)));
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::kaldi_serve::RecognizeRequest, ::kaldi_serve::RecognizeResponse>* streamer) {
+                       return this->StreamedRecognize(context,
+                         streamer);
+                  }));
     }
     ~WithStreamedUnaryMethod_Recognize() override {
       BaseClassMustBeDerivedFromService(this);
@@ -848,9 +959,36 @@ class KaldiServe final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedRecognize(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::kaldi_serve::RecognizeRequest,::kaldi_serve::RecognizeResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_ListModels<WithStreamedUnaryMethod_Recognize<Service > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_ListModels<WithStreamedUnaryMethod_Recognize<Service > > StreamedService;
+  typedef WithStreamedUnaryMethod_ListModels<WithStreamedUnaryMethod_GetServerStats<WithStreamedUnaryMethod_Recognize<Service > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_BatchRecognize : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_BatchRecognize() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::kaldi_serve::BatchRecognizeRequest, ::kaldi_serve::BatchRecognizeResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::kaldi_serve::BatchRecognizeRequest, ::kaldi_serve::BatchRecognizeResponse>* streamer) {
+                       return this->StreamedBatchRecognize(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_BatchRecognize() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status BatchRecognize(::grpc::ServerContext* /*context*/, const ::kaldi_serve::BatchRecognizeRequest* /*request*/, ::grpc::ServerWriter< ::kaldi_serve::BatchRecognizeResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedBatchRecognize(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::kaldi_serve::BatchRecognizeRequest,::kaldi_serve::BatchRecognizeResponse>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_BatchRecognize<Service > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_ListModels<WithStreamedUnaryMethod_GetServerStats<WithStreamedUnaryMethod_Recognize<WithSplitStreamingMethod_BatchRecognize<Service > > > > StreamedService;
 };
 
 }  // namespace kaldi_serve
@@ -14,386 +14,580 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Model_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RecognitionAudio_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RecognitionConfig_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SpeechContext_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_kaldi_5fserve_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Word_kaldi_5fserve_2eproto;
-namespace kaldi_serve {
-class ModelListDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ModelList> _instance;
-} _ModelList_default_instance_;
-class ModelDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Model> _instance;
-} _Model_default_instance_;
-class RecognizeRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RecognizeRequest> _instance;
-} _RecognizeRequest_default_instance_;
-class RecognizeResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RecognizeResponse> _instance;
-} _RecognizeResponse_default_instance_;
-class RecognitionConfigDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RecognitionConfig> _instance;
-} _RecognitionConfig_default_instance_;
-class RecognitionAudioDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RecognitionAudio> _instance;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
-} _RecognitionAudio_default_instance_;
-class SpeechRecognitionResultDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SpeechRecognitionResult> _instance;
-} _SpeechRecognitionResult_default_instance_;
-class SpeechRecognitionAlternativeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SpeechRecognitionAlternative> _instance;
-} _SpeechRecognitionAlternative_default_instance_;
-class WordDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Word> _instance;
-} _Word_default_instance_;
-class SpeechContextDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SpeechContext> _instance;
-} _SpeechContext_default_instance_;
-}  // namespace kaldi_serve
-static void InitDefaultsscc_info_Model_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_Model_default_instance_;
-    new (ptr) ::kaldi_serve::Model();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::Model::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Model_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Model_kaldi_5fserve_2eproto}, {}};
-
-static void InitDefaultsscc_info_ModelList_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_ModelList_default_instance_;
-    new (ptr) ::kaldi_serve::ModelList();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::ModelList::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ModelList_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_ModelList_kaldi_5fserve_2eproto}, {
-      &scc_info_Model_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsscc_info_RecognitionAudio_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_RecognitionAudio_default_instance_;
-    new (ptr) ::kaldi_serve::RecognitionAudio();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::RecognitionAudio::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RecognitionAudio_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RecognitionAudio_kaldi_5fserve_2eproto}, {}};
-
-static void InitDefaultsscc_info_RecognitionConfig_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_RecognitionConfig_default_instance_;
-    new (ptr) ::kaldi_serve::RecognitionConfig();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::RecognitionConfig::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RecognitionConfig_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_RecognitionConfig_kaldi_5fserve_2eproto}, {
-      &scc_info_SpeechContext_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsscc_info_RecognizeRequest_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::kaldi_serve::_RecognizeRequest_default_instance_;
-    new (ptr) ::kaldi_serve::RecognizeRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::RecognizeRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_RecognizeRequest_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_RecognizeRequest_kaldi_5fserve_2eproto}, {
-      &scc_info_RecognitionConfig_kaldi_5fserve_2eproto.base,
-      &scc_info_RecognitionAudio_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsscc_info_RecognizeResponse_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_RecognizeResponse_default_instance_;
-    new (ptr) ::kaldi_serve::RecognizeResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::RecognizeResponse::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RecognizeResponse_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_RecognizeResponse_kaldi_5fserve_2eproto}, {
-      &scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsscc_info_SpeechContext_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_SpeechContext_default_instance_;
-    new (ptr) ::kaldi_serve::SpeechContext();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::SpeechContext::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SpeechContext_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_SpeechContext_kaldi_5fserve_2eproto}, {}};
-
-static void InitDefaultsscc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_SpeechRecognitionAlternative_default_instance_;
-    new (ptr) ::kaldi_serve::SpeechRecognitionAlternative();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::SpeechRecognitionAlternative::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto}, {
-      &scc_info_Word_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsscc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::kaldi_serve::_SpeechRecognitionResult_default_instance_;
-    new (ptr) ::kaldi_serve::SpeechRecognitionResult();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::SpeechRecognitionResult::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto}, {
-      &scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto.base,}};
-
-static void InitDefaultsscc_info_Word_kaldi_5fserve_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::kaldi_serve::_Word_default_instance_;
-    new (ptr) ::kaldi_serve::Word();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::kaldi_serve::Word::InitAsDefaultInstance();
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Word_kaldi_5fserve_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Word_kaldi_5fserve_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_kaldi_5fserve_2eproto[10];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_kaldi_5fserve_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_kaldi_5fserve_2eproto = nullptr;
+namespace kaldi_serve {
+PROTOBUF_CONSTEXPR ModelList::ModelList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.models_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModelListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModelListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModelListDefaultTypeInternal() {}
+  union {
+    ModelList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModelListDefaultTypeInternal _ModelList_default_instance_;
+PROTOBUF_CONSTEXPR Model::Model(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.language_code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModelDefaultTypeInternal() {}
+  union {
+    Model _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModelDefaultTypeInternal _Model_default_instance_;
+PROTOBUF_CONSTEXPR ServerStats::ServerStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.models_)*/{}
+  , /*decltype(_impl_.memory_rss_bytes_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatsDefaultTypeInternal() {}
+  union {
+    ServerStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatsDefaultTypeInternal _ServerStats_default_instance_;
+PROTOBUF_CONSTEXPR ModelStats::ModelStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.model_)*/nullptr
+  , /*decltype(_impl_.memory_)*/nullptr
+  , /*decltype(_impl_.decoders_)*/0
+  , /*decltype(_impl_.idle_decoders_)*/0
+  , /*decltype(_impl_.max_decoders_)*/0
+  , /*decltype(_impl_.waiting_requests_)*/0
+  , /*decltype(_impl_.real_time_factor_)*/0
+  , /*decltype(_impl_.decoder_hold_secs_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModelStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModelStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModelStatsDefaultTypeInternal() {}
+  union {
+    ModelStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModelStatsDefaultTypeInternal _ModelStats_default_instance_;
+PROTOBUF_CONSTEXPR ModelMemory::ModelMemory(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hclg_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.am_nnet_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.ivector_extractor_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.rnnlm_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.word_embedding_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.lm_fst_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.word_syms_bytes_)*/int64_t{0}
+  , /*decltype(_impl_.total_bytes_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ModelMemoryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ModelMemoryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ModelMemoryDefaultTypeInternal() {}
+  union {
+    ModelMemory _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModelMemoryDefaultTypeInternal _ModelMemory_default_instance_;
+PROTOBUF_CONSTEXPR RecognizeRequest::RecognizeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tenant_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.audio_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecognizeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecognizeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecognizeRequestDefaultTypeInternal() {}
+  union {
+    RecognizeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecognizeRequestDefaultTypeInternal _RecognizeRequest_default_instance_;
+PROTOBUF_CONSTEXPR BatchRecognizeRequest::BatchRecognizeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.audios_)*/{}
+  , /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.tenant_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.config_)*/nullptr
+  , /*decltype(_impl_.max_parallel_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchRecognizeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchRecognizeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchRecognizeRequestDefaultTypeInternal() {}
+  union {
+    BatchRecognizeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchRecognizeRequestDefaultTypeInternal _BatchRecognizeRequest_default_instance_;
+PROTOBUF_CONSTEXPR BatchRecognizeResponse::BatchRecognizeResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.response_)*/nullptr
+  , /*decltype(_impl_.index_)*/0
+  , /*decltype(_impl_.error_code_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchRecognizeResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchRecognizeResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchRecognizeResponseDefaultTypeInternal() {}
+  union {
+    BatchRecognizeResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchRecognizeResponseDefaultTypeInternal _BatchRecognizeResponse_default_instance_;
+PROTOBUF_CONSTEXPR RecognizeResponse::RecognizeResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.usage_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecognizeResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecognizeResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecognizeResponseDefaultTypeInternal() {}
+  union {
+    RecognizeResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecognizeResponseDefaultTypeInternal _RecognizeResponse_default_instance_;
+PROTOBUF_CONSTEXPR ResourceUsage::ResourceUsage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.audio_secs_)*/0
+  , /*decltype(_impl_.cpu_secs_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResourceUsageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResourceUsageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResourceUsageDefaultTypeInternal() {}
+  union {
+    ResourceUsage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResourceUsageDefaultTypeInternal _ResourceUsage_default_instance_;
+PROTOBUF_CONSTEXPR RecognitionConfig::RecognitionConfig(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.speech_contexts_)*/{}
+  , /*decltype(_impl_.language_code_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.model_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_.sample_rate_hertz_)*/0
+  , /*decltype(_impl_.max_alternatives_)*/0
+  , /*decltype(_impl_.audio_channel_count_)*/0
+  , /*decltype(_impl_.punctuation_)*/false
+  , /*decltype(_impl_.raw_)*/false
+  , /*decltype(_impl_.word_level_)*/false
+  , /*decltype(_impl_.report_usage_)*/false
+  , /*decltype(_impl_.data_bytes_)*/0
+  , /*decltype(_impl_.priority_)*/0
+  , /*decltype(_impl_.interim_results_on_change_)*/false
+  , /*decltype(_impl_.continuous_)*/false
+  , /*decltype(_impl_.parallel_segments_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecognitionConfigDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecognitionConfigDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecognitionConfigDefaultTypeInternal() {}
+  union {
+    RecognitionConfig _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecognitionConfigDefaultTypeInternal _RecognitionConfig_default_instance_;
+PROTOBUF_CONSTEXPR RecognitionAudio::RecognitionAudio(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.audio_source_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct RecognitionAudioDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecognitionAudioDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecognitionAudioDefaultTypeInternal() {}
+  union {
+    RecognitionAudio _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecognitionAudioDefaultTypeInternal _RecognitionAudio_default_instance_;
+PROTOBUF_CONSTEXPR SpeechRecognitionResult::SpeechRecognitionResult(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.alternatives_)*/{}
+  , /*decltype(_impl_.is_final_)*/false
+  , /*decltype(_impl_.stability_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpeechRecognitionResultDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpeechRecognitionResultDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpeechRecognitionResultDefaultTypeInternal() {}
+  union {
+    SpeechRecognitionResult _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpeechRecognitionResultDefaultTypeInternal _SpeechRecognitionResult_default_instance_;
+PROTOBUF_CONSTEXPR SpeechRecognitionAlternative::SpeechRecognitionAlternative(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.words_)*/{}
+  , /*decltype(_impl_.transcript_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.confidence_)*/0
+  , /*decltype(_impl_.am_score_)*/0
+  , /*decltype(_impl_.lm_score_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpeechRecognitionAlternativeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpeechRecognitionAlternativeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpeechRecognitionAlternativeDefaultTypeInternal() {}
+  union {
+    SpeechRecognitionAlternative _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpeechRecognitionAlternativeDefaultTypeInternal _SpeechRecognitionAlternative_default_instance_;
+PROTOBUF_CONSTEXPR Word::Word(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.word_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.start_time_)*/0
+  , /*decltype(_impl_.end_time_)*/0
+  , /*decltype(_impl_.confidence_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WordDefaultTypeInternal() {}
+  union {
+    Word _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WordDefaultTypeInternal _Word_default_instance_;
+PROTOBUF_CONSTEXPR SpeechContext::SpeechContext(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.phrases_)*/{}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SpeechContextDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SpeechContextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SpeechContextDefaultTypeInternal() {}
+  union {
+    SpeechContext _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SpeechContextDefaultTypeInternal _SpeechContext_default_instance_;
+}  // namespace kaldi_serve
+static ::_pb::Metadata file_level_metadata_kaldi_5fserve_2eproto[16];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_kaldi_5fserve_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_kaldi_5fserve_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_kaldi_5fserve_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_kaldi_5fserve_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelList, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelList, models_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelList, _impl_.models_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::Model, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Model, name_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Model, language_code_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Model, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Model, _impl_.language_code_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ServerStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ServerStats, _impl_.models_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ServerStats, _impl_.memory_rss_bytes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _impl_.model_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _impl_.decoders_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _impl_.idle_decoders_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _impl_.max_decoders_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _impl_.waiting_requests_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _impl_.real_time_factor_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _impl_.decoder_hold_secs_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelStats, _impl_.memory_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _impl_.hclg_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _impl_.am_nnet_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _impl_.ivector_extractor_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _impl_.rnnlm_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _impl_.word_embedding_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _impl_.lm_fst_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _impl_.word_syms_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ModelMemory, _impl_.total_bytes_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, config_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, audio_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, uuid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _impl_.config_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _impl_.audio_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _impl_.uuid_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeRequest, _impl_.tenant_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeRequest, _impl_.config_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeRequest, _impl_.audios_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeRequest, _impl_.uuid_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeRequest, _impl_.tenant_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeRequest, _impl_.max_parallel_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeResponse, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeResponse, _impl_.response_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeResponse, _impl_.error_code_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::BatchRecognizeResponse, _impl_.error_message_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, results_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, _impl_.results_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognizeResponse, _impl_.usage_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ResourceUsage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ResourceUsage, _impl_.audio_secs_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::ResourceUsage, _impl_.cpu_secs_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, encoding_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, sample_rate_hertz_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, language_code_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, max_alternatives_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, punctuation_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, speech_contexts_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, audio_channel_count_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, model_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, raw_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, data_bytes_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, word_level_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.encoding_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.sample_rate_hertz_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.language_code_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.max_alternatives_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.punctuation_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.speech_contexts_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.audio_channel_count_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.model_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.raw_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.data_bytes_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.word_level_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.priority_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.report_usage_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.interim_results_on_change_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.continuous_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionConfig, _impl_.parallel_segments_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  offsetof(::kaldi_serve::RecognitionAudioDefaultTypeInternal, content_),
-  offsetof(::kaldi_serve::RecognitionAudioDefaultTypeInternal, uri_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, audio_source_),
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::RecognitionAudio, _impl_.audio_source_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionResult, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionResult, alternatives_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionResult, _impl_.alternatives_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionResult, _impl_.is_final_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionResult, _impl_.stability_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, transcript_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, confidence_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, am_score_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, lm_score_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, words_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.transcript_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.confidence_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.am_score_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.lm_score_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechRecognitionAlternative, _impl_.words_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, start_time_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, end_time_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, word_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, confidence_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _impl_.start_time_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _impl_.end_time_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _impl_.word_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::Word, _impl_.confidence_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, phrases_),
-  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, type_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, _impl_.phrases_),
+  PROTOBUF_FIELD_OFFSET(::kaldi_serve::SpeechContext, _impl_.type_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::kaldi_serve::ModelList)},
-  { 6, -1, sizeof(::kaldi_serve::Model)},
-  { 13, -1, sizeof(::kaldi_serve::RecognizeRequest)},
-  { 21, -1, sizeof(::kaldi_serve::RecognizeResponse)},
-  { 27, -1, sizeof(::kaldi_serve::RecognitionConfig)},
-  { 43, -1, sizeof(::kaldi_serve::RecognitionAudio)},
-  { 51, -1, sizeof(::kaldi_serve::SpeechRecognitionResult)},
-  { 57, -1, sizeof(::kaldi_serve::SpeechRecognitionAlternative)},
-  { 67, -1, sizeof(::kaldi_serve::Word)},
-  { 76, -1, sizeof(::kaldi_serve::SpeechContext)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::kaldi_serve::ModelList)},
+  { 7, -1, -1, sizeof(::kaldi_serve::Model)},
+  { 15, -1, -1, sizeof(::kaldi_serve::ServerStats)},
+  { 23, -1, -1, sizeof(::kaldi_serve::ModelStats)},
+  { 37, -1, -1, sizeof(::kaldi_serve::ModelMemory)},
+  { 51, -1, -1, sizeof(::kaldi_serve::RecognizeRequest)},
+  { 61, -1, -1, sizeof(::kaldi_serve::BatchRecognizeRequest)},
+  { 72, -1, -1, sizeof(::kaldi_serve::BatchRecognizeResponse)},
+  { 82, -1, -1, sizeof(::kaldi_serve::RecognizeResponse)},
+  { 90, -1, -1, sizeof(::kaldi_serve::ResourceUsage)},
+  { 98, -1, -1, sizeof(::kaldi_serve::RecognitionConfig)},
+  { 120, -1, -1, sizeof(::kaldi_serve::RecognitionAudio)},
+  { 129, -1, -1, sizeof(::kaldi_serve::SpeechRecognitionResult)},
+  { 138, -1, -1, sizeof(::kaldi_serve::SpeechRecognitionAlternative)},
+  { 149, -1, -1, sizeof(::kaldi_serve::Word)},
+  { 159, -1, -1, sizeof(::kaldi_serve::SpeechContext)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_ModelList_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_Model_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_RecognizeRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_RecognizeResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_RecognitionConfig_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_RecognitionAudio_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_SpeechRecognitionResult_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_SpeechRecognitionAlternative_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_Word_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::kaldi_serve::_SpeechContext_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::kaldi_serve::_ModelList_default_instance_._instance,
+  &::kaldi_serve::_Model_default_instance_._instance,
+  &::kaldi_serve::_ServerStats_default_instance_._instance,
+  &::kaldi_serve::_ModelStats_default_instance_._instance,
+  &::kaldi_serve::_ModelMemory_default_instance_._instance,
+  &::kaldi_serve::_RecognizeRequest_default_instance_._instance,
+  &::kaldi_serve::_BatchRecognizeRequest_default_instance_._instance,
+  &::kaldi_serve::_BatchRecognizeResponse_default_instance_._instance,
+  &::kaldi_serve::_RecognizeResponse_default_instance_._instance,
+  &::kaldi_serve::_ResourceUsage_default_instance_._instance,
+  &::kaldi_serve::_RecognitionConfig_default_instance_._instance,
+  &::kaldi_serve::_RecognitionAudio_default_instance_._instance,
+  &::kaldi_serve::_SpeechRecognitionResult_default_instance_._instance,
+  &::kaldi_serve::_SpeechRecognitionAlternative_default_instance_._instance,
+  &::kaldi_serve::_Word_default_instance_._instance,
+  &::kaldi_serve::_SpeechContext_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_kaldi_5fserve_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\021kaldi_serve.proto\022\013kaldi_serve\032\033google"
   "/protobuf/empty.proto\"/\n\tModelList\022\"\n\006mo"
   "dels\030\001 \003(\0132\022.kaldi_serve.Model\",\n\005Model\022"
-  "\014\n\004name\030\001 \001(\t\022\025\n\rlanguage_code\030\002 \001(\t\"~\n\020"
-  "RecognizeRequest\022.\n\006config\030\001 \001(\0132\036.kaldi"
-  "_serve.RecognitionConfig\022,\n\005audio\030\002 \001(\0132"
-  "\035.kaldi_serve.RecognitionAudio\022\014\n\004uuid\030\003"
-  " \001(\t\"J\n\021RecognizeResponse\0225\n\007results\030\001 \003"
-  "(\0132$.kaldi_serve.SpeechRecognitionResult"
-  "\"\215\003\n\021RecognitionConfig\022>\n\010encoding\030\001 \001(\016"
-  "2,.kaldi_serve.RecognitionConfig.AudioEn"
-  "coding\022\031\n\021sample_rate_hertz\030\002 \001(\005\022\025\n\rlan"
-  "guage_code\030\003 \001(\t\022\030\n\020max_alternatives\030\004 \001"
-  "(\005\022\023\n\013punctuation\030\005 \001(\010\0223\n\017speech_contex"
-  "ts\030\006 \003(\0132\032.kaldi_serve.SpeechContext\022\033\n\023"
-  "audio_channel_count\030\007 \001(\005\022\r\n\005model\030\n \001(\t"
-  "\022\013\n\003raw\030\013 \001(\010\022\022\n\ndata_bytes\030\014 \001(\005\022\022\n\nwor"
-  "d_level\030\r \001(\010\"A\n\rAudioEncoding\022\030\n\024ENCODI"
-  "NG_UNSPECIFIED\020\000\022\014\n\010LINEAR16\020\001\022\010\n\004FLAC\020\002"
-  "\"D\n\020RecognitionAudio\022\021\n\007content\030\001 \001(\014H\000\022"
-  "\r\n\003uri\030\002 \001(\tH\000B\016\n\014audio_source\"Z\n\027Speech"
-  "RecognitionResult\022\?\n\014alternatives\030\001 \003(\0132"
-  ").kaldi_serve.SpeechRecognitionAlternati"
-  "ve\"\214\001\n\034SpeechRecognitionAlternative\022\022\n\nt"
-  "ranscript\030\001 \001(\t\022\022\n\nconfidence\030\002 \001(\002\022\020\n\010a"
-  "m_score\030\003 \001(\002\022\020\n\010lm_score\030\004 \001(\002\022 \n\005words"
-  "\030\005 \003(\0132\021.kaldi_serve.Word\"N\n\004Word\022\022\n\nsta"
-  "rt_time\030\001 \001(\002\022\020\n\010end_time\030\002 \001(\002\022\014\n\004word\030"
-  "\003 \001(\t\022\022\n\nconfidence\030\004 \001(\002\".\n\rSpeechConte"
-  "xt\022\017\n\007phrases\030\001 \003(\t\022\014\n\004type\030\002 \001(\t2\322\002\n\nKa"
-  "ldiServe\022>\n\nListModels\022\026.google.protobuf"
-  ".Empty\032\026.kaldi_serve.ModelList\"\000\022L\n\tReco"
-  "gnize\022\035.kaldi_serve.RecognizeRequest\032\036.k"
-  "aldi_serve.RecognizeResponse\"\000\022W\n\022Stream"
-  "ingRecognize\022\035.kaldi_serve.RecognizeRequ"
-  "est\032\036.kaldi_serve.RecognizeResponse\"\000(\001\022"
-  "]\n\026BidiStreamingRecognize\022\035.kaldi_serve."
-  "RecognizeRequest\032\036.kaldi_serve.Recognize"
-  "Response\"\000(\0010\001b\006proto3"
+  "\014\n\004name\030\001 \001(\t\022\025\n\rlanguage_code\030\002 \001(\t\"P\n\013"
+  "ServerStats\022\'\n\006models\030\001 \003(\0132\027.kaldi_serv"
+  "e.ModelStats\022\030\n\020memory_rss_bytes\030\002 \001(\003\"\347"
+  "\001\n\nModelStats\022!\n\005model\030\001 \001(\0132\022.kaldi_ser"
+  "ve.Model\022\020\n\010decoders\030\002 \001(\005\022\025\n\ridle_decod"
+  "ers\030\003 \001(\005\022\024\n\014max_decoders\030\004 \001(\005\022\030\n\020waiti"
+  "ng_requests\030\005 \001(\005\022\030\n\020real_time_factor\030\006 "
+  "\001(\002\022\031\n\021decoder_hold_secs\030\007 \001(\002\022(\n\006memory"
+  "\030\010 \001(\0132\030.kaldi_serve.ModelMemory\"\320\001\n\013Mod"
+  "elMemory\022\022\n\nhclg_bytes\030\001 \001(\003\022\025\n\ram_nnet_"
+  "bytes\030\002 \001(\003\022\037\n\027ivector_extractor_bytes\030\003"
+  " \001(\003\022\023\n\013rnnlm_bytes\030\004 \001(\003\022\034\n\024word_embedd"
+  "ing_bytes\030\005 \001(\003\022\024\n\014lm_fst_bytes\030\006 \001(\003\022\027\n"
+  "\017word_syms_bytes\030\007 \001(\003\022\023\n\013total_bytes\030\010 "
+  "\001(\003\"\216\001\n\020RecognizeRequest\022.\n\006config\030\001 \001(\013"
+  "2\036.kaldi_serve.RecognitionConfig\022,\n\005audi"
+  "o\030\002 \001(\0132\035.kaldi_serve.RecognitionAudio\022\014"
+  "\n\004uuid\030\003 \001(\t\022\016\n\006tenant\030\004 \001(\t\"\252\001\n\025BatchRe"
+  "cognizeRequest\022.\n\006config\030\001 \001(\0132\036.kaldi_s"
+  "erve.RecognitionConfig\022-\n\006audios\030\002 \003(\0132\035"
+  ".kaldi_serve.RecognitionAudio\022\014\n\004uuid\030\003 "
+  "\001(\t\022\016\n\006tenant\030\004 \001(\t\022\024\n\014max_parallel\030\005 \001("
+  "\005\"\204\001\n\026BatchRecognizeResponse\022\r\n\005index\030\001 "
+  "\001(\005\0220\n\010response\030\002 \001(\0132\036.kaldi_serve.Reco"
+  "gnizeResponse\022\022\n\nerror_code\030\003 \001(\005\022\025\n\rerr"
+  "or_message\030\004 \001(\t\"u\n\021RecognizeResponse\0225\n"
+  "\007results\030\001 \003(\0132$.kaldi_serve.SpeechRecog"
+  "nitionResult\022)\n\005usage\030\002 \001(\0132\032.kaldi_serv"
+  "e.ResourceUsage\"5\n\rResourceUsage\022\022\n\naudi"
+  "o_secs\030\001 \001(\002\022\020\n\010cpu_secs\030\002 \001(\002\"\351\004\n\021Recog"
+  "nitionConfig\022>\n\010encoding\030\001 \001(\0162,.kaldi_s"
+  "erve.RecognitionConfig.AudioEncoding\022\031\n\021"
+  "sample_rate_hertz\030\002 \001(\005\022\025\n\rlanguage_code"
+  "\030\003 \001(\t\022\030\n\020max_alternatives\030\004 \001(\005\022\023\n\013punc"
+  "tuation\030\005 \001(\010\0223\n\017speech_contexts\030\006 \003(\0132\032"
+  ".kaldi_serve.SpeechContext\022\033\n\023audio_chan"
+  "nel_count\030\007 \001(\005\022\r\n\005model\030\n \001(\t\022\013\n\003raw\030\013 "
+  "\001(\010\022\022\n\ndata_bytes\030\014 \001(\005\022\022\n\nword_level\030\r "
+  "\001(\010\0229\n\010priority\030\016 \001(\0162\'.kaldi_serve.Reco"
+  "gnitionConfig.Priority\022\024\n\014report_usage\030\017"
+  " \001(\010\022!\n\031interim_results_on_change\030\020 \001(\010\022"
+  "\022\n\ncontinuous\030\021 \001(\010\022\031\n\021parallel_segments"
+  "\030\022 \001(\005\"A\n\rAudioEncoding\022\030\n\024ENCODING_UNSP"
+  "ECIFIED\020\000\022\014\n\010LINEAR16\020\001\022\010\n\004FLAC\020\002\"7\n\010Pri"
+  "ority\022\030\n\024PRIORITY_UNSPECIFIED\020\000\022\007\n\003LOW\020\001"
+  "\022\010\n\004HIGH\020\002\"D\n\020RecognitionAudio\022\021\n\007conten"
+  "t\030\001 \001(\014H\000\022\r\n\003uri\030\002 \001(\tH\000B\016\n\014audio_source"
+  "\"\177\n\027SpeechRecognitionResult\022\?\n\014alternati"
+  "ves\030\001 \003(\0132).kaldi_serve.SpeechRecognitio"
+  "nAlternative\022\020\n\010is_final\030\002 \001(\010\022\021\n\tstabil"
+  "ity\030\003 \001(\002\"\214\001\n\034SpeechRecognitionAlternati"
+  "ve\022\022\n\ntranscript\030\001 \001(\t\022\022\n\nconfidence\030\002 \001"
+  "(\002\022\020\n\010am_score\030\003 \001(\002\022\020\n\010lm_score\030\004 \001(\002\022 "
+  "\n\005words\030\005 \003(\0132\021.kaldi_serve.Word\"N\n\004Word"
+  "\022\022\n\nstart_time\030\001 \001(\002\022\020\n\010end_time\030\002 \001(\002\022\014"
+  "\n\004word\030\003 \001(\t\022\022\n\nconfidence\030\004 \001(\002\".\n\rSpee"
+  "chContext\022\017\n\007phrases\030\001 \003(\t\022\014\n\004type\030\002 \001(\t"
+  "2\367\003\n\nKaldiServe\022>\n\nListModels\022\026.google.p"
+  "rotobuf.Empty\032\026.kaldi_serve.ModelList\"\000\022"
+  "D\n\016GetServerStats\022\026.google.protobuf.Empt"
+  "y\032\030.kaldi_serve.ServerStats\"\000\022L\n\tRecogni"
+  "ze\022\035.kaldi_serve.RecognizeRequest\032\036.kald"
+  "i_serve.RecognizeResponse\"\000\022W\n\022Streaming"
+  "Recognize\022\035.kaldi_serve.RecognizeRequest"
+  "\032\036.kaldi_serve.RecognizeResponse\"\000(\001\022]\n\026"
+  "BidiStreamingRecognize\022\035.kaldi_serve.Rec"
+  "ognizeRequest\032\036.kaldi_serve.RecognizeRes"
+  "ponse\"\000(\0010\001\022]\n\016BatchRecognize\022\".kaldi_se"
+  "rve.BatchRecognizeRequest\032#.kaldi_serve."
+  "BatchRecognizeResponse\"\0000\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_kaldi_5fserve_2eproto_deps[1] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_kaldi_5fserve_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_kaldi_5fserve_2eproto_sccs[10] = {
-  &scc_info_Model_kaldi_5fserve_2eproto.base,
-  &scc_info_ModelList_kaldi_5fserve_2eproto.base,
-  &scc_info_RecognitionAudio_kaldi_5fserve_2eproto.base,
-  &scc_info_RecognitionConfig_kaldi_5fserve_2eproto.base,
-  &scc_info_RecognizeRequest_kaldi_5fserve_2eproto.base,
-  &scc_info_RecognizeResponse_kaldi_5fserve_2eproto.base,
-  &scc_info_SpeechContext_kaldi_5fserve_2eproto.base,
-  &scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto.base,
-  &scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto.base,
-  &scc_info_Word_kaldi_5fserve_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_kaldi_5fserve_2eproto_once;
-static bool descriptor_table_kaldi_5fserve_2eproto_initialized = false;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kaldi_5fserve_2eproto = {
-  &descriptor_table_kaldi_5fserve_2eproto_initialized, descriptor_table_protodef_kaldi_5fserve_2eproto, "kaldi_serve.proto", 1542,
-  &descriptor_table_kaldi_5fserve_2eproto_once, descriptor_table_kaldi_5fserve_2eproto_sccs, descriptor_table_kaldi_5fserve_2eproto_deps, 10, 1,
-  schemas, file_default_instances, TableStruct_kaldi_5fserve_2eproto::offsets,
-  file_level_metadata_kaldi_5fserve_2eproto, 10, file_level_enum_descriptors_kaldi_5fserve_2eproto, file_level_service_descriptors_kaldi_5fserve_2eproto,
+static ::_pbi::once_flag descriptor_table_kaldi_5fserve_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_kaldi_5fserve_2eproto = {
+    false, false, 2914, descriptor_table_protodef_kaldi_5fserve_2eproto,
+    "kaldi_serve.proto",
+    &descriptor_table_kaldi_5fserve_2eproto_once, descriptor_table_kaldi_5fserve_2eproto_deps, 1, 16,
+    schemas, file_default_instances, TableStruct_kaldi_5fserve_2eproto::offsets,
+    file_level_metadata_kaldi_5fserve_2eproto, file_level_enum_descriptors_kaldi_5fserve_2eproto,
+    file_level_service_descriptors_kaldi_5fserve_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_kaldi_5fserve_2eproto_getter() {
+  return &descriptor_table_kaldi_5fserve_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_kaldi_5fserve_2eproto = (  ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_kaldi_5fserve_2eproto), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_kaldi_5fserve_2eproto(&descriptor_table_kaldi_5fserve_2eproto);
 namespace kaldi_serve {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RecognitionConfig_AudioEncoding_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kaldi_5fserve_2eproto);
@@ -410,77 +604,108 @@ bool RecognitionConfig_AudioEncoding_IsValid(int value) {
   }
 }
 
-#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 constexpr RecognitionConfig_AudioEncoding RecognitionConfig::ENCODING_UNSPECIFIED;
 constexpr RecognitionConfig_AudioEncoding RecognitionConfig::LINEAR16;
 constexpr RecognitionConfig_AudioEncoding RecognitionConfig::FLAC;
 constexpr RecognitionConfig_AudioEncoding RecognitionConfig::AudioEncoding_MIN;
 constexpr RecognitionConfig_AudioEncoding RecognitionConfig::AudioEncoding_MAX;
 constexpr int RecognitionConfig::AudioEncoding_ARRAYSIZE;
-#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RecognitionConfig_Priority_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_kaldi_5fserve_2eproto);
+  return file_level_enum_descriptors_kaldi_5fserve_2eproto[1];
+}
+bool RecognitionConfig_Priority_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr RecognitionConfig_Priority RecognitionConfig::PRIORITY_UNSPECIFIED;
+constexpr RecognitionConfig_Priority RecognitionConfig::LOW;
+constexpr RecognitionConfig_Priority RecognitionConfig::HIGH;
+constexpr RecognitionConfig_Priority RecognitionConfig::Priority_MIN;
+constexpr RecognitionConfig_Priority RecognitionConfig::Priority_MAX;
+constexpr int RecognitionConfig::Priority_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-void ModelList::InitAsDefaultInstance() {
-}
 class ModelList::_Internal {
  public:
 };
 
-ModelList::ModelList()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.ModelList)
+ModelList::ModelList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.ModelList)
 }
 ModelList::ModelList(const ModelList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      models_(from.models_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ModelList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.models_){from._impl_.models_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.ModelList)
 }
 
-void ModelList::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ModelList_kaldi_5fserve_2eproto.base);
+inline void ModelList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.models_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ModelList::~ModelList() {
   // @@protoc_insertion_point(destructor:kaldi_serve.ModelList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void ModelList::SharedDtor() {
+inline void ModelList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.models_.~RepeatedPtrField();
 }
 
 void ModelList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ModelList& ModelList::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ModelList_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ModelList::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.ModelList)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  models_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.models_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ModelList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ModelList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .kaldi_serve.Model models = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -488,45 +713,49 @@ const char* ModelList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ModelList::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ModelList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.ModelList)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.Model models = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_models_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_models_size()); i < n; i++) {
+    const auto& repfield = this->_internal_models(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_models(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.ModelList)
   return target;
@@ -536,56 +765,37 @@ size_t ModelList::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.ModelList)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.Model models = 1;
   total_size += 1UL * this->_internal_models_size();
-  for (const auto& msg : this->models_) {
+  for (const auto& msg : this->_impl_.models_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ModelList::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.ModelList)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ModelList* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ModelList>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.ModelList)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.ModelList)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModelList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ModelList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModelList::GetClassData() const { return &_class_data_; }
 
-void ModelList::MergeFrom(const ModelList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.ModelList)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  models_.MergeFrom(from.models_);
-}
+void ModelList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModelList*>(&to_msg);
+  auto& from = static_cast<const ModelList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.ModelList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void ModelList::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.ModelList)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.models_.MergeFrom(from._impl_.models_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ModelList::CopyFrom(const ModelList& from) {
@@ -601,132 +811,162 @@ bool ModelList::IsInitialized() const {
 
 void ModelList::InternalSwap(ModelList* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  models_.InternalSwap(&other->models_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.models_.InternalSwap(&other->_impl_.models_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ModelList::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void Model::InitAsDefaultInstance() {
-}
 class Model::_Internal {
  public:
 };
 
-Model::Model()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.Model)
+Model::Model(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.Model)
 }
 Model::Model(const Model& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Model* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.language_code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
-  language_code_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.language_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_language_code().empty()) {
-    language_code_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.language_code_);
+    _this->_impl_.language_code_.Set(from._internal_language_code(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.Model)
 }
 
-void Model::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Model_kaldi_5fserve_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  language_code_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Model::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.language_code_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.language_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Model::~Model() {
   // @@protoc_insertion_point(destructor:kaldi_serve.Model)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Model::SharedDtor() {
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  language_code_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Model::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.language_code_.Destroy();
 }
 
 void Model::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Model& Model::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Model_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Model::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.Model)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  language_code_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.language_code_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Model::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Model::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.Model.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.Model.name"));
+        } else
+          goto handle_unusual;
         continue;
       // string language_code = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_language_code();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.Model.language_code"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.Model.language_code"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Model::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Model::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.Model)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -736,7 +976,7 @@ failure:
   }
 
   // string language_code = 2;
-  if (this->language_code().size() > 0) {
+  if (!this->_internal_language_code().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_language_code().data(), static_cast<int>(this->_internal_language_code().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -746,8 +986,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.Model)
   return target;
@@ -757,70 +997,49 @@ size_t Model::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.Model)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
   // string language_code = 2;
-  if (this->language_code().size() > 0) {
+  if (!this->_internal_language_code().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_language_code());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Model::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.Model)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Model* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Model>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.Model)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.Model)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Model::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Model::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Model::GetClassData() const { return &_class_data_; }
 
-void Model::MergeFrom(const Model& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.Model)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
+void Model::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Model*>(&to_msg);
+  auto& from = static_cast<const Model&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.Model)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.name_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.language_code().size() > 0) {
-
-    language_code_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.language_code_);
+  if (!from._internal_language_code().empty()) {
+    _this->_internal_set_language_code(from._internal_language_code());
   }
-}
-
-void Model::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.Model)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Model::CopyFrom(const Model& from) {
@@ -836,620 +1055,2649 @@ bool Model::IsInitialized() const {
 
 void Model::InternalSwap(Model* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  language_code_.Swap(&other->language_code_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.language_code_, lhs_arena,
+      &other->_impl_.language_code_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Model::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void RecognizeRequest::InitAsDefaultInstance() {
-  ::kaldi_serve::_RecognizeRequest_default_instance_._instance.get_mutable()->config_ = const_cast< ::kaldi_serve::RecognitionConfig*>(
-      ::kaldi_serve::RecognitionConfig::internal_default_instance());
-  ::kaldi_serve::_RecognizeRequest_default_instance_._instance.get_mutable()->audio_ = const_cast< ::kaldi_serve::RecognitionAudio*>(
-      ::kaldi_serve::RecognitionAudio::internal_default_instance());
-}
-class RecognizeRequest::_Internal {
+class ServerStats::_Internal {
  public:
-  static const ::kaldi_serve::RecognitionConfig& config(const RecognizeRequest* msg);
-  static const ::kaldi_serve::RecognitionAudio& audio(const RecognizeRequest* msg);
 };
 
-const ::kaldi_serve::RecognitionConfig&
-RecognizeRequest::_Internal::config(const RecognizeRequest* msg) {
-  return *msg->config_;
-}
-const ::kaldi_serve::RecognitionAudio&
-RecognizeRequest::_Internal::audio(const RecognizeRequest* msg) {
-  return *msg->audio_;
-}
-RecognizeRequest::RecognizeRequest()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.RecognizeRequest)
-}
-RecognizeRequest::RecognizeRequest(const RecognizeRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_uuid().empty()) {
-    uuid_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.uuid_);
-  }
-  if (from._internal_has_config()) {
-    config_ = new ::kaldi_serve::RecognitionConfig(*from.config_);
-  } else {
-    config_ = nullptr;
+ServerStats::ServerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.ServerStats)
+}
+ServerStats::ServerStats(const ServerStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.models_){from._impl_.models_}
+    , decltype(_impl_.memory_rss_bytes_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.memory_rss_bytes_ = from._impl_.memory_rss_bytes_;
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.ServerStats)
+}
+
+inline void ServerStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.models_){arena}
+    , decltype(_impl_.memory_rss_bytes_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ServerStats::~ServerStats() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.ServerStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  if (from._internal_has_audio()) {
-    audio_ = new ::kaldi_serve::RecognitionAudio(*from.audio_);
-  } else {
-    audio_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognizeRequest)
-}
-
-void RecognizeRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RecognizeRequest_kaldi_5fserve_2eproto.base);
-  uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&config_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&audio_) -
-      reinterpret_cast<char*>(&config_)) + sizeof(audio_));
-}
-
-RecognizeRequest::~RecognizeRequest() {
-  // @@protoc_insertion_point(destructor:kaldi_serve.RecognizeRequest)
   SharedDtor();
 }
 
-void RecognizeRequest::SharedDtor() {
-  uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete config_;
-  if (this != internal_default_instance()) delete audio_;
+inline void ServerStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.models_.~RepeatedPtrField();
 }
 
-void RecognizeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void ServerStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const RecognizeRequest& RecognizeRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RecognizeRequest_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void RecognizeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognizeRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ServerStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.ServerStats)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uuid_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == nullptr && config_ != nullptr) {
-    delete config_;
-  }
-  config_ = nullptr;
-  if (GetArenaNoVirtual() == nullptr && audio_ != nullptr) {
-    delete audio_;
-  }
-  audio_ = nullptr;
-  _internal_metadata_.Clear();
+  _impl_.models_.Clear();
+  _impl_.memory_rss_bytes_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RecognizeRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ServerStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .kaldi_serve.RecognitionConfig config = 1;
+      // repeated .kaldi_serve.ModelStats models = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_models(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      // .kaldi_serve.RecognitionAudio audio = 2;
+      // int64 memory_rss_bytes = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_audio(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.memory_rss_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // string uuid = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_uuid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.RecognizeRequest.uuid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RecognizeRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognizeRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ServerStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.ServerStats)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .kaldi_serve.RecognitionConfig config = 1;
-  if (this->has_config()) {
-    target = stream->EnsureSpace(target);
+  // repeated .kaldi_serve.ModelStats models = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_models_size()); i < n; i++) {
+    const auto& repfield = this->_internal_models(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::config(this), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // .kaldi_serve.RecognitionAudio audio = 2;
-  if (this->has_audio()) {
+  // int64 memory_rss_bytes = 2;
+  if (this->_internal_memory_rss_bytes() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::audio(this), target, stream);
-  }
-
-  // string uuid = 3;
-  if (this->uuid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "kaldi_serve.RecognizeRequest.uuid");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_uuid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_memory_rss_bytes(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognizeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.ServerStats)
   return target;
 }
 
-size_t RecognizeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognizeRequest)
+size_t ServerStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.ServerStats)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uuid = 3;
-  if (this->uuid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_uuid());
-  }
-
-  // .kaldi_serve.RecognitionConfig config = 1;
-  if (this->has_config()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *config_);
+  // repeated .kaldi_serve.ModelStats models = 1;
+  total_size += 1UL * this->_internal_models_size();
+  for (const auto& msg : this->_impl_.models_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .kaldi_serve.RecognitionAudio audio = 2;
-  if (this->has_audio()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *audio_);
+  // int64 memory_rss_bytes = 2;
+  if (this->_internal_memory_rss_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_memory_rss_bytes());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RecognizeRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.RecognizeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RecognizeRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RecognizeRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.RecognizeRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.RecognizeRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStats::GetClassData() const { return &_class_data_; }
 
-void RecognizeRequest::MergeFrom(const RecognizeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognizeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.uuid().size() > 0) {
+void ServerStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStats*>(&to_msg);
+  auto& from = static_cast<const ServerStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.ServerStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    uuid_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.uuid_);
-  }
-  if (from.has_config()) {
-    _internal_mutable_config()->::kaldi_serve::RecognitionConfig::MergeFrom(from._internal_config());
-  }
-  if (from.has_audio()) {
-    _internal_mutable_audio()->::kaldi_serve::RecognitionAudio::MergeFrom(from._internal_audio());
+  _this->_impl_.models_.MergeFrom(from._impl_.models_);
+  if (from._internal_memory_rss_bytes() != 0) {
+    _this->_internal_set_memory_rss_bytes(from._internal_memory_rss_bytes());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RecognizeRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.RecognizeRequest)
+void ServerStats::CopyFrom(const ServerStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.ServerStats)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void RecognizeRequest::CopyFrom(const RecognizeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.RecognizeRequest)
+bool ServerStats::IsInitialized() const {
+  return true;
+}
+
+void ServerStats::InternalSwap(ServerStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.models_.InternalSwap(&other->_impl_.models_);
+  swap(_impl_.memory_rss_bytes_, other->_impl_.memory_rss_bytes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[2]);
+}
+
+// ===================================================================
+
+class ModelStats::_Internal {
+ public:
+  static const ::kaldi_serve::Model& model(const ModelStats* msg);
+  static const ::kaldi_serve::ModelMemory& memory(const ModelStats* msg);
+};
+
+const ::kaldi_serve::Model&
+ModelStats::_Internal::model(const ModelStats* msg) {
+  return *msg->_impl_.model_;
+}
+const ::kaldi_serve::ModelMemory&
+ModelStats::_Internal::memory(const ModelStats* msg) {
+  return *msg->_impl_.memory_;
+}
+ModelStats::ModelStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.ModelStats)
+}
+ModelStats::ModelStats(const ModelStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ModelStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.model_){nullptr}
+    , decltype(_impl_.memory_){nullptr}
+    , decltype(_impl_.decoders_){}
+    , decltype(_impl_.idle_decoders_){}
+    , decltype(_impl_.max_decoders_){}
+    , decltype(_impl_.waiting_requests_){}
+    , decltype(_impl_.real_time_factor_){}
+    , decltype(_impl_.decoder_hold_secs_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_model()) {
+    _this->_impl_.model_ = new ::kaldi_serve::Model(*from._impl_.model_);
+  }
+  if (from._internal_has_memory()) {
+    _this->_impl_.memory_ = new ::kaldi_serve::ModelMemory(*from._impl_.memory_);
+  }
+  ::memcpy(&_impl_.decoders_, &from._impl_.decoders_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.decoder_hold_secs_) -
+    reinterpret_cast<char*>(&_impl_.decoders_)) + sizeof(_impl_.decoder_hold_secs_));
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.ModelStats)
+}
+
+inline void ModelStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.model_){nullptr}
+    , decltype(_impl_.memory_){nullptr}
+    , decltype(_impl_.decoders_){0}
+    , decltype(_impl_.idle_decoders_){0}
+    , decltype(_impl_.max_decoders_){0}
+    , decltype(_impl_.waiting_requests_){0}
+    , decltype(_impl_.real_time_factor_){0}
+    , decltype(_impl_.decoder_hold_secs_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ModelStats::~ModelStats() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.ModelStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ModelStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.model_;
+  if (this != internal_default_instance()) delete _impl_.memory_;
+}
+
+void ModelStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ModelStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.ModelStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.model_ != nullptr) {
+    delete _impl_.model_;
+  }
+  _impl_.model_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.memory_ != nullptr) {
+    delete _impl_.memory_;
+  }
+  _impl_.memory_ = nullptr;
+  ::memset(&_impl_.decoders_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.decoder_hold_secs_) -
+      reinterpret_cast<char*>(&_impl_.decoders_)) + sizeof(_impl_.decoder_hold_secs_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ModelStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .kaldi_serve.Model model = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_model(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 decoders = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.decoders_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 idle_decoders = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.idle_decoders_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_decoders = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_decoders_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 waiting_requests = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.waiting_requests_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float real_time_factor = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _impl_.real_time_factor_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float decoder_hold_secs = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _impl_.decoder_hold_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kaldi_serve.ModelMemory memory = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_memory(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ModelStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.ModelStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kaldi_serve.Model model = 1;
+  if (this->_internal_has_model()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::model(this),
+        _Internal::model(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 decoders = 2;
+  if (this->_internal_decoders() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_decoders(), target);
+  }
+
+  // int32 idle_decoders = 3;
+  if (this->_internal_idle_decoders() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_idle_decoders(), target);
+  }
+
+  // int32 max_decoders = 4;
+  if (this->_internal_max_decoders() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_max_decoders(), target);
+  }
+
+  // int32 waiting_requests = 5;
+  if (this->_internal_waiting_requests() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_waiting_requests(), target);
+  }
+
+  // float real_time_factor = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_real_time_factor = this->_internal_real_time_factor();
+  uint32_t raw_real_time_factor;
+  memcpy(&raw_real_time_factor, &tmp_real_time_factor, sizeof(tmp_real_time_factor));
+  if (raw_real_time_factor != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_real_time_factor(), target);
+  }
+
+  // float decoder_hold_secs = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_decoder_hold_secs = this->_internal_decoder_hold_secs();
+  uint32_t raw_decoder_hold_secs;
+  memcpy(&raw_decoder_hold_secs, &tmp_decoder_hold_secs, sizeof(tmp_decoder_hold_secs));
+  if (raw_decoder_hold_secs != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_decoder_hold_secs(), target);
+  }
+
+  // .kaldi_serve.ModelMemory memory = 8;
+  if (this->_internal_has_memory()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::memory(this),
+        _Internal::memory(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.ModelStats)
+  return target;
+}
+
+size_t ModelStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.ModelStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .kaldi_serve.Model model = 1;
+  if (this->_internal_has_model()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.model_);
+  }
+
+  // .kaldi_serve.ModelMemory memory = 8;
+  if (this->_internal_has_memory()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.memory_);
+  }
+
+  // int32 decoders = 2;
+  if (this->_internal_decoders() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_decoders());
+  }
+
+  // int32 idle_decoders = 3;
+  if (this->_internal_idle_decoders() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_idle_decoders());
+  }
+
+  // int32 max_decoders = 4;
+  if (this->_internal_max_decoders() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_decoders());
+  }
+
+  // int32 waiting_requests = 5;
+  if (this->_internal_waiting_requests() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_waiting_requests());
+  }
+
+  // float real_time_factor = 6;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_real_time_factor = this->_internal_real_time_factor();
+  uint32_t raw_real_time_factor;
+  memcpy(&raw_real_time_factor, &tmp_real_time_factor, sizeof(tmp_real_time_factor));
+  if (raw_real_time_factor != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float decoder_hold_secs = 7;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_decoder_hold_secs = this->_internal_decoder_hold_secs();
+  uint32_t raw_decoder_hold_secs;
+  memcpy(&raw_decoder_hold_secs, &tmp_decoder_hold_secs, sizeof(tmp_decoder_hold_secs));
+  if (raw_decoder_hold_secs != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModelStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ModelStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModelStats::GetClassData() const { return &_class_data_; }
+
+
+void ModelStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModelStats*>(&to_msg);
+  auto& from = static_cast<const ModelStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.ModelStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_model()) {
+    _this->_internal_mutable_model()->::kaldi_serve::Model::MergeFrom(
+        from._internal_model());
+  }
+  if (from._internal_has_memory()) {
+    _this->_internal_mutable_memory()->::kaldi_serve::ModelMemory::MergeFrom(
+        from._internal_memory());
+  }
+  if (from._internal_decoders() != 0) {
+    _this->_internal_set_decoders(from._internal_decoders());
+  }
+  if (from._internal_idle_decoders() != 0) {
+    _this->_internal_set_idle_decoders(from._internal_idle_decoders());
+  }
+  if (from._internal_max_decoders() != 0) {
+    _this->_internal_set_max_decoders(from._internal_max_decoders());
+  }
+  if (from._internal_waiting_requests() != 0) {
+    _this->_internal_set_waiting_requests(from._internal_waiting_requests());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_real_time_factor = from._internal_real_time_factor();
+  uint32_t raw_real_time_factor;
+  memcpy(&raw_real_time_factor, &tmp_real_time_factor, sizeof(tmp_real_time_factor));
+  if (raw_real_time_factor != 0) {
+    _this->_internal_set_real_time_factor(from._internal_real_time_factor());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_decoder_hold_secs = from._internal_decoder_hold_secs();
+  uint32_t raw_decoder_hold_secs;
+  memcpy(&raw_decoder_hold_secs, &tmp_decoder_hold_secs, sizeof(tmp_decoder_hold_secs));
+  if (raw_decoder_hold_secs != 0) {
+    _this->_internal_set_decoder_hold_secs(from._internal_decoder_hold_secs());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ModelStats::CopyFrom(const ModelStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.ModelStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ModelStats::IsInitialized() const {
+  return true;
+}
+
+void ModelStats::InternalSwap(ModelStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ModelStats, _impl_.decoder_hold_secs_)
+      + sizeof(ModelStats::_impl_.decoder_hold_secs_)
+      - PROTOBUF_FIELD_OFFSET(ModelStats, _impl_.model_)>(
+          reinterpret_cast<char*>(&_impl_.model_),
+          reinterpret_cast<char*>(&other->_impl_.model_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ModelStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[3]);
+}
+
+// ===================================================================
+
+class ModelMemory::_Internal {
+ public:
+};
+
+ModelMemory::ModelMemory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.ModelMemory)
+}
+ModelMemory::ModelMemory(const ModelMemory& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ModelMemory* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hclg_bytes_){}
+    , decltype(_impl_.am_nnet_bytes_){}
+    , decltype(_impl_.ivector_extractor_bytes_){}
+    , decltype(_impl_.rnnlm_bytes_){}
+    , decltype(_impl_.word_embedding_bytes_){}
+    , decltype(_impl_.lm_fst_bytes_){}
+    , decltype(_impl_.word_syms_bytes_){}
+    , decltype(_impl_.total_bytes_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.hclg_bytes_, &from._impl_.hclg_bytes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_bytes_) -
+    reinterpret_cast<char*>(&_impl_.hclg_bytes_)) + sizeof(_impl_.total_bytes_));
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.ModelMemory)
+}
+
+inline void ModelMemory::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hclg_bytes_){int64_t{0}}
+    , decltype(_impl_.am_nnet_bytes_){int64_t{0}}
+    , decltype(_impl_.ivector_extractor_bytes_){int64_t{0}}
+    , decltype(_impl_.rnnlm_bytes_){int64_t{0}}
+    , decltype(_impl_.word_embedding_bytes_){int64_t{0}}
+    , decltype(_impl_.lm_fst_bytes_){int64_t{0}}
+    , decltype(_impl_.word_syms_bytes_){int64_t{0}}
+    , decltype(_impl_.total_bytes_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ModelMemory::~ModelMemory() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.ModelMemory)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ModelMemory::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ModelMemory::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ModelMemory::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.ModelMemory)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.hclg_bytes_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.total_bytes_) -
+      reinterpret_cast<char*>(&_impl_.hclg_bytes_)) + sizeof(_impl_.total_bytes_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ModelMemory::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 hclg_bytes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.hclg_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 am_nnet_bytes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.am_nnet_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 ivector_extractor_bytes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ivector_extractor_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 rnnlm_bytes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.rnnlm_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 word_embedding_bytes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.word_embedding_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 lm_fst_bytes = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.lm_fst_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 word_syms_bytes = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.word_syms_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 total_bytes = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.total_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ModelMemory::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.ModelMemory)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 hclg_bytes = 1;
+  if (this->_internal_hclg_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_hclg_bytes(), target);
+  }
+
+  // int64 am_nnet_bytes = 2;
+  if (this->_internal_am_nnet_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_am_nnet_bytes(), target);
+  }
+
+  // int64 ivector_extractor_bytes = 3;
+  if (this->_internal_ivector_extractor_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_ivector_extractor_bytes(), target);
+  }
+
+  // int64 rnnlm_bytes = 4;
+  if (this->_internal_rnnlm_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_rnnlm_bytes(), target);
+  }
+
+  // int64 word_embedding_bytes = 5;
+  if (this->_internal_word_embedding_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_word_embedding_bytes(), target);
+  }
+
+  // int64 lm_fst_bytes = 6;
+  if (this->_internal_lm_fst_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_lm_fst_bytes(), target);
+  }
+
+  // int64 word_syms_bytes = 7;
+  if (this->_internal_word_syms_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_word_syms_bytes(), target);
+  }
+
+  // int64 total_bytes = 8;
+  if (this->_internal_total_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_total_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.ModelMemory)
+  return target;
+}
+
+size_t ModelMemory::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.ModelMemory)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 hclg_bytes = 1;
+  if (this->_internal_hclg_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_hclg_bytes());
+  }
+
+  // int64 am_nnet_bytes = 2;
+  if (this->_internal_am_nnet_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_am_nnet_bytes());
+  }
+
+  // int64 ivector_extractor_bytes = 3;
+  if (this->_internal_ivector_extractor_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_ivector_extractor_bytes());
+  }
+
+  // int64 rnnlm_bytes = 4;
+  if (this->_internal_rnnlm_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_rnnlm_bytes());
+  }
+
+  // int64 word_embedding_bytes = 5;
+  if (this->_internal_word_embedding_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_word_embedding_bytes());
+  }
+
+  // int64 lm_fst_bytes = 6;
+  if (this->_internal_lm_fst_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_lm_fst_bytes());
+  }
+
+  // int64 word_syms_bytes = 7;
+  if (this->_internal_word_syms_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_word_syms_bytes());
+  }
+
+  // int64 total_bytes = 8;
+  if (this->_internal_total_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_total_bytes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ModelMemory::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ModelMemory::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ModelMemory::GetClassData() const { return &_class_data_; }
+
+
+void ModelMemory::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ModelMemory*>(&to_msg);
+  auto& from = static_cast<const ModelMemory&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.ModelMemory)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_hclg_bytes() != 0) {
+    _this->_internal_set_hclg_bytes(from._internal_hclg_bytes());
+  }
+  if (from._internal_am_nnet_bytes() != 0) {
+    _this->_internal_set_am_nnet_bytes(from._internal_am_nnet_bytes());
+  }
+  if (from._internal_ivector_extractor_bytes() != 0) {
+    _this->_internal_set_ivector_extractor_bytes(from._internal_ivector_extractor_bytes());
+  }
+  if (from._internal_rnnlm_bytes() != 0) {
+    _this->_internal_set_rnnlm_bytes(from._internal_rnnlm_bytes());
+  }
+  if (from._internal_word_embedding_bytes() != 0) {
+    _this->_internal_set_word_embedding_bytes(from._internal_word_embedding_bytes());
+  }
+  if (from._internal_lm_fst_bytes() != 0) {
+    _this->_internal_set_lm_fst_bytes(from._internal_lm_fst_bytes());
+  }
+  if (from._internal_word_syms_bytes() != 0) {
+    _this->_internal_set_word_syms_bytes(from._internal_word_syms_bytes());
+  }
+  if (from._internal_total_bytes() != 0) {
+    _this->_internal_set_total_bytes(from._internal_total_bytes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ModelMemory::CopyFrom(const ModelMemory& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.ModelMemory)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ModelMemory::IsInitialized() const {
+  return true;
+}
+
+void ModelMemory::InternalSwap(ModelMemory* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ModelMemory, _impl_.total_bytes_)
+      + sizeof(ModelMemory::_impl_.total_bytes_)
+      - PROTOBUF_FIELD_OFFSET(ModelMemory, _impl_.hclg_bytes_)>(
+          reinterpret_cast<char*>(&_impl_.hclg_bytes_),
+          reinterpret_cast<char*>(&other->_impl_.hclg_bytes_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ModelMemory::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[4]);
+}
+
+// ===================================================================
+
+class RecognizeRequest::_Internal {
+ public:
+  static const ::kaldi_serve::RecognitionConfig& config(const RecognizeRequest* msg);
+  static const ::kaldi_serve::RecognitionAudio& audio(const RecognizeRequest* msg);
+};
+
+const ::kaldi_serve::RecognitionConfig&
+RecognizeRequest::_Internal::config(const RecognizeRequest* msg) {
+  return *msg->_impl_.config_;
+}
+const ::kaldi_serve::RecognitionAudio&
+RecognizeRequest::_Internal::audio(const RecognizeRequest* msg) {
+  return *msg->_impl_.audio_;
+}
+RecognizeRequest::RecognizeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.RecognizeRequest)
+}
+RecognizeRequest::RecognizeRequest(const RecognizeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecognizeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.audio_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tenant().empty()) {
+    _this->_impl_.tenant_.Set(from._internal_tenant(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_config()) {
+    _this->_impl_.config_ = new ::kaldi_serve::RecognitionConfig(*from._impl_.config_);
+  }
+  if (from._internal_has_audio()) {
+    _this->_impl_.audio_ = new ::kaldi_serve::RecognitionAudio(*from._impl_.audio_);
+  }
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognizeRequest)
+}
+
+inline void RecognizeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.audio_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RecognizeRequest::~RecognizeRequest() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.RecognizeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RecognizeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.Destroy();
+  _impl_.tenant_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.config_;
+  if (this != internal_default_instance()) delete _impl_.audio_;
+}
+
+void RecognizeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecognizeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognizeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uuid_.ClearToEmpty();
+  _impl_.tenant_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.audio_ != nullptr) {
+    delete _impl_.audio_;
+  }
+  _impl_.audio_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecognizeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .kaldi_serve.RecognitionConfig config = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kaldi_serve.RecognitionAudio audio = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_audio(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string uuid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognizeRequest.uuid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string tenant = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_tenant();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognizeRequest.tenant"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecognizeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognizeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kaldi_serve.RecognitionConfig config = 1;
+  if (this->_internal_has_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
+  }
+
+  // .kaldi_serve.RecognitionAudio audio = 2;
+  if (this->_internal_has_audio()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::audio(this),
+        _Internal::audio(this).GetCachedSize(), target, stream);
+  }
+
+  // string uuid = 3;
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kaldi_serve.RecognizeRequest.uuid");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_uuid(), target);
+  }
+
+  // string tenant = 4;
+  if (!this->_internal_tenant().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_tenant().data(), static_cast<int>(this->_internal_tenant().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kaldi_serve.RecognizeRequest.tenant");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_tenant(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognizeRequest)
+  return target;
+}
+
+size_t RecognizeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognizeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string uuid = 3;
+  if (!this->_internal_uuid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
+  }
+
+  // string tenant = 4;
+  if (!this->_internal_tenant().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_tenant());
+  }
+
+  // .kaldi_serve.RecognitionConfig config = 1;
+  if (this->_internal_has_config()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.config_);
+  }
+
+  // .kaldi_serve.RecognitionAudio audio = 2;
+  if (this->_internal_has_audio()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.audio_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecognizeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecognizeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecognizeRequest::GetClassData() const { return &_class_data_; }
+
+
+void RecognizeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecognizeRequest*>(&to_msg);
+  auto& from = static_cast<const RecognizeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognizeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
+  }
+  if (!from._internal_tenant().empty()) {
+    _this->_internal_set_tenant(from._internal_tenant());
+  }
+  if (from._internal_has_config()) {
+    _this->_internal_mutable_config()->::kaldi_serve::RecognitionConfig::MergeFrom(
+        from._internal_config());
+  }
+  if (from._internal_has_audio()) {
+    _this->_internal_mutable_audio()->::kaldi_serve::RecognitionAudio::MergeFrom(
+        from._internal_audio());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecognizeRequest::CopyFrom(const RecognizeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.RecognizeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecognizeRequest::IsInitialized() const {
+  return true;
+}
+
+void RecognizeRequest::InternalSwap(RecognizeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tenant_, lhs_arena,
+      &other->_impl_.tenant_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecognizeRequest, _impl_.audio_)
+      + sizeof(RecognizeRequest::_impl_.audio_)
+      - PROTOBUF_FIELD_OFFSET(RecognizeRequest, _impl_.config_)>(
+          reinterpret_cast<char*>(&_impl_.config_),
+          reinterpret_cast<char*>(&other->_impl_.config_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecognizeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[5]);
+}
+
+// ===================================================================
+
+class BatchRecognizeRequest::_Internal {
+ public:
+  static const ::kaldi_serve::RecognitionConfig& config(const BatchRecognizeRequest* msg);
+};
+
+const ::kaldi_serve::RecognitionConfig&
+BatchRecognizeRequest::_Internal::config(const BatchRecognizeRequest* msg) {
+  return *msg->_impl_.config_;
+}
+BatchRecognizeRequest::BatchRecognizeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.BatchRecognizeRequest)
+}
+BatchRecognizeRequest::BatchRecognizeRequest(const BatchRecognizeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchRecognizeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.audios_){from._impl_.audios_}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.max_parallel_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_tenant().empty()) {
+    _this->_impl_.tenant_.Set(from._internal_tenant(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_config()) {
+    _this->_impl_.config_ = new ::kaldi_serve::RecognitionConfig(*from._impl_.config_);
+  }
+  _this->_impl_.max_parallel_ = from._impl_.max_parallel_;
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.BatchRecognizeRequest)
+}
+
+inline void BatchRecognizeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.audios_){arena}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.tenant_){}
+    , decltype(_impl_.config_){nullptr}
+    , decltype(_impl_.max_parallel_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.tenant_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchRecognizeRequest::~BatchRecognizeRequest() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.BatchRecognizeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchRecognizeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.audios_.~RepeatedPtrField();
+  _impl_.uuid_.Destroy();
+  _impl_.tenant_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.config_;
+}
+
+void BatchRecognizeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchRecognizeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.BatchRecognizeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.audios_.Clear();
+  _impl_.uuid_.ClearToEmpty();
+  _impl_.tenant_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
+  _impl_.max_parallel_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchRecognizeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .kaldi_serve.RecognitionConfig config = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .kaldi_serve.RecognitionAudio audios = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_audios(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string uuid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.BatchRecognizeRequest.uuid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string tenant = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_tenant();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.BatchRecognizeRequest.tenant"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 max_parallel = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.max_parallel_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchRecognizeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.BatchRecognizeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .kaldi_serve.RecognitionConfig config = 1;
+  if (this->_internal_has_config()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::config(this),
+        _Internal::config(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .kaldi_serve.RecognitionAudio audios = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_audios_size()); i < n; i++) {
+    const auto& repfield = this->_internal_audios(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string uuid = 3;
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kaldi_serve.BatchRecognizeRequest.uuid");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_uuid(), target);
+  }
+
+  // string tenant = 4;
+  if (!this->_internal_tenant().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_tenant().data(), static_cast<int>(this->_internal_tenant().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kaldi_serve.BatchRecognizeRequest.tenant");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_tenant(), target);
+  }
+
+  // int32 max_parallel = 5;
+  if (this->_internal_max_parallel() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_max_parallel(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.BatchRecognizeRequest)
+  return target;
+}
+
+size_t BatchRecognizeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.BatchRecognizeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .kaldi_serve.RecognitionAudio audios = 2;
+  total_size += 1UL * this->_internal_audios_size();
+  for (const auto& msg : this->_impl_.audios_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string uuid = 3;
+  if (!this->_internal_uuid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
+  }
+
+  // string tenant = 4;
+  if (!this->_internal_tenant().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_tenant());
+  }
+
+  // .kaldi_serve.RecognitionConfig config = 1;
+  if (this->_internal_has_config()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.config_);
+  }
+
+  // int32 max_parallel = 5;
+  if (this->_internal_max_parallel() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_parallel());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchRecognizeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchRecognizeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchRecognizeRequest::GetClassData() const { return &_class_data_; }
+
+
+void BatchRecognizeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchRecognizeRequest*>(&to_msg);
+  auto& from = static_cast<const BatchRecognizeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.BatchRecognizeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.audios_.MergeFrom(from._impl_.audios_);
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
+  }
+  if (!from._internal_tenant().empty()) {
+    _this->_internal_set_tenant(from._internal_tenant());
+  }
+  if (from._internal_has_config()) {
+    _this->_internal_mutable_config()->::kaldi_serve::RecognitionConfig::MergeFrom(
+        from._internal_config());
+  }
+  if (from._internal_max_parallel() != 0) {
+    _this->_internal_set_max_parallel(from._internal_max_parallel());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchRecognizeRequest::CopyFrom(const BatchRecognizeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.BatchRecognizeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRecognizeRequest::IsInitialized() const {
+  return true;
+}
+
+void BatchRecognizeRequest::InternalSwap(BatchRecognizeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.audios_.InternalSwap(&other->_impl_.audios_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.tenant_, lhs_arena,
+      &other->_impl_.tenant_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchRecognizeRequest, _impl_.max_parallel_)
+      + sizeof(BatchRecognizeRequest::_impl_.max_parallel_)
+      - PROTOBUF_FIELD_OFFSET(BatchRecognizeRequest, _impl_.config_)>(
+          reinterpret_cast<char*>(&_impl_.config_),
+          reinterpret_cast<char*>(&other->_impl_.config_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRecognizeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[6]);
+}
+
+// ===================================================================
+
+class BatchRecognizeResponse::_Internal {
+ public:
+  static const ::kaldi_serve::RecognizeResponse& response(const BatchRecognizeResponse* msg);
+};
+
+const ::kaldi_serve::RecognizeResponse&
+BatchRecognizeResponse::_Internal::response(const BatchRecognizeResponse* msg) {
+  return *msg->_impl_.response_;
+}
+BatchRecognizeResponse::BatchRecognizeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.BatchRecognizeResponse)
+}
+BatchRecognizeResponse::BatchRecognizeResponse(const BatchRecognizeResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchRecognizeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.error_code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_response()) {
+    _this->_impl_.response_ = new ::kaldi_serve::RecognizeResponse(*from._impl_.response_);
+  }
+  ::memcpy(&_impl_.index_, &from._impl_.index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.error_code_) -
+    reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.error_code_));
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.BatchRecognizeResponse)
+}
+
+inline void BatchRecognizeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.response_){nullptr}
+    , decltype(_impl_.index_){0}
+    , decltype(_impl_.error_code_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchRecognizeResponse::~BatchRecognizeResponse() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.BatchRecognizeResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchRecognizeResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.response_;
+}
+
+void BatchRecognizeResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchRecognizeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.BatchRecognizeResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.error_message_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
+  }
+  _impl_.response_ = nullptr;
+  ::memset(&_impl_.index_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.error_code_) -
+      reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.error_code_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchRecognizeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kaldi_serve.RecognizeResponse response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 error_code = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.error_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_message = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.BatchRecognizeResponse.error_message"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchRecognizeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.BatchRecognizeResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 index = 1;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_index(), target);
+  }
+
+  // .kaldi_serve.RecognizeResponse response = 2;
+  if (this->_internal_has_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 error_code = 3;
+  if (this->_internal_error_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_error_code(), target);
+  }
+
+  // string error_message = 4;
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "kaldi_serve.BatchRecognizeResponse.error_message");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_error_message(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.BatchRecognizeResponse)
+  return target;
+}
+
+size_t BatchRecognizeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.BatchRecognizeResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string error_message = 4;
+  if (!this->_internal_error_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
+  }
+
+  // .kaldi_serve.RecognizeResponse response = 2;
+  if (this->_internal_has_response()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.response_);
+  }
+
+  // int32 index = 1;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
+  }
+
+  // int32 error_code = 3;
+  if (this->_internal_error_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error_code());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchRecognizeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchRecognizeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchRecognizeResponse::GetClassData() const { return &_class_data_; }
+
+
+void BatchRecognizeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchRecognizeResponse*>(&to_msg);
+  auto& from = static_cast<const BatchRecognizeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.BatchRecognizeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
+  }
+  if (from._internal_has_response()) {
+    _this->_internal_mutable_response()->::kaldi_serve::RecognizeResponse::MergeFrom(
+        from._internal_response());
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  if (from._internal_error_code() != 0) {
+    _this->_internal_set_error_code(from._internal_error_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchRecognizeResponse::CopyFrom(const BatchRecognizeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.BatchRecognizeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRecognizeResponse::IsInitialized() const {
+  return true;
+}
+
+void BatchRecognizeResponse::InternalSwap(BatchRecognizeResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchRecognizeResponse, _impl_.error_code_)
+      + sizeof(BatchRecognizeResponse::_impl_.error_code_)
+      - PROTOBUF_FIELD_OFFSET(BatchRecognizeResponse, _impl_.response_)>(
+          reinterpret_cast<char*>(&_impl_.response_),
+          reinterpret_cast<char*>(&other->_impl_.response_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRecognizeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[7]);
+}
+
+// ===================================================================
+
+class RecognizeResponse::_Internal {
+ public:
+  static const ::kaldi_serve::ResourceUsage& usage(const RecognizeResponse* msg);
+};
+
+const ::kaldi_serve::ResourceUsage&
+RecognizeResponse::_Internal::usage(const RecognizeResponse* msg) {
+  return *msg->_impl_.usage_;
+}
+RecognizeResponse::RecognizeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.RecognizeResponse)
+}
+RecognizeResponse::RecognizeResponse(const RecognizeResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecognizeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.usage_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_usage()) {
+    _this->_impl_.usage_ = new ::kaldi_serve::ResourceUsage(*from._impl_.usage_);
+  }
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognizeResponse)
+}
+
+inline void RecognizeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , decltype(_impl_.usage_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RecognizeResponse::~RecognizeResponse() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.RecognizeResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RecognizeResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.usage_;
+}
+
+void RecognizeResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecognizeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognizeResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.usage_ != nullptr) {
+    delete _impl_.usage_;
+  }
+  _impl_.usage_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecognizeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .kaldi_serve.ResourceUsage usage = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_usage(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecognizeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognizeResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .kaldi_serve.ResourceUsage usage = 2;
+  if (this->_internal_has_usage()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::usage(this),
+        _Internal::usage(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognizeResponse)
+  return target;
+}
+
+size_t RecognizeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognizeResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .kaldi_serve.ResourceUsage usage = 2;
+  if (this->_internal_has_usage()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.usage_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecognizeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecognizeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecognizeResponse::GetClassData() const { return &_class_data_; }
+
+
+void RecognizeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecognizeResponse*>(&to_msg);
+  auto& from = static_cast<const RecognizeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognizeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_has_usage()) {
+    _this->_internal_mutable_usage()->::kaldi_serve::ResourceUsage::MergeFrom(
+        from._internal_usage());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecognizeResponse::CopyFrom(const RecognizeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.RecognizeResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RecognizeRequest::IsInitialized() const {
+bool RecognizeResponse::IsInitialized() const {
   return true;
 }
 
-void RecognizeRequest::InternalSwap(RecognizeRequest* other) {
+void RecognizeResponse::InternalSwap(RecognizeResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  uuid_.Swap(&other->uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(config_, other->config_);
-  swap(audio_, other->audio_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  swap(_impl_.usage_, other->_impl_.usage_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RecognizeRequest::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata RecognizeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void RecognizeResponse::InitAsDefaultInstance() {
-}
-class RecognizeResponse::_Internal {
+class ResourceUsage::_Internal {
  public:
 };
 
-RecognizeResponse::RecognizeResponse()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.RecognizeResponse)
-}
-RecognizeResponse::RecognizeResponse(const RecognizeResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      results_(from.results_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognizeResponse)
-}
-
-void RecognizeResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RecognizeResponse_kaldi_5fserve_2eproto.base);
-}
-
-RecognizeResponse::~RecognizeResponse() {
-  // @@protoc_insertion_point(destructor:kaldi_serve.RecognizeResponse)
+ResourceUsage::ResourceUsage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.ResourceUsage)
+}
+ResourceUsage::ResourceUsage(const ResourceUsage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResourceUsage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.audio_secs_){}
+    , decltype(_impl_.cpu_secs_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.audio_secs_, &from._impl_.audio_secs_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cpu_secs_) -
+    reinterpret_cast<char*>(&_impl_.audio_secs_)) + sizeof(_impl_.cpu_secs_));
+  // @@protoc_insertion_point(copy_constructor:kaldi_serve.ResourceUsage)
+}
+
+inline void ResourceUsage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.audio_secs_){0}
+    , decltype(_impl_.cpu_secs_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResourceUsage::~ResourceUsage() {
+  // @@protoc_insertion_point(destructor:kaldi_serve.ResourceUsage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RecognizeResponse::SharedDtor() {
+inline void ResourceUsage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RecognizeResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RecognizeResponse& RecognizeResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RecognizeResponse_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+void ResourceUsage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void RecognizeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognizeResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ResourceUsage::Clear() {
+// @@protoc_insertion_point(message_clear_start:kaldi_serve.ResourceUsage)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  results_.Clear();
-  _internal_metadata_.Clear();
+  ::memset(&_impl_.audio_secs_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cpu_secs_) -
+      reinterpret_cast<char*>(&_impl_.audio_secs_)) + sizeof(_impl_.cpu_secs_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RecognizeResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ResourceUsage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+      // float audio_secs = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.audio_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float cpu_secs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.cpu_secs_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RecognizeResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognizeResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ResourceUsage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.ResourceUsage)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_results_size()); i < n; i++) {
+  // float audio_secs = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_audio_secs = this->_internal_audio_secs();
+  uint32_t raw_audio_secs;
+  memcpy(&raw_audio_secs, &tmp_audio_secs, sizeof(tmp_audio_secs));
+  if (raw_audio_secs != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_results(i), target, stream);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_audio_secs(), target);
+  }
+
+  // float cpu_secs = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cpu_secs = this->_internal_cpu_secs();
+  uint32_t raw_cpu_secs;
+  memcpy(&raw_cpu_secs, &tmp_cpu_secs, sizeof(tmp_cpu_secs));
+  if (raw_cpu_secs != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_cpu_secs(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognizeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.ResourceUsage)
   return target;
 }
 
-size_t RecognizeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognizeResponse)
+size_t ResourceUsage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:kaldi_serve.ResourceUsage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-  total_size += 1UL * this->_internal_results_size();
-  for (const auto& msg : this->results_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // float audio_secs = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_audio_secs = this->_internal_audio_secs();
+  uint32_t raw_audio_secs;
+  memcpy(&raw_audio_secs, &tmp_audio_secs, sizeof(tmp_audio_secs));
+  if (raw_audio_secs != 0) {
+    total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // float cpu_secs = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cpu_secs = this->_internal_cpu_secs();
+  uint32_t raw_cpu_secs;
+  memcpy(&raw_cpu_secs, &tmp_cpu_secs, sizeof(tmp_cpu_secs));
+  if (raw_cpu_secs != 0) {
+    total_size += 1 + 4;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RecognizeResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.RecognizeResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RecognizeResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RecognizeResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.RecognizeResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.RecognizeResponse)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RecognizeResponse::MergeFrom(const RecognizeResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognizeResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResourceUsage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResourceUsage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResourceUsage::GetClassData() const { return &_class_data_; }
 
-  results_.MergeFrom(from.results_);
-}
 
-void RecognizeResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.RecognizeResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void ResourceUsage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResourceUsage*>(&to_msg);
+  auto& from = static_cast<const ResourceUsage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.ResourceUsage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_audio_secs = from._internal_audio_secs();
+  uint32_t raw_audio_secs;
+  memcpy(&raw_audio_secs, &tmp_audio_secs, sizeof(tmp_audio_secs));
+  if (raw_audio_secs != 0) {
+    _this->_internal_set_audio_secs(from._internal_audio_secs());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_cpu_secs = from._internal_cpu_secs();
+  uint32_t raw_cpu_secs;
+  memcpy(&raw_cpu_secs, &tmp_cpu_secs, sizeof(tmp_cpu_secs));
+  if (raw_cpu_secs != 0) {
+    _this->_internal_set_cpu_secs(from._internal_cpu_secs());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RecognizeResponse::CopyFrom(const RecognizeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.RecognizeResponse)
+void ResourceUsage::CopyFrom(const ResourceUsage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:kaldi_serve.ResourceUsage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RecognizeResponse::IsInitialized() const {
+bool ResourceUsage::IsInitialized() const {
   return true;
 }
 
-void RecognizeResponse::InternalSwap(RecognizeResponse* other) {
+void ResourceUsage::InternalSwap(ResourceUsage* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  results_.InternalSwap(&other->results_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResourceUsage, _impl_.cpu_secs_)
+      + sizeof(ResourceUsage::_impl_.cpu_secs_)
+      - PROTOBUF_FIELD_OFFSET(ResourceUsage, _impl_.audio_secs_)>(
+          reinterpret_cast<char*>(&_impl_.audio_secs_),
+          reinterpret_cast<char*>(&other->_impl_.audio_secs_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RecognizeResponse::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ResourceUsage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void RecognitionConfig::InitAsDefaultInstance() {
-}
 class RecognitionConfig::_Internal {
  public:
 };
 
-RecognitionConfig::RecognitionConfig()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.RecognitionConfig)
+RecognitionConfig::RecognitionConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.RecognitionConfig)
 }
 RecognitionConfig::RecognitionConfig(const RecognitionConfig& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      speech_contexts_(from.speech_contexts_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  language_code_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecognitionConfig* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.speech_contexts_){from._impl_.speech_contexts_}
+    , decltype(_impl_.language_code_){}
+    , decltype(_impl_.model_){}
+    , decltype(_impl_.encoding_){}
+    , decltype(_impl_.sample_rate_hertz_){}
+    , decltype(_impl_.max_alternatives_){}
+    , decltype(_impl_.audio_channel_count_){}
+    , decltype(_impl_.punctuation_){}
+    , decltype(_impl_.raw_){}
+    , decltype(_impl_.word_level_){}
+    , decltype(_impl_.report_usage_){}
+    , decltype(_impl_.data_bytes_){}
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.interim_results_on_change_){}
+    , decltype(_impl_.continuous_){}
+    , decltype(_impl_.parallel_segments_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.language_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_language_code().empty()) {
-    language_code_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.language_code_);
+    _this->_impl_.language_code_.Set(from._internal_language_code(), 
+      _this->GetArenaForAllocation());
   }
-  model_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.model_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_model().empty()) {
-    model_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.model_);
+    _this->_impl_.model_.Set(from._internal_model(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&encoding_, &from.encoding_,
-    static_cast<size_t>(reinterpret_cast<char*>(&data_bytes_) -
-    reinterpret_cast<char*>(&encoding_)) + sizeof(data_bytes_));
+  ::memcpy(&_impl_.encoding_, &from._impl_.encoding_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.parallel_segments_) -
+    reinterpret_cast<char*>(&_impl_.encoding_)) + sizeof(_impl_.parallel_segments_));
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognitionConfig)
 }
 
-void RecognitionConfig::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RecognitionConfig_kaldi_5fserve_2eproto.base);
-  language_code_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  model_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&encoding_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&data_bytes_) -
-      reinterpret_cast<char*>(&encoding_)) + sizeof(data_bytes_));
+inline void RecognitionConfig::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.speech_contexts_){arena}
+    , decltype(_impl_.language_code_){}
+    , decltype(_impl_.model_){}
+    , decltype(_impl_.encoding_){0}
+    , decltype(_impl_.sample_rate_hertz_){0}
+    , decltype(_impl_.max_alternatives_){0}
+    , decltype(_impl_.audio_channel_count_){0}
+    , decltype(_impl_.punctuation_){false}
+    , decltype(_impl_.raw_){false}
+    , decltype(_impl_.word_level_){false}
+    , decltype(_impl_.report_usage_){false}
+    , decltype(_impl_.data_bytes_){0}
+    , decltype(_impl_.priority_){0}
+    , decltype(_impl_.interim_results_on_change_){false}
+    , decltype(_impl_.continuous_){false}
+    , decltype(_impl_.parallel_segments_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.language_code_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.model_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.model_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RecognitionConfig::~RecognitionConfig() {
   // @@protoc_insertion_point(destructor:kaldi_serve.RecognitionConfig)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RecognitionConfig::SharedDtor() {
-  language_code_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  model_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void RecognitionConfig::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.speech_contexts_.~RepeatedPtrField();
+  _impl_.language_code_.Destroy();
+  _impl_.model_.Destroy();
 }
 
 void RecognitionConfig::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RecognitionConfig& RecognitionConfig::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RecognitionConfig_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RecognitionConfig::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognitionConfig)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  speech_contexts_.Clear();
-  language_code_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  model_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&encoding_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&data_bytes_) -
-      reinterpret_cast<char*>(&encoding_)) + sizeof(data_bytes_));
-  _internal_metadata_.Clear();
+  _impl_.speech_contexts_.Clear();
+  _impl_.language_code_.ClearToEmpty();
+  _impl_.model_.ClearToEmpty();
+  ::memset(&_impl_.encoding_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.parallel_segments_) -
+      reinterpret_cast<char*>(&_impl_.encoding_)) + sizeof(_impl_.parallel_segments_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RecognitionConfig::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RecognitionConfig::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_encoding(static_cast<::kaldi_serve::RecognitionConfig_AudioEncoding>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 sample_rate_hertz = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          sample_rate_hertz_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.sample_rate_hertz_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string language_code = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_language_code();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.RecognitionConfig.language_code"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognitionConfig.language_code"));
+        } else
+          goto handle_unusual;
         continue;
       // int32 max_alternatives = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          max_alternatives_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_alternatives_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool punctuation = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          punctuation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.punctuation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1457,86 +3705,136 @@ const char* RecognitionConfig::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 audio_channel_count = 7;
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
-          audio_channel_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.audio_channel_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string model = 10;
       case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
           auto str = _internal_mutable_model();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.RecognitionConfig.model"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognitionConfig.model"));
+        } else
+          goto handle_unusual;
         continue;
       // bool raw = 11;
       case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
-          raw_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.raw_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 data_bytes = 12;
       case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 96)) {
-          data_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.data_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool word_level = 13;
       case 13:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 104)) {
-          word_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.word_level_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .kaldi_serve.RecognitionConfig.Priority priority = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_priority(static_cast<::kaldi_serve::RecognitionConfig_Priority>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool report_usage = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.report_usage_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool interim_results_on_change = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.interim_results_on_change_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool continuous = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _impl_.continuous_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 parallel_segments = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _impl_.parallel_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RecognitionConfig::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* RecognitionConfig::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognitionConfig)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
-  if (this->encoding() != 0) {
+  if (this->_internal_encoding() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_encoding(), target);
   }
 
   // int32 sample_rate_hertz = 2;
-  if (this->sample_rate_hertz() != 0) {
+  if (this->_internal_sample_rate_hertz() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_sample_rate_hertz(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_sample_rate_hertz(), target);
   }
 
   // string language_code = 3;
-  if (this->language_code().size() > 0) {
+  if (!this->_internal_language_code().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_language_code().data(), static_cast<int>(this->_internal_language_code().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1546,33 +3844,33 @@ failure:
   }
 
   // int32 max_alternatives = 4;
-  if (this->max_alternatives() != 0) {
+  if (this->_internal_max_alternatives() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(4, this->_internal_max_alternatives(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_max_alternatives(), target);
   }
 
   // bool punctuation = 5;
-  if (this->punctuation() != 0) {
+  if (this->_internal_punctuation() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(5, this->_internal_punctuation(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_punctuation(), target);
   }
 
   // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_speech_contexts_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_speech_contexts_size()); i < n; i++) {
+    const auto& repfield = this->_internal_speech_contexts(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(6, this->_internal_speech_contexts(i), target, stream);
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // int32 audio_channel_count = 7;
-  if (this->audio_channel_count() != 0) {
+  if (this->_internal_audio_channel_count() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(7, this->_internal_audio_channel_count(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_audio_channel_count(), target);
   }
 
   // string model = 10;
-  if (this->model().size() > 0) {
+  if (!this->_internal_model().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_model().data(), static_cast<int>(this->_internal_model().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1582,26 +3880,57 @@ failure:
   }
 
   // bool raw = 11;
-  if (this->raw() != 0) {
+  if (this->_internal_raw() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(11, this->_internal_raw(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(11, this->_internal_raw(), target);
   }
 
   // int32 data_bytes = 12;
-  if (this->data_bytes() != 0) {
+  if (this->_internal_data_bytes() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(12, this->_internal_data_bytes(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(12, this->_internal_data_bytes(), target);
   }
 
   // bool word_level = 13;
-  if (this->word_level() != 0) {
+  if (this->_internal_word_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_word_level(), target);
+  }
+
+  // .kaldi_serve.RecognitionConfig.Priority priority = 14;
+  if (this->_internal_priority() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      14, this->_internal_priority(), target);
+  }
+
+  // bool report_usage = 15;
+  if (this->_internal_report_usage() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(13, this->_internal_word_level(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_report_usage(), target);
+  }
+
+  // bool interim_results_on_change = 16;
+  if (this->_internal_interim_results_on_change() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(16, this->_internal_interim_results_on_change(), target);
+  }
+
+  // bool continuous = 17;
+  if (this->_internal_continuous() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(17, this->_internal_continuous(), target);
+  }
+
+  // int32 parallel_segments = 18;
+  if (this->_internal_parallel_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(18, this->_internal_parallel_segments(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognitionConfig)
   return target;
@@ -1611,151 +3940,165 @@ size_t RecognitionConfig::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognitionConfig)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
   total_size += 1UL * this->_internal_speech_contexts_size();
-  for (const auto& msg : this->speech_contexts_) {
+  for (const auto& msg : this->_impl_.speech_contexts_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string language_code = 3;
-  if (this->language_code().size() > 0) {
+  if (!this->_internal_language_code().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_language_code());
   }
 
   // string model = 10;
-  if (this->model().size() > 0) {
+  if (!this->_internal_model().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_model());
   }
 
   // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
-  if (this->encoding() != 0) {
+  if (this->_internal_encoding() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_encoding());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
   }
 
   // int32 sample_rate_hertz = 2;
-  if (this->sample_rate_hertz() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_sample_rate_hertz());
+  if (this->_internal_sample_rate_hertz() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_sample_rate_hertz());
   }
 
   // int32 max_alternatives = 4;
-  if (this->max_alternatives() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_max_alternatives());
+  if (this->_internal_max_alternatives() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_max_alternatives());
   }
 
   // int32 audio_channel_count = 7;
-  if (this->audio_channel_count() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_audio_channel_count());
+  if (this->_internal_audio_channel_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_audio_channel_count());
   }
 
   // bool punctuation = 5;
-  if (this->punctuation() != 0) {
+  if (this->_internal_punctuation() != 0) {
     total_size += 1 + 1;
   }
 
   // bool raw = 11;
-  if (this->raw() != 0) {
+  if (this->_internal_raw() != 0) {
     total_size += 1 + 1;
   }
 
   // bool word_level = 13;
-  if (this->word_level() != 0) {
+  if (this->_internal_word_level() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool report_usage = 15;
+  if (this->_internal_report_usage() != 0) {
     total_size += 1 + 1;
   }
 
   // int32 data_bytes = 12;
-  if (this->data_bytes() != 0) {
+  if (this->_internal_data_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_data_bytes());
+  }
+
+  // .kaldi_serve.RecognitionConfig.Priority priority = 14;
+  if (this->_internal_priority() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_data_bytes());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_priority());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // bool interim_results_on_change = 16;
+  if (this->_internal_interim_results_on_change() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool continuous = 17;
+  if (this->_internal_continuous() != 0) {
+    total_size += 2 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RecognitionConfig::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.RecognitionConfig)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RecognitionConfig* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RecognitionConfig>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.RecognitionConfig)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.RecognitionConfig)
-    MergeFrom(*source);
+  // int32 parallel_segments = 18;
+  if (this->_internal_parallel_segments() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_parallel_segments());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RecognitionConfig::MergeFrom(const RecognitionConfig& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognitionConfig)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecognitionConfig::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecognitionConfig::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecognitionConfig::GetClassData() const { return &_class_data_; }
 
-  speech_contexts_.MergeFrom(from.speech_contexts_);
-  if (from.language_code().size() > 0) {
 
-    language_code_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.language_code_);
-  }
-  if (from.model().size() > 0) {
+void RecognitionConfig::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecognitionConfig*>(&to_msg);
+  auto& from = static_cast<const RecognitionConfig&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognitionConfig)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    model_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.model_);
+  _this->_impl_.speech_contexts_.MergeFrom(from._impl_.speech_contexts_);
+  if (!from._internal_language_code().empty()) {
+    _this->_internal_set_language_code(from._internal_language_code());
   }
-  if (from.encoding() != 0) {
-    _internal_set_encoding(from._internal_encoding());
+  if (!from._internal_model().empty()) {
+    _this->_internal_set_model(from._internal_model());
   }
-  if (from.sample_rate_hertz() != 0) {
-    _internal_set_sample_rate_hertz(from._internal_sample_rate_hertz());
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
   }
-  if (from.max_alternatives() != 0) {
-    _internal_set_max_alternatives(from._internal_max_alternatives());
+  if (from._internal_sample_rate_hertz() != 0) {
+    _this->_internal_set_sample_rate_hertz(from._internal_sample_rate_hertz());
   }
-  if (from.audio_channel_count() != 0) {
-    _internal_set_audio_channel_count(from._internal_audio_channel_count());
+  if (from._internal_max_alternatives() != 0) {
+    _this->_internal_set_max_alternatives(from._internal_max_alternatives());
   }
-  if (from.punctuation() != 0) {
-    _internal_set_punctuation(from._internal_punctuation());
+  if (from._internal_audio_channel_count() != 0) {
+    _this->_internal_set_audio_channel_count(from._internal_audio_channel_count());
   }
-  if (from.raw() != 0) {
-    _internal_set_raw(from._internal_raw());
+  if (from._internal_punctuation() != 0) {
+    _this->_internal_set_punctuation(from._internal_punctuation());
   }
-  if (from.word_level() != 0) {
-    _internal_set_word_level(from._internal_word_level());
+  if (from._internal_raw() != 0) {
+    _this->_internal_set_raw(from._internal_raw());
   }
-  if (from.data_bytes() != 0) {
-    _internal_set_data_bytes(from._internal_data_bytes());
+  if (from._internal_word_level() != 0) {
+    _this->_internal_set_word_level(from._internal_word_level());
   }
-}
-
-void RecognitionConfig::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.RecognitionConfig)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_report_usage() != 0) {
+    _this->_internal_set_report_usage(from._internal_report_usage());
+  }
+  if (from._internal_data_bytes() != 0) {
+    _this->_internal_set_data_bytes(from._internal_data_bytes());
+  }
+  if (from._internal_priority() != 0) {
+    _this->_internal_set_priority(from._internal_priority());
+  }
+  if (from._internal_interim_results_on_change() != 0) {
+    _this->_internal_set_interim_results_on_change(from._internal_interim_results_on_change());
+  }
+  if (from._internal_continuous() != 0) {
+    _this->_internal_set_continuous(from._internal_continuous());
+  }
+  if (from._internal_parallel_segments() != 0) {
+    _this->_internal_set_parallel_segments(from._internal_parallel_segments());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RecognitionConfig::CopyFrom(const RecognitionConfig& from) {
@@ -1771,56 +4114,61 @@ bool RecognitionConfig::IsInitialized() const {
 
 void RecognitionConfig::InternalSwap(RecognitionConfig* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  speech_contexts_.InternalSwap(&other->speech_contexts_);
-  language_code_.Swap(&other->language_code_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  model_.Swap(&other->model_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(encoding_, other->encoding_);
-  swap(sample_rate_hertz_, other->sample_rate_hertz_);
-  swap(max_alternatives_, other->max_alternatives_);
-  swap(audio_channel_count_, other->audio_channel_count_);
-  swap(punctuation_, other->punctuation_);
-  swap(raw_, other->raw_);
-  swap(word_level_, other->word_level_);
-  swap(data_bytes_, other->data_bytes_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.speech_contexts_.InternalSwap(&other->_impl_.speech_contexts_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.language_code_, lhs_arena,
+      &other->_impl_.language_code_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.model_, lhs_arena,
+      &other->_impl_.model_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RecognitionConfig, _impl_.parallel_segments_)
+      + sizeof(RecognitionConfig::_impl_.parallel_segments_)
+      - PROTOBUF_FIELD_OFFSET(RecognitionConfig, _impl_.encoding_)>(
+          reinterpret_cast<char*>(&_impl_.encoding_),
+          reinterpret_cast<char*>(&other->_impl_.encoding_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RecognitionConfig::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void RecognitionAudio::InitAsDefaultInstance() {
-  ::kaldi_serve::_RecognitionAudio_default_instance_.content_.UnsafeSetDefault(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::kaldi_serve::_RecognitionAudio_default_instance_.uri_.UnsafeSetDefault(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
 class RecognitionAudio::_Internal {
  public:
 };
 
-RecognitionAudio::RecognitionAudio()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.RecognitionAudio)
+RecognitionAudio::RecognitionAudio(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.RecognitionAudio)
 }
 RecognitionAudio::RecognitionAudio(const RecognitionAudio& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecognitionAudio* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.audio_source_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_audio_source();
   switch (from.audio_source_case()) {
     case kContent: {
-      _internal_set_content(from._internal_content());
+      _this->_internal_set_content(from._internal_content());
       break;
     }
     case kUri: {
-      _internal_set_uri(from._internal_uri());
+      _this->_internal_set_uri(from._internal_uri());
       break;
     }
     case AUDIO_SOURCE_NOT_SET: {
@@ -1830,108 +4178,119 @@ RecognitionAudio::RecognitionAudio(const RecognitionAudio& from)
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.RecognitionAudio)
 }
 
-void RecognitionAudio::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RecognitionAudio_kaldi_5fserve_2eproto.base);
+inline void RecognitionAudio::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.audio_source_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_audio_source();
 }
 
 RecognitionAudio::~RecognitionAudio() {
   // @@protoc_insertion_point(destructor:kaldi_serve.RecognitionAudio)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RecognitionAudio::SharedDtor() {
+inline void RecognitionAudio::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_audio_source()) {
     clear_audio_source();
   }
 }
 
 void RecognitionAudio::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const RecognitionAudio& RecognitionAudio::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RecognitionAudio_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void RecognitionAudio::clear_audio_source() {
 // @@protoc_insertion_point(one_of_clear_start:kaldi_serve.RecognitionAudio)
   switch (audio_source_case()) {
     case kContent: {
-      audio_source_.content_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+      _impl_.audio_source_.content_.Destroy();
       break;
     }
     case kUri: {
-      audio_source_.uri_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+      _impl_.audio_source_.uri_.Destroy();
       break;
     }
     case AUDIO_SOURCE_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = AUDIO_SOURCE_NOT_SET;
+  _impl_._oneof_case_[0] = AUDIO_SOURCE_NOT_SET;
 }
 
 
 void RecognitionAudio::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.RecognitionAudio)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   clear_audio_source();
-  _internal_metadata_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RecognitionAudio::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RecognitionAudio::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // bytes content = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_content();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string uri = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_uri();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.RecognitionAudio.uri"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.RecognitionAudio.uri"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RecognitionAudio::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* RecognitionAudio::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.RecognitionAudio)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bytes content = 1;
@@ -1951,8 +4310,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.RecognitionAudio)
   return target;
@@ -1962,7 +4321,7 @@ size_t RecognitionAudio::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.RecognitionAudio)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -1985,57 +4344,38 @@ size_t RecognitionAudio::ByteSizeLong() const {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RecognitionAudio::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.RecognitionAudio)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RecognitionAudio* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RecognitionAudio>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.RecognitionAudio)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.RecognitionAudio)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecognitionAudio::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecognitionAudio::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecognitionAudio::GetClassData() const { return &_class_data_; }
+
 
-void RecognitionAudio::MergeFrom(const RecognitionAudio& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognitionAudio)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void RecognitionAudio::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecognitionAudio*>(&to_msg);
+  auto& from = static_cast<const RecognitionAudio&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.RecognitionAudio)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.audio_source_case()) {
     case kContent: {
-      _internal_set_content(from._internal_content());
+      _this->_internal_set_content(from._internal_content());
       break;
     }
     case kUri: {
-      _internal_set_uri(from._internal_uri());
+      _this->_internal_set_uri(from._internal_uri());
       break;
     }
     case AUDIO_SOURCE_NOT_SET: {
       break;
     }
   }
-}
-
-void RecognitionAudio::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.RecognitionAudio)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RecognitionAudio::CopyFrom(const RecognitionAudio& from) {
@@ -2051,78 +4391,97 @@ bool RecognitionAudio::IsInitialized() const {
 
 void RecognitionAudio::InternalSwap(RecognitionAudio* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(audio_source_, other->audio_source_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.audio_source_, other->_impl_.audio_source_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RecognitionAudio::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[11]);
 }
 
-
 // ===================================================================
 
-void SpeechRecognitionResult::InitAsDefaultInstance() {
-}
 class SpeechRecognitionResult::_Internal {
  public:
 };
 
-SpeechRecognitionResult::SpeechRecognitionResult()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.SpeechRecognitionResult)
+SpeechRecognitionResult::SpeechRecognitionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.SpeechRecognitionResult)
 }
 SpeechRecognitionResult::SpeechRecognitionResult(const SpeechRecognitionResult& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      alternatives_(from.alternatives_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpeechRecognitionResult* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.alternatives_){from._impl_.alternatives_}
+    , decltype(_impl_.is_final_){}
+    , decltype(_impl_.stability_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.is_final_, &from._impl_.is_final_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.stability_) -
+    reinterpret_cast<char*>(&_impl_.is_final_)) + sizeof(_impl_.stability_));
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.SpeechRecognitionResult)
 }
 
-void SpeechRecognitionResult::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto.base);
+inline void SpeechRecognitionResult::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.alternatives_){arena}
+    , decltype(_impl_.is_final_){false}
+    , decltype(_impl_.stability_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 SpeechRecognitionResult::~SpeechRecognitionResult() {
   // @@protoc_insertion_point(destructor:kaldi_serve.SpeechRecognitionResult)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpeechRecognitionResult::SharedDtor() {
+inline void SpeechRecognitionResult::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.alternatives_.~RepeatedPtrField();
 }
 
 void SpeechRecognitionResult::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const SpeechRecognitionResult& SpeechRecognitionResult::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SpeechRecognitionResult_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void SpeechRecognitionResult::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.SpeechRecognitionResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  alternatives_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.alternatives_.Clear();
+  ::memset(&_impl_.is_final_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.stability_) -
+      reinterpret_cast<char*>(&_impl_.is_final_)) + sizeof(_impl_.stability_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SpeechRecognitionResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SpeechRecognitionResult::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -2130,45 +4489,81 @@ const char* SpeechRecognitionResult::_InternalParse(const char* ptr, ::PROTOBUF_
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_final = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.is_final_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float stability = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.stability_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SpeechRecognitionResult::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* SpeechRecognitionResult::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.SpeechRecognitionResult)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_alternatives_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_alternatives_size()); i < n; i++) {
+    const auto& repfield = this->_internal_alternatives(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_alternatives(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool is_final = 2;
+  if (this->_internal_is_final() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_is_final(), target);
+  }
+
+  // float stability = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_stability = this->_internal_stability();
+  uint32_t raw_stability;
+  memcpy(&raw_stability, &tmp_stability, sizeof(tmp_stability));
+  if (raw_stability != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_stability(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.SpeechRecognitionResult)
   return target;
@@ -2178,56 +4573,61 @@ size_t SpeechRecognitionResult::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.SpeechRecognitionResult)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
   total_size += 1UL * this->_internal_alternatives_size();
-  for (const auto& msg : this->alternatives_) {
+  for (const auto& msg : this->_impl_.alternatives_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // bool is_final = 2;
+  if (this->_internal_is_final() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void SpeechRecognitionResult::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.SpeechRecognitionResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SpeechRecognitionResult* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SpeechRecognitionResult>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.SpeechRecognitionResult)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.SpeechRecognitionResult)
-    MergeFrom(*source);
+  // float stability = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_stability = this->_internal_stability();
+  uint32_t raw_stability;
+  memcpy(&raw_stability, &tmp_stability, sizeof(tmp_stability));
+  if (raw_stability != 0) {
+    total_size += 1 + 4;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SpeechRecognitionResult::MergeFrom(const SpeechRecognitionResult& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechRecognitionResult)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpeechRecognitionResult::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpeechRecognitionResult::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpeechRecognitionResult::GetClassData() const { return &_class_data_; }
 
-  alternatives_.MergeFrom(from.alternatives_);
-}
 
-void SpeechRecognitionResult::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.SpeechRecognitionResult)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void SpeechRecognitionResult::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpeechRecognitionResult*>(&to_msg);
+  auto& from = static_cast<const SpeechRecognitionResult&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechRecognitionResult)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.alternatives_.MergeFrom(from._impl_.alternatives_);
+  if (from._internal_is_final() != 0) {
+    _this->_internal_set_is_final(from._internal_is_final());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_stability = from._internal_stability();
+  uint32_t raw_stability;
+  memcpy(&raw_stability, &tmp_stability, sizeof(tmp_stability));
+  if (raw_stability != 0) {
+    _this->_internal_set_stability(from._internal_stability());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SpeechRecognitionResult::CopyFrom(const SpeechRecognitionResult& from) {
@@ -2243,123 +4643,154 @@ bool SpeechRecognitionResult::IsInitialized() const {
 
 void SpeechRecognitionResult::InternalSwap(SpeechRecognitionResult* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  alternatives_.InternalSwap(&other->alternatives_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.alternatives_.InternalSwap(&other->_impl_.alternatives_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SpeechRecognitionResult, _impl_.stability_)
+      + sizeof(SpeechRecognitionResult::_impl_.stability_)
+      - PROTOBUF_FIELD_OFFSET(SpeechRecognitionResult, _impl_.is_final_)>(
+          reinterpret_cast<char*>(&_impl_.is_final_),
+          reinterpret_cast<char*>(&other->_impl_.is_final_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SpeechRecognitionResult::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[12]);
 }
 
-
 // ===================================================================
 
-void SpeechRecognitionAlternative::InitAsDefaultInstance() {
-}
 class SpeechRecognitionAlternative::_Internal {
  public:
 };
 
-SpeechRecognitionAlternative::SpeechRecognitionAlternative()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.SpeechRecognitionAlternative)
+SpeechRecognitionAlternative::SpeechRecognitionAlternative(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.SpeechRecognitionAlternative)
 }
 SpeechRecognitionAlternative::SpeechRecognitionAlternative(const SpeechRecognitionAlternative& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      words_(from.words_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  transcript_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpeechRecognitionAlternative* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.words_){from._impl_.words_}
+    , decltype(_impl_.transcript_){}
+    , decltype(_impl_.confidence_){}
+    , decltype(_impl_.am_score_){}
+    , decltype(_impl_.lm_score_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.transcript_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transcript_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_transcript().empty()) {
-    transcript_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.transcript_);
+    _this->_impl_.transcript_.Set(from._internal_transcript(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&confidence_, &from.confidence_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lm_score_) -
-    reinterpret_cast<char*>(&confidence_)) + sizeof(lm_score_));
+  ::memcpy(&_impl_.confidence_, &from._impl_.confidence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lm_score_) -
+    reinterpret_cast<char*>(&_impl_.confidence_)) + sizeof(_impl_.lm_score_));
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.SpeechRecognitionAlternative)
 }
 
-void SpeechRecognitionAlternative::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto.base);
-  transcript_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&confidence_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lm_score_) -
-      reinterpret_cast<char*>(&confidence_)) + sizeof(lm_score_));
+inline void SpeechRecognitionAlternative::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.words_){arena}
+    , decltype(_impl_.transcript_){}
+    , decltype(_impl_.confidence_){0}
+    , decltype(_impl_.am_score_){0}
+    , decltype(_impl_.lm_score_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.transcript_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transcript_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SpeechRecognitionAlternative::~SpeechRecognitionAlternative() {
   // @@protoc_insertion_point(destructor:kaldi_serve.SpeechRecognitionAlternative)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpeechRecognitionAlternative::SharedDtor() {
-  transcript_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SpeechRecognitionAlternative::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.words_.~RepeatedPtrField();
+  _impl_.transcript_.Destroy();
 }
 
 void SpeechRecognitionAlternative::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const SpeechRecognitionAlternative& SpeechRecognitionAlternative::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SpeechRecognitionAlternative_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void SpeechRecognitionAlternative::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.SpeechRecognitionAlternative)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  words_.Clear();
-  transcript_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&confidence_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lm_score_) -
-      reinterpret_cast<char*>(&confidence_)) + sizeof(lm_score_));
-  _internal_metadata_.Clear();
+  _impl_.words_.Clear();
+  _impl_.transcript_.ClearToEmpty();
+  ::memset(&_impl_.confidence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lm_score_) -
+      reinterpret_cast<char*>(&_impl_.confidence_)) + sizeof(_impl_.lm_score_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SpeechRecognitionAlternative::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SpeechRecognitionAlternative::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string transcript = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_transcript();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.SpeechRecognitionAlternative.transcript"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.SpeechRecognitionAlternative.transcript"));
+        } else
+          goto handle_unusual;
         continue;
       // float confidence = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float am_score = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 29)) {
-          am_score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.am_score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float lm_score = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37)) {
-          lm_score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.lm_score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .kaldi_serve.Word words = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -2367,36 +4798,40 @@ const char* SpeechRecognitionAlternative::_InternalParse(const char* ptr, ::PROT
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SpeechRecognitionAlternative::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* SpeechRecognitionAlternative::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.SpeechRecognitionAlternative)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string transcript = 1;
-  if (this->transcript().size() > 0) {
+  if (!this->_internal_transcript().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_transcript().data(), static_cast<int>(this->_internal_transcript().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2406,34 +4841,46 @@ failure:
   }
 
   // float confidence = 2;
-  if (!(this->confidence() <= 0 && this->confidence() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_confidence(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_confidence(), target);
   }
 
   // float am_score = 3;
-  if (!(this->am_score() <= 0 && this->am_score() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_am_score = this->_internal_am_score();
+  uint32_t raw_am_score;
+  memcpy(&raw_am_score, &tmp_am_score, sizeof(tmp_am_score));
+  if (raw_am_score != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(3, this->_internal_am_score(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_am_score(), target);
   }
 
   // float lm_score = 4;
-  if (!(this->lm_score() <= 0 && this->lm_score() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lm_score = this->_internal_lm_score();
+  uint32_t raw_lm_score;
+  memcpy(&raw_lm_score, &tmp_lm_score, sizeof(tmp_lm_score));
+  if (raw_lm_score != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(4, this->_internal_lm_score(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_lm_score(), target);
   }
 
   // repeated .kaldi_serve.Word words = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_words_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_words_size()); i < n; i++) {
+    const auto& repfield = this->_internal_words(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_words(i), target, stream);
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.SpeechRecognitionAlternative)
   return target;
@@ -2443,91 +4890,95 @@ size_t SpeechRecognitionAlternative::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.SpeechRecognitionAlternative)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .kaldi_serve.Word words = 5;
   total_size += 1UL * this->_internal_words_size();
-  for (const auto& msg : this->words_) {
+  for (const auto& msg : this->_impl_.words_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string transcript = 1;
-  if (this->transcript().size() > 0) {
+  if (!this->_internal_transcript().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_transcript());
   }
 
   // float confidence = 2;
-  if (!(this->confidence() <= 0 && this->confidence() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
     total_size += 1 + 4;
   }
 
   // float am_score = 3;
-  if (!(this->am_score() <= 0 && this->am_score() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_am_score = this->_internal_am_score();
+  uint32_t raw_am_score;
+  memcpy(&raw_am_score, &tmp_am_score, sizeof(tmp_am_score));
+  if (raw_am_score != 0) {
     total_size += 1 + 4;
   }
 
   // float lm_score = 4;
-  if (!(this->lm_score() <= 0 && this->lm_score() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lm_score = this->_internal_lm_score();
+  uint32_t raw_lm_score;
+  memcpy(&raw_lm_score, &tmp_lm_score, sizeof(tmp_lm_score));
+  if (raw_lm_score != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SpeechRecognitionAlternative::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.SpeechRecognitionAlternative)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SpeechRecognitionAlternative* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SpeechRecognitionAlternative>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.SpeechRecognitionAlternative)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.SpeechRecognitionAlternative)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpeechRecognitionAlternative::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpeechRecognitionAlternative::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpeechRecognitionAlternative::GetClassData() const { return &_class_data_; }
 
-void SpeechRecognitionAlternative::MergeFrom(const SpeechRecognitionAlternative& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechRecognitionAlternative)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  words_.MergeFrom(from.words_);
-  if (from.transcript().size() > 0) {
+void SpeechRecognitionAlternative::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpeechRecognitionAlternative*>(&to_msg);
+  auto& from = static_cast<const SpeechRecognitionAlternative&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechRecognitionAlternative)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    transcript_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.transcript_);
+  _this->_impl_.words_.MergeFrom(from._impl_.words_);
+  if (!from._internal_transcript().empty()) {
+    _this->_internal_set_transcript(from._internal_transcript());
   }
-  if (!(from.confidence() <= 0 && from.confidence() >= 0)) {
-    _internal_set_confidence(from._internal_confidence());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = from._internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    _this->_internal_set_confidence(from._internal_confidence());
   }
-  if (!(from.am_score() <= 0 && from.am_score() >= 0)) {
-    _internal_set_am_score(from._internal_am_score());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_am_score = from._internal_am_score();
+  uint32_t raw_am_score;
+  memcpy(&raw_am_score, &tmp_am_score, sizeof(tmp_am_score));
+  if (raw_am_score != 0) {
+    _this->_internal_set_am_score(from._internal_am_score());
   }
-  if (!(from.lm_score() <= 0 && from.lm_score() >= 0)) {
-    _internal_set_lm_score(from._internal_lm_score());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lm_score = from._internal_lm_score();
+  uint32_t raw_lm_score;
+  memcpy(&raw_lm_score, &tmp_lm_score, sizeof(tmp_lm_score));
+  if (raw_lm_score != 0) {
+    _this->_internal_set_lm_score(from._internal_lm_score());
   }
-}
-
-void SpeechRecognitionAlternative::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.SpeechRecognitionAlternative)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SpeechRecognitionAlternative::CopyFrom(const SpeechRecognitionAlternative& from) {
@@ -2543,163 +4994,204 @@ bool SpeechRecognitionAlternative::IsInitialized() const {
 
 void SpeechRecognitionAlternative::InternalSwap(SpeechRecognitionAlternative* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  words_.InternalSwap(&other->words_);
-  transcript_.Swap(&other->transcript_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(confidence_, other->confidence_);
-  swap(am_score_, other->am_score_);
-  swap(lm_score_, other->lm_score_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.words_.InternalSwap(&other->_impl_.words_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.transcript_, lhs_arena,
+      &other->_impl_.transcript_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SpeechRecognitionAlternative, _impl_.lm_score_)
+      + sizeof(SpeechRecognitionAlternative::_impl_.lm_score_)
+      - PROTOBUF_FIELD_OFFSET(SpeechRecognitionAlternative, _impl_.confidence_)>(
+          reinterpret_cast<char*>(&_impl_.confidence_),
+          reinterpret_cast<char*>(&other->_impl_.confidence_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SpeechRecognitionAlternative::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[13]);
 }
 
-
 // ===================================================================
 
-void Word::InitAsDefaultInstance() {
-}
 class Word::_Internal {
  public:
 };
 
-Word::Word()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.Word)
+Word::Word(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.Word)
 }
 Word::Word(const Word& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  word_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Word* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.word_){}
+    , decltype(_impl_.start_time_){}
+    , decltype(_impl_.end_time_){}
+    , decltype(_impl_.confidence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.word_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.word_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_word().empty()) {
-    word_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.word_);
+    _this->_impl_.word_.Set(from._internal_word(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&start_time_, &from.start_time_,
-    static_cast<size_t>(reinterpret_cast<char*>(&confidence_) -
-    reinterpret_cast<char*>(&start_time_)) + sizeof(confidence_));
+  ::memcpy(&_impl_.start_time_, &from._impl_.start_time_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.confidence_) -
+    reinterpret_cast<char*>(&_impl_.start_time_)) + sizeof(_impl_.confidence_));
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.Word)
 }
 
-void Word::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Word_kaldi_5fserve_2eproto.base);
-  word_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&start_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&confidence_) -
-      reinterpret_cast<char*>(&start_time_)) + sizeof(confidence_));
+inline void Word::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.word_){}
+    , decltype(_impl_.start_time_){0}
+    , decltype(_impl_.end_time_){0}
+    , decltype(_impl_.confidence_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.word_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.word_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Word::~Word() {
   // @@protoc_insertion_point(destructor:kaldi_serve.Word)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Word::SharedDtor() {
-  word_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Word::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.word_.Destroy();
 }
 
 void Word::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Word& Word::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Word_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Word::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.Word)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  word_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&start_time_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&confidence_) -
-      reinterpret_cast<char*>(&start_time_)) + sizeof(confidence_));
-  _internal_metadata_.Clear();
+  _impl_.word_.ClearToEmpty();
+  ::memset(&_impl_.start_time_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.confidence_) -
+      reinterpret_cast<char*>(&_impl_.start_time_)) + sizeof(_impl_.confidence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Word::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Word::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // float start_time = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 13)) {
-          start_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.start_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // float end_time = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          end_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.end_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string word = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_word();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.Word.word"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.Word.word"));
+        } else
+          goto handle_unusual;
         continue;
       // float confidence = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 37)) {
-          confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _impl_.confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
           ptr += sizeof(float);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Word::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Word::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.Word)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // float start_time = 1;
-  if (!(this->start_time() <= 0 && this->start_time() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_start_time = this->_internal_start_time();
+  uint32_t raw_start_time;
+  memcpy(&raw_start_time, &tmp_start_time, sizeof(tmp_start_time));
+  if (raw_start_time != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(1, this->_internal_start_time(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_start_time(), target);
   }
 
   // float end_time = 2;
-  if (!(this->end_time() <= 0 && this->end_time() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_end_time = this->_internal_end_time();
+  uint32_t raw_end_time;
+  memcpy(&raw_end_time, &tmp_end_time, sizeof(tmp_end_time));
+  if (raw_end_time != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(2, this->_internal_end_time(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_end_time(), target);
   }
 
   // string word = 3;
-  if (this->word().size() > 0) {
+  if (!this->_internal_word().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_word().data(), static_cast<int>(this->_internal_word().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2709,14 +5201,18 @@ failure:
   }
 
   // float confidence = 4;
-  if (!(this->confidence() <= 0 && this->confidence() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(4, this->_internal_confidence(), target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_confidence(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.Word)
   return target;
@@ -2726,83 +5222,87 @@ size_t Word::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.Word)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string word = 3;
-  if (this->word().size() > 0) {
+  if (!this->_internal_word().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_word());
   }
 
   // float start_time = 1;
-  if (!(this->start_time() <= 0 && this->start_time() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_start_time = this->_internal_start_time();
+  uint32_t raw_start_time;
+  memcpy(&raw_start_time, &tmp_start_time, sizeof(tmp_start_time));
+  if (raw_start_time != 0) {
     total_size += 1 + 4;
   }
 
   // float end_time = 2;
-  if (!(this->end_time() <= 0 && this->end_time() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_end_time = this->_internal_end_time();
+  uint32_t raw_end_time;
+  memcpy(&raw_end_time, &tmp_end_time, sizeof(tmp_end_time));
+  if (raw_end_time != 0) {
     total_size += 1 + 4;
   }
 
   // float confidence = 4;
-  if (!(this->confidence() <= 0 && this->confidence() >= 0)) {
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
     total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Word::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.Word)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Word* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Word>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.Word)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.Word)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Word::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Word::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Word::GetClassData() const { return &_class_data_; }
 
-void Word::MergeFrom(const Word& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.Word)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.word().size() > 0) {
+void Word::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Word*>(&to_msg);
+  auto& from = static_cast<const Word&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.Word)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    word_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.word_);
+  if (!from._internal_word().empty()) {
+    _this->_internal_set_word(from._internal_word());
   }
-  if (!(from.start_time() <= 0 && from.start_time() >= 0)) {
-    _internal_set_start_time(from._internal_start_time());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_start_time = from._internal_start_time();
+  uint32_t raw_start_time;
+  memcpy(&raw_start_time, &tmp_start_time, sizeof(tmp_start_time));
+  if (raw_start_time != 0) {
+    _this->_internal_set_start_time(from._internal_start_time());
   }
-  if (!(from.end_time() <= 0 && from.end_time() >= 0)) {
-    _internal_set_end_time(from._internal_end_time());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_end_time = from._internal_end_time();
+  uint32_t raw_end_time;
+  memcpy(&raw_end_time, &tmp_end_time, sizeof(tmp_end_time));
+  if (raw_end_time != 0) {
+    _this->_internal_set_end_time(from._internal_end_time());
   }
-  if (!(from.confidence() <= 0 && from.confidence() >= 0)) {
-    _internal_set_confidence(from._internal_confidence());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = from._internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    _this->_internal_set_confidence(from._internal_confidence());
   }
-}
-
-void Word::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.Word)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Word::CopyFrom(const Word& from) {
@@ -2818,132 +5318,162 @@ bool Word::IsInitialized() const {
 
 void Word::InternalSwap(Word* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  word_.Swap(&other->word_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(start_time_, other->start_time_);
-  swap(end_time_, other->end_time_);
-  swap(confidence_, other->confidence_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.word_, lhs_arena,
+      &other->_impl_.word_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Word, _impl_.confidence_)
+      + sizeof(Word::_impl_.confidence_)
+      - PROTOBUF_FIELD_OFFSET(Word, _impl_.start_time_)>(
+          reinterpret_cast<char*>(&_impl_.start_time_),
+          reinterpret_cast<char*>(&other->_impl_.start_time_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Word::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[14]);
 }
 
-
 // ===================================================================
 
-void SpeechContext::InitAsDefaultInstance() {
-}
 class SpeechContext::_Internal {
  public:
 };
 
-SpeechContext::SpeechContext()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:kaldi_serve.SpeechContext)
+SpeechContext::SpeechContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:kaldi_serve.SpeechContext)
 }
 SpeechContext::SpeechContext(const SpeechContext& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      phrases_(from.phrases_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SpeechContext* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.phrases_){from._impl_.phrases_}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_type().empty()) {
-    type_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.type_);
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:kaldi_serve.SpeechContext)
 }
 
-void SpeechContext::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SpeechContext_kaldi_5fserve_2eproto.base);
-  type_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SpeechContext::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.phrases_){arena}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 SpeechContext::~SpeechContext() {
   // @@protoc_insertion_point(destructor:kaldi_serve.SpeechContext)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SpeechContext::SharedDtor() {
-  type_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SpeechContext::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.phrases_.~RepeatedPtrField();
+  _impl_.type_.Destroy();
 }
 
 void SpeechContext::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const SpeechContext& SpeechContext::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SpeechContext_kaldi_5fserve_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void SpeechContext::Clear() {
 // @@protoc_insertion_point(message_clear_start:kaldi_serve.SpeechContext)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  phrases_.Clear();
-  type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
+  _impl_.phrases_.Clear();
+  _impl_.type_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SpeechContext::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SpeechContext::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated string phrases = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
             auto str = _internal_add_phrases();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.SpeechContext.phrases"));
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.SpeechContext.phrases"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // string type = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_type();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "kaldi_serve.SpeechContext.type"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+          CHK_(::_pbi::VerifyUTF8(str, "kaldi_serve.SpeechContext.type"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* SpeechContext::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* SpeechContext::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:kaldi_serve.SpeechContext)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated string phrases = 1;
@@ -2957,7 +5487,7 @@ failure:
   }
 
   // string type = 2;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2967,8 +5497,8 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:kaldi_serve.SpeechContext)
   return target;
@@ -2978,68 +5508,48 @@ size_t SpeechContext::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:kaldi_serve.SpeechContext)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated string phrases = 1;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(phrases_.size());
-  for (int i = 0, n = phrases_.size(); i < n; i++) {
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.phrases_.size());
+  for (int i = 0, n = _impl_.phrases_.size(); i < n; i++) {
     total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      phrases_.Get(i));
+      _impl_.phrases_.Get(i));
   }
 
   // string type = 2;
-  if (this->type().size() > 0) {
+  if (!this->_internal_type().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_type());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SpeechContext::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:kaldi_serve.SpeechContext)
-  GOOGLE_DCHECK_NE(&from, this);
-  const SpeechContext* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SpeechContext>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:kaldi_serve.SpeechContext)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:kaldi_serve.SpeechContext)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SpeechContext::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SpeechContext::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SpeechContext::GetClassData() const { return &_class_data_; }
 
-void SpeechContext::MergeFrom(const SpeechContext& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechContext)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  phrases_.MergeFrom(from.phrases_);
-  if (from.type().size() > 0) {
+void SpeechContext::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SpeechContext*>(&to_msg);
+  auto& from = static_cast<const SpeechContext&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:kaldi_serve.SpeechContext)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    type_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.type_);
+  _this->_impl_.phrases_.MergeFrom(from._impl_.phrases_);
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
   }
-}
-
-void SpeechContext::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:kaldi_serve.SpeechContext)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SpeechContext::CopyFrom(const SpeechContext& from) {
@@ -3055,49 +5565,88 @@ bool SpeechContext::IsInitialized() const {
 
 void SpeechContext::InternalSwap(SpeechContext* other) {
   using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  phrases_.InternalSwap(&other->phrases_);
-  type_.Swap(&other->type_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.phrases_.InternalSwap(&other->_impl_.phrases_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SpeechContext::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kaldi_5fserve_2eproto_getter, &descriptor_table_kaldi_5fserve_2eproto_once,
+      file_level_metadata_kaldi_5fserve_2eproto[15]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace kaldi_serve
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::kaldi_serve::ModelList* Arena::CreateMaybeMessage< ::kaldi_serve::ModelList >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::ModelList >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::ModelList*
+Arena::CreateMaybeMessage< ::kaldi_serve::ModelList >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::ModelList >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::Model*
+Arena::CreateMaybeMessage< ::kaldi_serve::Model >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::Model >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::ServerStats*
+Arena::CreateMaybeMessage< ::kaldi_serve::ServerStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::ServerStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::ModelStats*
+Arena::CreateMaybeMessage< ::kaldi_serve::ModelStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::ModelStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::ModelMemory*
+Arena::CreateMaybeMessage< ::kaldi_serve::ModelMemory >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::ModelMemory >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognizeRequest*
+Arena::CreateMaybeMessage< ::kaldi_serve::RecognizeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::RecognizeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::kaldi_serve::BatchRecognizeRequest*
+Arena::CreateMaybeMessage< ::kaldi_serve::BatchRecognizeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::BatchRecognizeRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::Model* Arena::CreateMaybeMessage< ::kaldi_serve::Model >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::Model >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::BatchRecognizeResponse*
+Arena::CreateMaybeMessage< ::kaldi_serve::BatchRecognizeResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::BatchRecognizeResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognizeRequest* Arena::CreateMaybeMessage< ::kaldi_serve::RecognizeRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::RecognizeRequest >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognizeResponse*
+Arena::CreateMaybeMessage< ::kaldi_serve::RecognizeResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::RecognizeResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognizeResponse* Arena::CreateMaybeMessage< ::kaldi_serve::RecognizeResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::RecognizeResponse >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::ResourceUsage*
+Arena::CreateMaybeMessage< ::kaldi_serve::ResourceUsage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::ResourceUsage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognitionConfig* Arena::CreateMaybeMessage< ::kaldi_serve::RecognitionConfig >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::RecognitionConfig >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognitionConfig*
+Arena::CreateMaybeMessage< ::kaldi_serve::RecognitionConfig >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::RecognitionConfig >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognitionAudio* Arena::CreateMaybeMessage< ::kaldi_serve::RecognitionAudio >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::RecognitionAudio >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::RecognitionAudio*
+Arena::CreateMaybeMessage< ::kaldi_serve::RecognitionAudio >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::RecognitionAudio >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechRecognitionResult* Arena::CreateMaybeMessage< ::kaldi_serve::SpeechRecognitionResult >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::SpeechRecognitionResult >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechRecognitionResult*
+Arena::CreateMaybeMessage< ::kaldi_serve::SpeechRecognitionResult >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::SpeechRecognitionResult >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechRecognitionAlternative* Arena::CreateMaybeMessage< ::kaldi_serve::SpeechRecognitionAlternative >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::SpeechRecognitionAlternative >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechRecognitionAlternative*
+Arena::CreateMaybeMessage< ::kaldi_serve::SpeechRecognitionAlternative >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::SpeechRecognitionAlternative >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::Word* Arena::CreateMaybeMessage< ::kaldi_serve::Word >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::Word >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::Word*
+Arena::CreateMaybeMessage< ::kaldi_serve::Word >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::Word >(arena);
 }
-template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechContext* Arena::CreateMaybeMessage< ::kaldi_serve::SpeechContext >(Arena* arena) {
-  return Arena::CreateInternal< ::kaldi_serve::SpeechContext >(arena);
+template<> PROTOBUF_NOINLINE ::kaldi_serve::SpeechContext*
+Arena::CreateMaybeMessage< ::kaldi_serve::SpeechContext >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::kaldi_serve::SpeechContext >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
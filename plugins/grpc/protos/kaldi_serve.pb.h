@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3011000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3011002 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,10 +23,8 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
@@ -45,56 +43,72 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_kaldi_5fserve_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[10]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_kaldi_5fserve_2eproto;
 namespace kaldi_serve {
+class BatchRecognizeRequest;
+struct BatchRecognizeRequestDefaultTypeInternal;
+extern BatchRecognizeRequestDefaultTypeInternal _BatchRecognizeRequest_default_instance_;
+class BatchRecognizeResponse;
+struct BatchRecognizeResponseDefaultTypeInternal;
+extern BatchRecognizeResponseDefaultTypeInternal _BatchRecognizeResponse_default_instance_;
 class Model;
-class ModelDefaultTypeInternal;
+struct ModelDefaultTypeInternal;
 extern ModelDefaultTypeInternal _Model_default_instance_;
 class ModelList;
-class ModelListDefaultTypeInternal;
+struct ModelListDefaultTypeInternal;
 extern ModelListDefaultTypeInternal _ModelList_default_instance_;
+class ModelMemory;
+struct ModelMemoryDefaultTypeInternal;
+extern ModelMemoryDefaultTypeInternal _ModelMemory_default_instance_;
+class ModelStats;
+struct ModelStatsDefaultTypeInternal;
+extern ModelStatsDefaultTypeInternal _ModelStats_default_instance_;
 class RecognitionAudio;
-class RecognitionAudioDefaultTypeInternal;
+struct RecognitionAudioDefaultTypeInternal;
 extern RecognitionAudioDefaultTypeInternal _RecognitionAudio_default_instance_;
 class RecognitionConfig;
-class RecognitionConfigDefaultTypeInternal;
+struct RecognitionConfigDefaultTypeInternal;
 extern RecognitionConfigDefaultTypeInternal _RecognitionConfig_default_instance_;
 class RecognizeRequest;
-class RecognizeRequestDefaultTypeInternal;
+struct RecognizeRequestDefaultTypeInternal;
 extern RecognizeRequestDefaultTypeInternal _RecognizeRequest_default_instance_;
 class RecognizeResponse;
-class RecognizeResponseDefaultTypeInternal;
+struct RecognizeResponseDefaultTypeInternal;
 extern RecognizeResponseDefaultTypeInternal _RecognizeResponse_default_instance_;
+class ResourceUsage;
+struct ResourceUsageDefaultTypeInternal;
+extern ResourceUsageDefaultTypeInternal _ResourceUsage_default_instance_;
+class ServerStats;
+struct ServerStatsDefaultTypeInternal;
+extern ServerStatsDefaultTypeInternal _ServerStats_default_instance_;
 class SpeechContext;
-class SpeechContextDefaultTypeInternal;
+struct SpeechContextDefaultTypeInternal;
 extern SpeechContextDefaultTypeInternal _SpeechContext_default_instance_;
 class SpeechRecognitionAlternative;
-class SpeechRecognitionAlternativeDefaultTypeInternal;
+struct SpeechRecognitionAlternativeDefaultTypeInternal;
 extern SpeechRecognitionAlternativeDefaultTypeInternal _SpeechRecognitionAlternative_default_instance_;
 class SpeechRecognitionResult;
-class SpeechRecognitionResultDefaultTypeInternal;
+struct SpeechRecognitionResultDefaultTypeInternal;
 extern SpeechRecognitionResultDefaultTypeInternal _SpeechRecognitionResult_default_instance_;
 class Word;
-class WordDefaultTypeInternal;
+struct WordDefaultTypeInternal;
 extern WordDefaultTypeInternal _Word_default_instance_;
 }  // namespace kaldi_serve
 PROTOBUF_NAMESPACE_OPEN
+template<> ::kaldi_serve::BatchRecognizeRequest* Arena::CreateMaybeMessage<::kaldi_serve::BatchRecognizeRequest>(Arena*);
+template<> ::kaldi_serve::BatchRecognizeResponse* Arena::CreateMaybeMessage<::kaldi_serve::BatchRecognizeResponse>(Arena*);
 template<> ::kaldi_serve::Model* Arena::CreateMaybeMessage<::kaldi_serve::Model>(Arena*);
 template<> ::kaldi_serve::ModelList* Arena::CreateMaybeMessage<::kaldi_serve::ModelList>(Arena*);
+template<> ::kaldi_serve::ModelMemory* Arena::CreateMaybeMessage<::kaldi_serve::ModelMemory>(Arena*);
+template<> ::kaldi_serve::ModelStats* Arena::CreateMaybeMessage<::kaldi_serve::ModelStats>(Arena*);
 template<> ::kaldi_serve::RecognitionAudio* Arena::CreateMaybeMessage<::kaldi_serve::RecognitionAudio>(Arena*);
 template<> ::kaldi_serve::RecognitionConfig* Arena::CreateMaybeMessage<::kaldi_serve::RecognitionConfig>(Arena*);
 template<> ::kaldi_serve::RecognizeRequest* Arena::CreateMaybeMessage<::kaldi_serve::RecognizeRequest>(Arena*);
 template<> ::kaldi_serve::RecognizeResponse* Arena::CreateMaybeMessage<::kaldi_serve::RecognizeResponse>(Arena*);
+template<> ::kaldi_serve::ResourceUsage* Arena::CreateMaybeMessage<::kaldi_serve::ResourceUsage>(Arena*);
+template<> ::kaldi_serve::ServerStats* Arena::CreateMaybeMessage<::kaldi_serve::ServerStats>(Arena*);
 template<> ::kaldi_serve::SpeechContext* Arena::CreateMaybeMessage<::kaldi_serve::SpeechContext>(Arena*);
 template<> ::kaldi_serve::SpeechRecognitionAlternative* Arena::CreateMaybeMessage<::kaldi_serve::SpeechRecognitionAlternative>(Arena*);
 template<> ::kaldi_serve::SpeechRecognitionResult* Arena::CreateMaybeMessage<::kaldi_serve::SpeechRecognitionResult>(Arena*);
@@ -106,8 +120,8 @@ enum RecognitionConfig_AudioEncoding : int {
   RecognitionConfig_AudioEncoding_ENCODING_UNSPECIFIED = 0,
   RecognitionConfig_AudioEncoding_LINEAR16 = 1,
   RecognitionConfig_AudioEncoding_FLAC = 2,
-  RecognitionConfig_AudioEncoding_RecognitionConfig_AudioEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  RecognitionConfig_AudioEncoding_RecognitionConfig_AudioEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  RecognitionConfig_AudioEncoding_RecognitionConfig_AudioEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RecognitionConfig_AudioEncoding_RecognitionConfig_AudioEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool RecognitionConfig_AudioEncoding_IsValid(int value);
 constexpr RecognitionConfig_AudioEncoding RecognitionConfig_AudioEncoding_AudioEncoding_MIN = RecognitionConfig_AudioEncoding_ENCODING_UNSPECIFIED;
@@ -124,17 +138,44 @@ inline const std::string& RecognitionConfig_AudioEncoding_Name(T enum_t_value) {
     RecognitionConfig_AudioEncoding_descriptor(), enum_t_value);
 }
 inline bool RecognitionConfig_AudioEncoding_Parse(
-    const std::string& name, RecognitionConfig_AudioEncoding* value) {
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RecognitionConfig_AudioEncoding* value) {
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RecognitionConfig_AudioEncoding>(
     RecognitionConfig_AudioEncoding_descriptor(), name, value);
 }
+enum RecognitionConfig_Priority : int {
+  RecognitionConfig_Priority_PRIORITY_UNSPECIFIED = 0,
+  RecognitionConfig_Priority_LOW = 1,
+  RecognitionConfig_Priority_HIGH = 2,
+  RecognitionConfig_Priority_RecognitionConfig_Priority_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RecognitionConfig_Priority_RecognitionConfig_Priority_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RecognitionConfig_Priority_IsValid(int value);
+constexpr RecognitionConfig_Priority RecognitionConfig_Priority_Priority_MIN = RecognitionConfig_Priority_PRIORITY_UNSPECIFIED;
+constexpr RecognitionConfig_Priority RecognitionConfig_Priority_Priority_MAX = RecognitionConfig_Priority_HIGH;
+constexpr int RecognitionConfig_Priority_Priority_ARRAYSIZE = RecognitionConfig_Priority_Priority_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RecognitionConfig_Priority_descriptor();
+template<typename T>
+inline const std::string& RecognitionConfig_Priority_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RecognitionConfig_Priority>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RecognitionConfig_Priority_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RecognitionConfig_Priority_descriptor(), enum_t_value);
+}
+inline bool RecognitionConfig_Priority_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RecognitionConfig_Priority* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RecognitionConfig_Priority>(
+    RecognitionConfig_Priority_descriptor(), name, value);
+}
 // ===================================================================
 
-class ModelList :
+class ModelList final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.ModelList) */ {
  public:
-  ModelList();
-  virtual ~ModelList();
+  inline ModelList() : ModelList(nullptr) {}
+  ~ModelList() override;
+  explicit PROTOBUF_CONSTEXPR ModelList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ModelList(const ModelList& from);
   ModelList(ModelList&& from) noexcept
@@ -147,8 +188,13 @@ class ModelList :
     return *this;
   }
   inline ModelList& operator=(ModelList&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -159,14 +205,14 @@ class ModelList :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ModelList& default_instance() {
+    return *internal_default_instance();
   }
-  static const ModelList& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ModelList* internal_default_instance() {
     return reinterpret_cast<const ModelList*>(
                &_ModelList_default_instance_);
@@ -179,57 +225,66 @@ class ModelList :
   }
   inline void Swap(ModelList* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ModelList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ModelList* New() const final {
-    return CreateMaybeMessage<ModelList>(nullptr);
-  }
-
-  ModelList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ModelList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ModelList>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ModelList& from);
-  void MergeFrom(const ModelList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ModelList& from) {
+    ModelList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ModelList* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kaldi_serve.ModelList";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit ModelList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -260,18 +315,24 @@ class ModelList :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Model > models_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Model > models_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Model :
+class Model final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.Model) */ {
  public:
-  Model();
-  virtual ~Model();
+  inline Model() : Model(nullptr) {}
+  ~Model() override;
+  explicit PROTOBUF_CONSTEXPR Model(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Model(const Model& from);
   Model(Model&& from) noexcept
@@ -284,8 +345,13 @@ class Model :
     return *this;
   }
   inline Model& operator=(Model&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -296,14 +362,14 @@ class Model :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Model& default_instance() {
+    return *internal_default_instance();
   }
-  static const Model& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Model* internal_default_instance() {
     return reinterpret_cast<const Model*>(
                &_Model_default_instance_);
@@ -316,57 +382,66 @@ class Model :
   }
   inline void Swap(Model* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Model* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Model* New() const final {
-    return CreateMaybeMessage<Model>(nullptr);
-  }
-
-  Model* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Model* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Model>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Model& from);
-  void MergeFrom(const Model& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Model& from) {
+    Model::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Model* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "kaldi_serve.Model";
   }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
+  protected:
+  explicit Model(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -379,32 +454,28 @@ class Model :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
   // string language_code = 2;
   void clear_language_code();
   const std::string& language_code() const;
-  void set_language_code(const std::string& value);
-  void set_language_code(std::string&& value);
-  void set_language_code(const char* value);
-  void set_language_code(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_language_code(ArgT0&& arg0, ArgT... args);
   std::string* mutable_language_code();
-  std::string* release_language_code();
+  PROTOBUF_NODISCARD std::string* release_language_code();
   void set_allocated_language_code(std::string* language_code);
   private:
   const std::string& _internal_language_code() const;
-  void _internal_set_language_code(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_language_code(const std::string& value);
   std::string* _internal_mutable_language_code();
   public:
 
@@ -412,33 +483,44 @@ class Model :
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr language_code_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr language_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RecognizeRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognizeRequest) */ {
+class ServerStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.ServerStats) */ {
  public:
-  RecognizeRequest();
-  virtual ~RecognizeRequest();
+  inline ServerStats() : ServerStats(nullptr) {}
+  ~ServerStats() override;
+  explicit PROTOBUF_CONSTEXPR ServerStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RecognizeRequest(const RecognizeRequest& from);
-  RecognizeRequest(RecognizeRequest&& from) noexcept
-    : RecognizeRequest() {
+  ServerStats(const ServerStats& from);
+  ServerStats(ServerStats&& from) noexcept
+    : ServerStats() {
     *this = ::std::move(from);
   }
 
-  inline RecognizeRequest& operator=(const RecognizeRequest& from) {
+  inline ServerStats& operator=(const ServerStats& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RecognizeRequest& operator=(RecognizeRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ServerStats& operator=(ServerStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -449,165 +531,164 @@ class RecognizeRequest :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RecognizeRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RecognizeRequest* internal_default_instance() {
-    return reinterpret_cast<const RecognizeRequest*>(
-               &_RecognizeRequest_default_instance_);
+  static const ServerStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStats* internal_default_instance() {
+    return reinterpret_cast<const ServerStats*>(
+               &_ServerStats_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     2;
 
-  friend void swap(RecognizeRequest& a, RecognizeRequest& b) {
+  friend void swap(ServerStats& a, ServerStats& b) {
     a.Swap(&b);
   }
-  inline void Swap(RecognizeRequest* other) {
+  inline void Swap(ServerStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStats* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RecognizeRequest* New() const final {
-    return CreateMaybeMessage<RecognizeRequest>(nullptr);
+  ServerStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStats>(arena);
   }
-
-  RecognizeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RecognizeRequest>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStats& from) {
+    ServerStats::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RecognizeRequest& from);
-  void MergeFrom(const RecognizeRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RecognizeRequest* other);
+  void InternalSwap(ServerStats* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "kaldi_serve.RecognizeRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "kaldi_serve.ServerStats";
   }
+  protected:
+  explicit ServerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUuidFieldNumber = 3,
-    kConfigFieldNumber = 1,
-    kAudioFieldNumber = 2,
+    kModelsFieldNumber = 1,
+    kMemoryRssBytesFieldNumber = 2,
   };
-  // string uuid = 3;
-  void clear_uuid();
-  const std::string& uuid() const;
-  void set_uuid(const std::string& value);
-  void set_uuid(std::string&& value);
-  void set_uuid(const char* value);
-  void set_uuid(const char* value, size_t size);
-  std::string* mutable_uuid();
-  std::string* release_uuid();
-  void set_allocated_uuid(std::string* uuid);
-  private:
-  const std::string& _internal_uuid() const;
-  void _internal_set_uuid(const std::string& value);
-  std::string* _internal_mutable_uuid();
-  public:
-
-  // .kaldi_serve.RecognitionConfig config = 1;
-  bool has_config() const;
+  // repeated .kaldi_serve.ModelStats models = 1;
+  int models_size() const;
   private:
-  bool _internal_has_config() const;
+  int _internal_models_size() const;
   public:
-  void clear_config();
-  const ::kaldi_serve::RecognitionConfig& config() const;
-  ::kaldi_serve::RecognitionConfig* release_config();
-  ::kaldi_serve::RecognitionConfig* mutable_config();
-  void set_allocated_config(::kaldi_serve::RecognitionConfig* config);
+  void clear_models();
+  ::kaldi_serve::ModelStats* mutable_models(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::ModelStats >*
+      mutable_models();
   private:
-  const ::kaldi_serve::RecognitionConfig& _internal_config() const;
-  ::kaldi_serve::RecognitionConfig* _internal_mutable_config();
+  const ::kaldi_serve::ModelStats& _internal_models(int index) const;
+  ::kaldi_serve::ModelStats* _internal_add_models();
   public:
+  const ::kaldi_serve::ModelStats& models(int index) const;
+  ::kaldi_serve::ModelStats* add_models();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::ModelStats >&
+      models() const;
 
-  // .kaldi_serve.RecognitionAudio audio = 2;
-  bool has_audio() const;
-  private:
-  bool _internal_has_audio() const;
-  public:
-  void clear_audio();
-  const ::kaldi_serve::RecognitionAudio& audio() const;
-  ::kaldi_serve::RecognitionAudio* release_audio();
-  ::kaldi_serve::RecognitionAudio* mutable_audio();
-  void set_allocated_audio(::kaldi_serve::RecognitionAudio* audio);
+  // int64 memory_rss_bytes = 2;
+  void clear_memory_rss_bytes();
+  int64_t memory_rss_bytes() const;
+  void set_memory_rss_bytes(int64_t value);
   private:
-  const ::kaldi_serve::RecognitionAudio& _internal_audio() const;
-  ::kaldi_serve::RecognitionAudio* _internal_mutable_audio();
+  int64_t _internal_memory_rss_bytes() const;
+  void _internal_set_memory_rss_bytes(int64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:kaldi_serve.RecognizeRequest)
+  // @@protoc_insertion_point(class_scope:kaldi_serve.ServerStats)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
-  ::kaldi_serve::RecognitionConfig* config_;
-  ::kaldi_serve::RecognitionAudio* audio_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::ModelStats > models_;
+    int64_t memory_rss_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RecognizeResponse :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognizeResponse) */ {
+class ModelStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.ModelStats) */ {
  public:
-  RecognizeResponse();
-  virtual ~RecognizeResponse();
+  inline ModelStats() : ModelStats(nullptr) {}
+  ~ModelStats() override;
+  explicit PROTOBUF_CONSTEXPR ModelStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RecognizeResponse(const RecognizeResponse& from);
-  RecognizeResponse(RecognizeResponse&& from) noexcept
-    : RecognizeResponse() {
+  ModelStats(const ModelStats& from);
+  ModelStats(ModelStats&& from) noexcept
+    : ModelStats() {
     *this = ::std::move(from);
   }
 
-  inline RecognizeResponse& operator=(const RecognizeResponse& from) {
+  inline ModelStats& operator=(const ModelStats& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RecognizeResponse& operator=(RecognizeResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ModelStats& operator=(ModelStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -618,133 +699,239 @@ class RecognizeResponse :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RecognizeResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RecognizeResponse* internal_default_instance() {
-    return reinterpret_cast<const RecognizeResponse*>(
-               &_RecognizeResponse_default_instance_);
+  static const ModelStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ModelStats* internal_default_instance() {
+    return reinterpret_cast<const ModelStats*>(
+               &_ModelStats_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     3;
 
-  friend void swap(RecognizeResponse& a, RecognizeResponse& b) {
+  friend void swap(ModelStats& a, ModelStats& b) {
     a.Swap(&b);
   }
-  inline void Swap(RecognizeResponse* other) {
+  inline void Swap(ModelStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ModelStats* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RecognizeResponse* New() const final {
-    return CreateMaybeMessage<RecognizeResponse>(nullptr);
+  ModelStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModelStats>(arena);
   }
-
-  RecognizeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RecognizeResponse>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ModelStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ModelStats& from) {
+    ModelStats::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RecognizeResponse& from);
-  void MergeFrom(const RecognizeResponse& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RecognizeResponse* other);
+  void InternalSwap(ModelStats* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "kaldi_serve.RecognizeResponse";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "kaldi_serve.ModelStats";
   }
+  protected:
+  explicit ModelStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kResultsFieldNumber = 1,
+    kModelFieldNumber = 1,
+    kMemoryFieldNumber = 8,
+    kDecodersFieldNumber = 2,
+    kIdleDecodersFieldNumber = 3,
+    kMaxDecodersFieldNumber = 4,
+    kWaitingRequestsFieldNumber = 5,
+    kRealTimeFactorFieldNumber = 6,
+    kDecoderHoldSecsFieldNumber = 7,
   };
-  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
-  int results_size() const;
+  // .kaldi_serve.Model model = 1;
+  bool has_model() const;
   private:
-  int _internal_results_size() const;
+  bool _internal_has_model() const;
   public:
-  void clear_results();
-  ::kaldi_serve::SpeechRecognitionResult* mutable_results(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >*
-      mutable_results();
+  void clear_model();
+  const ::kaldi_serve::Model& model() const;
+  PROTOBUF_NODISCARD ::kaldi_serve::Model* release_model();
+  ::kaldi_serve::Model* mutable_model();
+  void set_allocated_model(::kaldi_serve::Model* model);
   private:
-  const ::kaldi_serve::SpeechRecognitionResult& _internal_results(int index) const;
-  ::kaldi_serve::SpeechRecognitionResult* _internal_add_results();
+  const ::kaldi_serve::Model& _internal_model() const;
+  ::kaldi_serve::Model* _internal_mutable_model();
   public:
-  const ::kaldi_serve::SpeechRecognitionResult& results(int index) const;
-  ::kaldi_serve::SpeechRecognitionResult* add_results();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >&
-      results() const;
+  void unsafe_arena_set_allocated_model(
+      ::kaldi_serve::Model* model);
+  ::kaldi_serve::Model* unsafe_arena_release_model();
 
-  // @@protoc_insertion_point(class_scope:kaldi_serve.RecognizeResponse)
+  // .kaldi_serve.ModelMemory memory = 8;
+  bool has_memory() const;
+  private:
+  bool _internal_has_memory() const;
+  public:
+  void clear_memory();
+  const ::kaldi_serve::ModelMemory& memory() const;
+  PROTOBUF_NODISCARD ::kaldi_serve::ModelMemory* release_memory();
+  ::kaldi_serve::ModelMemory* mutable_memory();
+  void set_allocated_memory(::kaldi_serve::ModelMemory* memory);
+  private:
+  const ::kaldi_serve::ModelMemory& _internal_memory() const;
+  ::kaldi_serve::ModelMemory* _internal_mutable_memory();
+  public:
+  void unsafe_arena_set_allocated_memory(
+      ::kaldi_serve::ModelMemory* memory);
+  ::kaldi_serve::ModelMemory* unsafe_arena_release_memory();
+
+  // int32 decoders = 2;
+  void clear_decoders();
+  int32_t decoders() const;
+  void set_decoders(int32_t value);
+  private:
+  int32_t _internal_decoders() const;
+  void _internal_set_decoders(int32_t value);
+  public:
+
+  // int32 idle_decoders = 3;
+  void clear_idle_decoders();
+  int32_t idle_decoders() const;
+  void set_idle_decoders(int32_t value);
+  private:
+  int32_t _internal_idle_decoders() const;
+  void _internal_set_idle_decoders(int32_t value);
+  public:
+
+  // int32 max_decoders = 4;
+  void clear_max_decoders();
+  int32_t max_decoders() const;
+  void set_max_decoders(int32_t value);
+  private:
+  int32_t _internal_max_decoders() const;
+  void _internal_set_max_decoders(int32_t value);
+  public:
+
+  // int32 waiting_requests = 5;
+  void clear_waiting_requests();
+  int32_t waiting_requests() const;
+  void set_waiting_requests(int32_t value);
+  private:
+  int32_t _internal_waiting_requests() const;
+  void _internal_set_waiting_requests(int32_t value);
+  public:
+
+  // float real_time_factor = 6;
+  void clear_real_time_factor();
+  float real_time_factor() const;
+  void set_real_time_factor(float value);
+  private:
+  float _internal_real_time_factor() const;
+  void _internal_set_real_time_factor(float value);
+  public:
+
+  // float decoder_hold_secs = 7;
+  void clear_decoder_hold_secs();
+  float decoder_hold_secs() const;
+  void set_decoder_hold_secs(float value);
+  private:
+  float _internal_decoder_hold_secs() const;
+  void _internal_set_decoder_hold_secs(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.ModelStats)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult > results_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::kaldi_serve::Model* model_;
+    ::kaldi_serve::ModelMemory* memory_;
+    int32_t decoders_;
+    int32_t idle_decoders_;
+    int32_t max_decoders_;
+    int32_t waiting_requests_;
+    float real_time_factor_;
+    float decoder_hold_secs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RecognitionConfig :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognitionConfig) */ {
+class ModelMemory final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.ModelMemory) */ {
  public:
-  RecognitionConfig();
-  virtual ~RecognitionConfig();
+  inline ModelMemory() : ModelMemory(nullptr) {}
+  ~ModelMemory() override;
+  explicit PROTOBUF_CONSTEXPR ModelMemory(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RecognitionConfig(const RecognitionConfig& from);
-  RecognitionConfig(RecognitionConfig&& from) noexcept
-    : RecognitionConfig() {
+  ModelMemory(const ModelMemory& from);
+  ModelMemory(ModelMemory&& from) noexcept
+    : ModelMemory() {
     *this = ::std::move(from);
   }
 
-  inline RecognitionConfig& operator=(const RecognitionConfig& from) {
+  inline ModelMemory& operator=(const ModelMemory& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RecognitionConfig& operator=(RecognitionConfig&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ModelMemory& operator=(ModelMemory&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -755,289 +942,221 @@ class RecognitionConfig :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RecognitionConfig& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RecognitionConfig* internal_default_instance() {
-    return reinterpret_cast<const RecognitionConfig*>(
-               &_RecognitionConfig_default_instance_);
+  static const ModelMemory& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ModelMemory* internal_default_instance() {
+    return reinterpret_cast<const ModelMemory*>(
+               &_ModelMemory_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(RecognitionConfig& a, RecognitionConfig& b) {
+  friend void swap(ModelMemory& a, ModelMemory& b) {
     a.Swap(&b);
   }
-  inline void Swap(RecognitionConfig* other) {
+  inline void Swap(ModelMemory* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ModelMemory* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RecognitionConfig* New() const final {
-    return CreateMaybeMessage<RecognitionConfig>(nullptr);
+  ModelMemory* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ModelMemory>(arena);
   }
-
-  RecognitionConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RecognitionConfig>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ModelMemory& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ModelMemory& from) {
+    ModelMemory::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RecognitionConfig& from);
-  void MergeFrom(const RecognitionConfig& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RecognitionConfig* other);
+  void InternalSwap(ModelMemory* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "kaldi_serve.RecognitionConfig";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "kaldi_serve.ModelMemory";
   }
+  protected:
+  explicit ModelMemory(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHclgBytesFieldNumber = 1,
+    kAmNnetBytesFieldNumber = 2,
+    kIvectorExtractorBytesFieldNumber = 3,
+    kRnnlmBytesFieldNumber = 4,
+    kWordEmbeddingBytesFieldNumber = 5,
+    kLmFstBytesFieldNumber = 6,
+    kWordSymsBytesFieldNumber = 7,
+    kTotalBytesFieldNumber = 8,
+  };
+  // int64 hclg_bytes = 1;
+  void clear_hclg_bytes();
+  int64_t hclg_bytes() const;
+  void set_hclg_bytes(int64_t value);
   private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  int64_t _internal_hclg_bytes() const;
+  void _internal_set_hclg_bytes(int64_t value);
+  public:
 
+  // int64 am_nnet_bytes = 2;
+  void clear_am_nnet_bytes();
+  int64_t am_nnet_bytes() const;
+  void set_am_nnet_bytes(int64_t value);
+  private:
+  int64_t _internal_am_nnet_bytes() const;
+  void _internal_set_am_nnet_bytes(int64_t value);
   public:
 
-  // nested types ----------------------------------------------------
+  // int64 ivector_extractor_bytes = 3;
+  void clear_ivector_extractor_bytes();
+  int64_t ivector_extractor_bytes() const;
+  void set_ivector_extractor_bytes(int64_t value);
+  private:
+  int64_t _internal_ivector_extractor_bytes() const;
+  void _internal_set_ivector_extractor_bytes(int64_t value);
+  public:
 
-  typedef RecognitionConfig_AudioEncoding AudioEncoding;
-  static constexpr AudioEncoding ENCODING_UNSPECIFIED =
-    RecognitionConfig_AudioEncoding_ENCODING_UNSPECIFIED;
-  static constexpr AudioEncoding LINEAR16 =
-    RecognitionConfig_AudioEncoding_LINEAR16;
-  static constexpr AudioEncoding FLAC =
-    RecognitionConfig_AudioEncoding_FLAC;
-  static inline bool AudioEncoding_IsValid(int value) {
-    return RecognitionConfig_AudioEncoding_IsValid(value);
-  }
-  static constexpr AudioEncoding AudioEncoding_MIN =
-    RecognitionConfig_AudioEncoding_AudioEncoding_MIN;
-  static constexpr AudioEncoding AudioEncoding_MAX =
-    RecognitionConfig_AudioEncoding_AudioEncoding_MAX;
-  static constexpr int AudioEncoding_ARRAYSIZE =
-    RecognitionConfig_AudioEncoding_AudioEncoding_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  AudioEncoding_descriptor() {
-    return RecognitionConfig_AudioEncoding_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& AudioEncoding_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, AudioEncoding>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function AudioEncoding_Name.");
-    return RecognitionConfig_AudioEncoding_Name(enum_t_value);
-  }
-  static inline bool AudioEncoding_Parse(const std::string& name,
-      AudioEncoding* value) {
-    return RecognitionConfig_AudioEncoding_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kSpeechContextsFieldNumber = 6,
-    kLanguageCodeFieldNumber = 3,
-    kModelFieldNumber = 10,
-    kEncodingFieldNumber = 1,
-    kSampleRateHertzFieldNumber = 2,
-    kMaxAlternativesFieldNumber = 4,
-    kAudioChannelCountFieldNumber = 7,
-    kPunctuationFieldNumber = 5,
-    kRawFieldNumber = 11,
-    kWordLevelFieldNumber = 13,
-    kDataBytesFieldNumber = 12,
-  };
-  // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
-  int speech_contexts_size() const;
-  private:
-  int _internal_speech_contexts_size() const;
-  public:
-  void clear_speech_contexts();
-  ::kaldi_serve::SpeechContext* mutable_speech_contexts(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >*
-      mutable_speech_contexts();
-  private:
-  const ::kaldi_serve::SpeechContext& _internal_speech_contexts(int index) const;
-  ::kaldi_serve::SpeechContext* _internal_add_speech_contexts();
-  public:
-  const ::kaldi_serve::SpeechContext& speech_contexts(int index) const;
-  ::kaldi_serve::SpeechContext* add_speech_contexts();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >&
-      speech_contexts() const;
-
-  // string language_code = 3;
-  void clear_language_code();
-  const std::string& language_code() const;
-  void set_language_code(const std::string& value);
-  void set_language_code(std::string&& value);
-  void set_language_code(const char* value);
-  void set_language_code(const char* value, size_t size);
-  std::string* mutable_language_code();
-  std::string* release_language_code();
-  void set_allocated_language_code(std::string* language_code);
-  private:
-  const std::string& _internal_language_code() const;
-  void _internal_set_language_code(const std::string& value);
-  std::string* _internal_mutable_language_code();
-  public:
-
-  // string model = 10;
-  void clear_model();
-  const std::string& model() const;
-  void set_model(const std::string& value);
-  void set_model(std::string&& value);
-  void set_model(const char* value);
-  void set_model(const char* value, size_t size);
-  std::string* mutable_model();
-  std::string* release_model();
-  void set_allocated_model(std::string* model);
-  private:
-  const std::string& _internal_model() const;
-  void _internal_set_model(const std::string& value);
-  std::string* _internal_mutable_model();
-  public:
-
-  // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
-  void clear_encoding();
-  ::kaldi_serve::RecognitionConfig_AudioEncoding encoding() const;
-  void set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value);
-  private:
-  ::kaldi_serve::RecognitionConfig_AudioEncoding _internal_encoding() const;
-  void _internal_set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value);
-  public:
-
-  // int32 sample_rate_hertz = 2;
-  void clear_sample_rate_hertz();
-  ::PROTOBUF_NAMESPACE_ID::int32 sample_rate_hertz() const;
-  void set_sample_rate_hertz(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_sample_rate_hertz() const;
-  void _internal_set_sample_rate_hertz(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 max_alternatives = 4;
-  void clear_max_alternatives();
-  ::PROTOBUF_NAMESPACE_ID::int32 max_alternatives() const;
-  void set_max_alternatives(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int64 rnnlm_bytes = 4;
+  void clear_rnnlm_bytes();
+  int64_t rnnlm_bytes() const;
+  void set_rnnlm_bytes(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_max_alternatives() const;
-  void _internal_set_max_alternatives(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int64_t _internal_rnnlm_bytes() const;
+  void _internal_set_rnnlm_bytes(int64_t value);
   public:
 
-  // int32 audio_channel_count = 7;
-  void clear_audio_channel_count();
-  ::PROTOBUF_NAMESPACE_ID::int32 audio_channel_count() const;
-  void set_audio_channel_count(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_audio_channel_count() const;
-  void _internal_set_audio_channel_count(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // bool punctuation = 5;
-  void clear_punctuation();
-  bool punctuation() const;
-  void set_punctuation(bool value);
+  // int64 word_embedding_bytes = 5;
+  void clear_word_embedding_bytes();
+  int64_t word_embedding_bytes() const;
+  void set_word_embedding_bytes(int64_t value);
   private:
-  bool _internal_punctuation() const;
-  void _internal_set_punctuation(bool value);
+  int64_t _internal_word_embedding_bytes() const;
+  void _internal_set_word_embedding_bytes(int64_t value);
   public:
 
-  // bool raw = 11;
-  void clear_raw();
-  bool raw() const;
-  void set_raw(bool value);
+  // int64 lm_fst_bytes = 6;
+  void clear_lm_fst_bytes();
+  int64_t lm_fst_bytes() const;
+  void set_lm_fst_bytes(int64_t value);
   private:
-  bool _internal_raw() const;
-  void _internal_set_raw(bool value);
+  int64_t _internal_lm_fst_bytes() const;
+  void _internal_set_lm_fst_bytes(int64_t value);
   public:
 
-  // bool word_level = 13;
-  void clear_word_level();
-  bool word_level() const;
-  void set_word_level(bool value);
+  // int64 word_syms_bytes = 7;
+  void clear_word_syms_bytes();
+  int64_t word_syms_bytes() const;
+  void set_word_syms_bytes(int64_t value);
   private:
-  bool _internal_word_level() const;
-  void _internal_set_word_level(bool value);
+  int64_t _internal_word_syms_bytes() const;
+  void _internal_set_word_syms_bytes(int64_t value);
   public:
 
-  // int32 data_bytes = 12;
-  void clear_data_bytes();
-  ::PROTOBUF_NAMESPACE_ID::int32 data_bytes() const;
-  void set_data_bytes(::PROTOBUF_NAMESPACE_ID::int32 value);
+  // int64 total_bytes = 8;
+  void clear_total_bytes();
+  int64_t total_bytes() const;
+  void set_total_bytes(int64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_data_bytes() const;
-  void _internal_set_data_bytes(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int64_t _internal_total_bytes() const;
+  void _internal_set_total_bytes(int64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:kaldi_serve.RecognitionConfig)
+  // @@protoc_insertion_point(class_scope:kaldi_serve.ModelMemory)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext > speech_contexts_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr language_code_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr model_;
-  int encoding_;
-  ::PROTOBUF_NAMESPACE_ID::int32 sample_rate_hertz_;
-  ::PROTOBUF_NAMESPACE_ID::int32 max_alternatives_;
-  ::PROTOBUF_NAMESPACE_ID::int32 audio_channel_count_;
-  bool punctuation_;
-  bool raw_;
-  bool word_level_;
-  ::PROTOBUF_NAMESPACE_ID::int32 data_bytes_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t hclg_bytes_;
+    int64_t am_nnet_bytes_;
+    int64_t ivector_extractor_bytes_;
+    int64_t rnnlm_bytes_;
+    int64_t word_embedding_bytes_;
+    int64_t lm_fst_bytes_;
+    int64_t word_syms_bytes_;
+    int64_t total_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RecognitionAudio :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognitionAudio) */ {
+class RecognizeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognizeRequest) */ {
  public:
-  RecognitionAudio();
-  virtual ~RecognitionAudio();
+  inline RecognizeRequest() : RecognizeRequest(nullptr) {}
+  ~RecognizeRequest() override;
+  explicit PROTOBUF_CONSTEXPR RecognizeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RecognitionAudio(const RecognitionAudio& from);
-  RecognitionAudio(RecognitionAudio&& from) noexcept
-    : RecognitionAudio() {
+  RecognizeRequest(const RecognizeRequest& from);
+  RecognizeRequest(RecognizeRequest&& from) noexcept
+    : RecognizeRequest() {
     *this = ::std::move(from);
   }
 
-  inline RecognitionAudio& operator=(const RecognitionAudio& from) {
+  inline RecognizeRequest& operator=(const RecognizeRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RecognitionAudio& operator=(RecognitionAudio&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline RecognizeRequest& operator=(RecognizeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1048,173 +1167,205 @@ class RecognitionAudio :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RecognitionAudio& default_instance();
-
-  enum AudioSourceCase {
-    kContent = 1,
-    kUri = 2,
-    AUDIO_SOURCE_NOT_SET = 0,
-  };
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RecognitionAudio* internal_default_instance() {
-    return reinterpret_cast<const RecognitionAudio*>(
-               &_RecognitionAudio_default_instance_);
+  static const RecognizeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecognizeRequest* internal_default_instance() {
+    return reinterpret_cast<const RecognizeRequest*>(
+               &_RecognizeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     5;
 
-  friend void swap(RecognitionAudio& a, RecognitionAudio& b) {
+  friend void swap(RecognizeRequest& a, RecognizeRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(RecognitionAudio* other) {
+  inline void Swap(RecognizeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecognizeRequest* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RecognitionAudio* New() const final {
-    return CreateMaybeMessage<RecognitionAudio>(nullptr);
+  RecognizeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecognizeRequest>(arena);
   }
-
-  RecognitionAudio* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RecognitionAudio>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecognizeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecognizeRequest& from) {
+    RecognizeRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RecognitionAudio& from);
-  void MergeFrom(const RecognitionAudio& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RecognitionAudio* other);
+  void InternalSwap(RecognizeRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "kaldi_serve.RecognitionAudio";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "kaldi_serve.RecognizeRequest";
   }
+  protected:
+  explicit RecognizeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kContentFieldNumber = 1,
-    kUriFieldNumber = 2,
+    kUuidFieldNumber = 3,
+    kTenantFieldNumber = 4,
+    kConfigFieldNumber = 1,
+    kAudioFieldNumber = 2,
   };
-  // bytes content = 1;
+  // string uuid = 3;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
   private:
-  bool _internal_has_content() const;
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
   public:
-  void clear_content();
-  const std::string& content() const;
-  void set_content(const std::string& value);
-  void set_content(std::string&& value);
-  void set_content(const char* value);
-  void set_content(const void* value, size_t size);
-  std::string* mutable_content();
-  std::string* release_content();
-  void set_allocated_content(std::string* content);
+
+  // string tenant = 4;
+  void clear_tenant();
+  const std::string& tenant() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tenant(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tenant();
+  PROTOBUF_NODISCARD std::string* release_tenant();
+  void set_allocated_tenant(std::string* tenant);
   private:
-  const std::string& _internal_content() const;
-  void _internal_set_content(const std::string& value);
-  std::string* _internal_mutable_content();
+  const std::string& _internal_tenant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tenant(const std::string& value);
+  std::string* _internal_mutable_tenant();
   public:
 
-  // string uri = 2;
+  // .kaldi_serve.RecognitionConfig config = 1;
+  bool has_config() const;
   private:
-  bool _internal_has_uri() const;
+  bool _internal_has_config() const;
   public:
-  void clear_uri();
-  const std::string& uri() const;
-  void set_uri(const std::string& value);
-  void set_uri(std::string&& value);
-  void set_uri(const char* value);
-  void set_uri(const char* value, size_t size);
-  std::string* mutable_uri();
-  std::string* release_uri();
-  void set_allocated_uri(std::string* uri);
+  void clear_config();
+  const ::kaldi_serve::RecognitionConfig& config() const;
+  PROTOBUF_NODISCARD ::kaldi_serve::RecognitionConfig* release_config();
+  ::kaldi_serve::RecognitionConfig* mutable_config();
+  void set_allocated_config(::kaldi_serve::RecognitionConfig* config);
   private:
-  const std::string& _internal_uri() const;
-  void _internal_set_uri(const std::string& value);
-  std::string* _internal_mutable_uri();
+  const ::kaldi_serve::RecognitionConfig& _internal_config() const;
+  ::kaldi_serve::RecognitionConfig* _internal_mutable_config();
   public:
+  void unsafe_arena_set_allocated_config(
+      ::kaldi_serve::RecognitionConfig* config);
+  ::kaldi_serve::RecognitionConfig* unsafe_arena_release_config();
 
-  void clear_audio_source();
-  AudioSourceCase audio_source_case() const;
-  // @@protoc_insertion_point(class_scope:kaldi_serve.RecognitionAudio)
+  // .kaldi_serve.RecognitionAudio audio = 2;
+  bool has_audio() const;
+  private:
+  bool _internal_has_audio() const;
+  public:
+  void clear_audio();
+  const ::kaldi_serve::RecognitionAudio& audio() const;
+  PROTOBUF_NODISCARD ::kaldi_serve::RecognitionAudio* release_audio();
+  ::kaldi_serve::RecognitionAudio* mutable_audio();
+  void set_allocated_audio(::kaldi_serve::RecognitionAudio* audio);
+  private:
+  const ::kaldi_serve::RecognitionAudio& _internal_audio() const;
+  ::kaldi_serve::RecognitionAudio* _internal_mutable_audio();
+  public:
+  void unsafe_arena_set_allocated_audio(
+      ::kaldi_serve::RecognitionAudio* audio);
+  ::kaldi_serve::RecognitionAudio* unsafe_arena_release_audio();
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.RecognizeRequest)
  private:
   class _Internal;
-  void set_has_content();
-  void set_has_uri();
-
-  inline bool has_audio_source() const;
-  inline void clear_has_audio_source();
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  union AudioSourceUnion {
-    AudioSourceUnion() {}
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
-  } audio_source_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
 
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tenant_;
+    ::kaldi_serve::RecognitionConfig* config_;
+    ::kaldi_serve::RecognitionAudio* audio_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SpeechRecognitionResult :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechRecognitionResult) */ {
+class BatchRecognizeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.BatchRecognizeRequest) */ {
  public:
-  SpeechRecognitionResult();
-  virtual ~SpeechRecognitionResult();
+  inline BatchRecognizeRequest() : BatchRecognizeRequest(nullptr) {}
+  ~BatchRecognizeRequest() override;
+  explicit PROTOBUF_CONSTEXPR BatchRecognizeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SpeechRecognitionResult(const SpeechRecognitionResult& from);
-  SpeechRecognitionResult(SpeechRecognitionResult&& from) noexcept
-    : SpeechRecognitionResult() {
+  BatchRecognizeRequest(const BatchRecognizeRequest& from);
+  BatchRecognizeRequest(BatchRecognizeRequest&& from) noexcept
+    : BatchRecognizeRequest() {
     *this = ::std::move(from);
   }
 
-  inline SpeechRecognitionResult& operator=(const SpeechRecognitionResult& from) {
+  inline BatchRecognizeRequest& operator=(const BatchRecognizeRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SpeechRecognitionResult& operator=(SpeechRecognitionResult&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline BatchRecognizeRequest& operator=(BatchRecognizeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1225,133 +1376,216 @@ class SpeechRecognitionResult :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const SpeechRecognitionResult& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const SpeechRecognitionResult* internal_default_instance() {
-    return reinterpret_cast<const SpeechRecognitionResult*>(
-               &_SpeechRecognitionResult_default_instance_);
+  static const BatchRecognizeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchRecognizeRequest* internal_default_instance() {
+    return reinterpret_cast<const BatchRecognizeRequest*>(
+               &_BatchRecognizeRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(SpeechRecognitionResult& a, SpeechRecognitionResult& b) {
+  friend void swap(BatchRecognizeRequest& a, BatchRecognizeRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(SpeechRecognitionResult* other) {
+  inline void Swap(BatchRecognizeRequest* other) {
     if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchRecognizeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SpeechRecognitionResult* New() const final {
-    return CreateMaybeMessage<SpeechRecognitionResult>(nullptr);
+  BatchRecognizeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchRecognizeRequest>(arena);
   }
-
-  SpeechRecognitionResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<SpeechRecognitionResult>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchRecognizeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchRecognizeRequest& from) {
+    BatchRecognizeRequest::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const SpeechRecognitionResult& from);
-  void MergeFrom(const SpeechRecognitionResult& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SpeechRecognitionResult* other);
+  void InternalSwap(BatchRecognizeRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "kaldi_serve.SpeechRecognitionResult";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "kaldi_serve.BatchRecognizeRequest";
   }
+  protected:
+  explicit BatchRecognizeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kAlternativesFieldNumber = 1,
+    kAudiosFieldNumber = 2,
+    kUuidFieldNumber = 3,
+    kTenantFieldNumber = 4,
+    kConfigFieldNumber = 1,
+    kMaxParallelFieldNumber = 5,
   };
-  // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
-  int alternatives_size() const;
+  // repeated .kaldi_serve.RecognitionAudio audios = 2;
+  int audios_size() const;
   private:
-  int _internal_alternatives_size() const;
+  int _internal_audios_size() const;
   public:
-  void clear_alternatives();
-  ::kaldi_serve::SpeechRecognitionAlternative* mutable_alternatives(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >*
-      mutable_alternatives();
+  void clear_audios();
+  ::kaldi_serve::RecognitionAudio* mutable_audios(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::RecognitionAudio >*
+      mutable_audios();
   private:
-  const ::kaldi_serve::SpeechRecognitionAlternative& _internal_alternatives(int index) const;
-  ::kaldi_serve::SpeechRecognitionAlternative* _internal_add_alternatives();
+  const ::kaldi_serve::RecognitionAudio& _internal_audios(int index) const;
+  ::kaldi_serve::RecognitionAudio* _internal_add_audios();
   public:
-  const ::kaldi_serve::SpeechRecognitionAlternative& alternatives(int index) const;
-  ::kaldi_serve::SpeechRecognitionAlternative* add_alternatives();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >&
-      alternatives() const;
+  const ::kaldi_serve::RecognitionAudio& audios(int index) const;
+  ::kaldi_serve::RecognitionAudio* add_audios();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::RecognitionAudio >&
+      audios() const;
 
-  // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechRecognitionResult)
+  // string uuid = 3;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // string tenant = 4;
+  void clear_tenant();
+  const std::string& tenant() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_tenant(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_tenant();
+  PROTOBUF_NODISCARD std::string* release_tenant();
+  void set_allocated_tenant(std::string* tenant);
+  private:
+  const std::string& _internal_tenant() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_tenant(const std::string& value);
+  std::string* _internal_mutable_tenant();
+  public:
+
+  // .kaldi_serve.RecognitionConfig config = 1;
+  bool has_config() const;
+  private:
+  bool _internal_has_config() const;
+  public:
+  void clear_config();
+  const ::kaldi_serve::RecognitionConfig& config() const;
+  PROTOBUF_NODISCARD ::kaldi_serve::RecognitionConfig* release_config();
+  ::kaldi_serve::RecognitionConfig* mutable_config();
+  void set_allocated_config(::kaldi_serve::RecognitionConfig* config);
+  private:
+  const ::kaldi_serve::RecognitionConfig& _internal_config() const;
+  ::kaldi_serve::RecognitionConfig* _internal_mutable_config();
+  public:
+  void unsafe_arena_set_allocated_config(
+      ::kaldi_serve::RecognitionConfig* config);
+  ::kaldi_serve::RecognitionConfig* unsafe_arena_release_config();
+
+  // int32 max_parallel = 5;
+  void clear_max_parallel();
+  int32_t max_parallel() const;
+  void set_max_parallel(int32_t value);
+  private:
+  int32_t _internal_max_parallel() const;
+  void _internal_set_max_parallel(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.BatchRecognizeRequest)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative > alternatives_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::RecognitionAudio > audios_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr tenant_;
+    ::kaldi_serve::RecognitionConfig* config_;
+    int32_t max_parallel_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SpeechRecognitionAlternative :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechRecognitionAlternative) */ {
+class BatchRecognizeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.BatchRecognizeResponse) */ {
  public:
-  SpeechRecognitionAlternative();
-  virtual ~SpeechRecognitionAlternative();
+  inline BatchRecognizeResponse() : BatchRecognizeResponse(nullptr) {}
+  ~BatchRecognizeResponse() override;
+  explicit PROTOBUF_CONSTEXPR BatchRecognizeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SpeechRecognitionAlternative(const SpeechRecognitionAlternative& from);
-  SpeechRecognitionAlternative(SpeechRecognitionAlternative&& from) noexcept
-    : SpeechRecognitionAlternative() {
+  BatchRecognizeResponse(const BatchRecognizeResponse& from);
+  BatchRecognizeResponse(BatchRecognizeResponse&& from) noexcept
+    : BatchRecognizeResponse() {
     *this = ::std::move(from);
   }
 
-  inline SpeechRecognitionAlternative& operator=(const SpeechRecognitionAlternative& from) {
+  inline BatchRecognizeResponse& operator=(const BatchRecognizeResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SpeechRecognitionAlternative& operator=(SpeechRecognitionAlternative&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline BatchRecognizeResponse& operator=(BatchRecognizeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1362,184 +1596,191 @@ class SpeechRecognitionAlternative :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const SpeechRecognitionAlternative& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const SpeechRecognitionAlternative* internal_default_instance() {
-    return reinterpret_cast<const SpeechRecognitionAlternative*>(
-               &_SpeechRecognitionAlternative_default_instance_);
+  static const BatchRecognizeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchRecognizeResponse* internal_default_instance() {
+    return reinterpret_cast<const BatchRecognizeResponse*>(
+               &_BatchRecognizeResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(SpeechRecognitionAlternative& a, SpeechRecognitionAlternative& b) {
+  friend void swap(BatchRecognizeResponse& a, BatchRecognizeResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(SpeechRecognitionAlternative* other) {
+  inline void Swap(BatchRecognizeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchRecognizeResponse* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SpeechRecognitionAlternative* New() const final {
-    return CreateMaybeMessage<SpeechRecognitionAlternative>(nullptr);
+  BatchRecognizeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchRecognizeResponse>(arena);
   }
-
-  SpeechRecognitionAlternative* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<SpeechRecognitionAlternative>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchRecognizeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchRecognizeResponse& from) {
+    BatchRecognizeResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const SpeechRecognitionAlternative& from);
-  void MergeFrom(const SpeechRecognitionAlternative& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SpeechRecognitionAlternative* other);
+  void InternalSwap(BatchRecognizeResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "kaldi_serve.SpeechRecognitionAlternative";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "kaldi_serve.BatchRecognizeResponse";
   }
+  protected:
+  explicit BatchRecognizeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kWordsFieldNumber = 5,
-    kTranscriptFieldNumber = 1,
-    kConfidenceFieldNumber = 2,
-    kAmScoreFieldNumber = 3,
-    kLmScoreFieldNumber = 4,
+    kErrorMessageFieldNumber = 4,
+    kResponseFieldNumber = 2,
+    kIndexFieldNumber = 1,
+    kErrorCodeFieldNumber = 3,
   };
-  // repeated .kaldi_serve.Word words = 5;
-  int words_size() const;
-  private:
-  int _internal_words_size() const;
-  public:
-  void clear_words();
-  ::kaldi_serve::Word* mutable_words(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >*
-      mutable_words();
+  // string error_message = 4;
+  void clear_error_message();
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
   private:
-  const ::kaldi_serve::Word& _internal_words(int index) const;
-  ::kaldi_serve::Word* _internal_add_words();
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
   public:
-  const ::kaldi_serve::Word& words(int index) const;
-  ::kaldi_serve::Word* add_words();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >&
-      words() const;
 
-  // string transcript = 1;
-  void clear_transcript();
-  const std::string& transcript() const;
-  void set_transcript(const std::string& value);
-  void set_transcript(std::string&& value);
-  void set_transcript(const char* value);
-  void set_transcript(const char* value, size_t size);
-  std::string* mutable_transcript();
-  std::string* release_transcript();
-  void set_allocated_transcript(std::string* transcript);
+  // .kaldi_serve.RecognizeResponse response = 2;
+  bool has_response() const;
   private:
-  const std::string& _internal_transcript() const;
-  void _internal_set_transcript(const std::string& value);
-  std::string* _internal_mutable_transcript();
+  bool _internal_has_response() const;
   public:
-
-  // float confidence = 2;
-  void clear_confidence();
-  float confidence() const;
-  void set_confidence(float value);
+  void clear_response();
+  const ::kaldi_serve::RecognizeResponse& response() const;
+  PROTOBUF_NODISCARD ::kaldi_serve::RecognizeResponse* release_response();
+  ::kaldi_serve::RecognizeResponse* mutable_response();
+  void set_allocated_response(::kaldi_serve::RecognizeResponse* response);
   private:
-  float _internal_confidence() const;
-  void _internal_set_confidence(float value);
+  const ::kaldi_serve::RecognizeResponse& _internal_response() const;
+  ::kaldi_serve::RecognizeResponse* _internal_mutable_response();
   public:
-
-  // float am_score = 3;
-  void clear_am_score();
-  float am_score() const;
-  void set_am_score(float value);
+  void unsafe_arena_set_allocated_response(
+      ::kaldi_serve::RecognizeResponse* response);
+  ::kaldi_serve::RecognizeResponse* unsafe_arena_release_response();
+
+  // int32 index = 1;
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
   private:
-  float _internal_am_score() const;
-  void _internal_set_am_score(float value);
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
   public:
 
-  // float lm_score = 4;
-  void clear_lm_score();
-  float lm_score() const;
-  void set_lm_score(float value);
+  // int32 error_code = 3;
+  void clear_error_code();
+  int32_t error_code() const;
+  void set_error_code(int32_t value);
   private:
-  float _internal_lm_score() const;
-  void _internal_set_lm_score(float value);
+  int32_t _internal_error_code() const;
+  void _internal_set_error_code(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechRecognitionAlternative)
+  // @@protoc_insertion_point(class_scope:kaldi_serve.BatchRecognizeResponse)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word > words_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr transcript_;
-  float confidence_;
-  float am_score_;
-  float lm_score_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    ::kaldi_serve::RecognizeResponse* response_;
+    int32_t index_;
+    int32_t error_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Word :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.Word) */ {
+class RecognizeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognizeResponse) */ {
  public:
-  Word();
-  virtual ~Word();
+  inline RecognizeResponse() : RecognizeResponse(nullptr) {}
+  ~RecognizeResponse() override;
+  explicit PROTOBUF_CONSTEXPR RecognizeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Word(const Word& from);
-  Word(Word&& from) noexcept
-    : Word() {
+  RecognizeResponse(const RecognizeResponse& from);
+  RecognizeResponse(RecognizeResponse&& from) noexcept
+    : RecognizeResponse() {
     *this = ::std::move(from);
   }
 
-  inline Word& operator=(const Word& from) {
+  inline RecognizeResponse& operator=(const RecognizeResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Word& operator=(Word&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline RecognizeResponse& operator=(RecognizeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1550,164 +1791,173 @@ class Word :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Word& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Word* internal_default_instance() {
-    return reinterpret_cast<const Word*>(
-               &_Word_default_instance_);
+  static const RecognizeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecognizeResponse* internal_default_instance() {
+    return reinterpret_cast<const RecognizeResponse*>(
+               &_RecognizeResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(Word& a, Word& b) {
+  friend void swap(RecognizeResponse& a, RecognizeResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(Word* other) {
+  inline void Swap(RecognizeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecognizeResponse* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Word* New() const final {
-    return CreateMaybeMessage<Word>(nullptr);
+  RecognizeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecognizeResponse>(arena);
   }
-
-  Word* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Word>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecognizeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecognizeResponse& from) {
+    RecognizeResponse::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Word& from);
-  void MergeFrom(const Word& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Word* other);
+  void InternalSwap(RecognizeResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "kaldi_serve.Word";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+    return "kaldi_serve.RecognizeResponse";
   }
+  protected:
+  explicit RecognizeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kWordFieldNumber = 3,
-    kStartTimeFieldNumber = 1,
-    kEndTimeFieldNumber = 2,
-    kConfidenceFieldNumber = 4,
+    kResultsFieldNumber = 1,
+    kUsageFieldNumber = 2,
   };
-  // string word = 3;
-  void clear_word();
-  const std::string& word() const;
-  void set_word(const std::string& value);
-  void set_word(std::string&& value);
-  void set_word(const char* value);
-  void set_word(const char* value, size_t size);
-  std::string* mutable_word();
-  std::string* release_word();
-  void set_allocated_word(std::string* word);
+  // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
+  int results_size() const;
   private:
-  const std::string& _internal_word() const;
-  void _internal_set_word(const std::string& value);
-  std::string* _internal_mutable_word();
+  int _internal_results_size() const;
   public:
-
-  // float start_time = 1;
-  void clear_start_time();
-  float start_time() const;
-  void set_start_time(float value);
+  void clear_results();
+  ::kaldi_serve::SpeechRecognitionResult* mutable_results(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >*
+      mutable_results();
   private:
-  float _internal_start_time() const;
-  void _internal_set_start_time(float value);
+  const ::kaldi_serve::SpeechRecognitionResult& _internal_results(int index) const;
+  ::kaldi_serve::SpeechRecognitionResult* _internal_add_results();
   public:
+  const ::kaldi_serve::SpeechRecognitionResult& results(int index) const;
+  ::kaldi_serve::SpeechRecognitionResult* add_results();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >&
+      results() const;
 
-  // float end_time = 2;
-  void clear_end_time();
-  float end_time() const;
-  void set_end_time(float value);
+  // .kaldi_serve.ResourceUsage usage = 2;
+  bool has_usage() const;
   private:
-  float _internal_end_time() const;
-  void _internal_set_end_time(float value);
+  bool _internal_has_usage() const;
   public:
-
-  // float confidence = 4;
-  void clear_confidence();
-  float confidence() const;
-  void set_confidence(float value);
+  void clear_usage();
+  const ::kaldi_serve::ResourceUsage& usage() const;
+  PROTOBUF_NODISCARD ::kaldi_serve::ResourceUsage* release_usage();
+  ::kaldi_serve::ResourceUsage* mutable_usage();
+  void set_allocated_usage(::kaldi_serve::ResourceUsage* usage);
   private:
-  float _internal_confidence() const;
-  void _internal_set_confidence(float value);
+  const ::kaldi_serve::ResourceUsage& _internal_usage() const;
+  ::kaldi_serve::ResourceUsage* _internal_mutable_usage();
   public:
+  void unsafe_arena_set_allocated_usage(
+      ::kaldi_serve::ResourceUsage* usage);
+  ::kaldi_serve::ResourceUsage* unsafe_arena_release_usage();
 
-  // @@protoc_insertion_point(class_scope:kaldi_serve.Word)
+  // @@protoc_insertion_point(class_scope:kaldi_serve.RecognizeResponse)
  private:
   class _Internal;
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr word_;
-  float start_time_;
-  float end_time_;
-  float confidence_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult > results_;
+    ::kaldi_serve::ResourceUsage* usage_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_kaldi_5fserve_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SpeechContext :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechContext) */ {
+class ResourceUsage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.ResourceUsage) */ {
  public:
-  SpeechContext();
-  virtual ~SpeechContext();
+  inline ResourceUsage() : ResourceUsage(nullptr) {}
+  ~ResourceUsage() override;
+  explicit PROTOBUF_CONSTEXPR ResourceUsage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SpeechContext(const SpeechContext& from);
-  SpeechContext(SpeechContext&& from) noexcept
-    : SpeechContext() {
+  ResourceUsage(const ResourceUsage& from);
+  ResourceUsage(ResourceUsage&& from) noexcept
+    : ResourceUsage() {
     *this = ::std::move(from);
   }
 
-  inline SpeechContext& operator=(const SpeechContext& from) {
+  inline ResourceUsage& operator=(const ResourceUsage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SpeechContext& operator=(SpeechContext&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline ResourceUsage& operator=(ResourceUsage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1718,362 +1968,2523 @@ class SpeechContext :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const SpeechContext& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const SpeechContext* internal_default_instance() {
-    return reinterpret_cast<const SpeechContext*>(
-               &_SpeechContext_default_instance_);
+  static const ResourceUsage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourceUsage* internal_default_instance() {
+    return reinterpret_cast<const ResourceUsage*>(
+               &_ResourceUsage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(SpeechContext& a, SpeechContext& b) {
+  friend void swap(ResourceUsage& a, ResourceUsage& b) {
     a.Swap(&b);
   }
-  inline void Swap(SpeechContext* other) {
+  inline void Swap(ResourceUsage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourceUsage* other) {
     if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline SpeechContext* New() const final {
-    return CreateMaybeMessage<SpeechContext>(nullptr);
+  ResourceUsage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourceUsage>(arena);
   }
-
-  SpeechContext* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<SpeechContext>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourceUsage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourceUsage& from) {
+    ResourceUsage::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const SpeechContext& from);
-  void MergeFrom(const SpeechContext& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SpeechContext* other);
+  void InternalSwap(ResourceUsage* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "kaldi_serve.SpeechContext";
+    return "kaldi_serve.ResourceUsage";
   }
+  protected:
+  explicit ResourceUsage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAudioSecsFieldNumber = 1,
+    kCpuSecsFieldNumber = 2,
+  };
+  // float audio_secs = 1;
+  void clear_audio_secs();
+  float audio_secs() const;
+  void set_audio_secs(float value);
   private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
+  float _internal_audio_secs() const;
+  void _internal_set_audio_secs(float value);
+  public:
+
+  // float cpu_secs = 2;
+  void clear_cpu_secs();
+  float cpu_secs() const;
+  void set_cpu_secs(float value);
+  private:
+  float _internal_cpu_secs() const;
+  void _internal_set_cpu_secs(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.ResourceUsage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float audio_secs_;
+    float cpu_secs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecognitionConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognitionConfig) */ {
+ public:
+  inline RecognitionConfig() : RecognitionConfig(nullptr) {}
+  ~RecognitionConfig() override;
+  explicit PROTOBUF_CONSTEXPR RecognitionConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecognitionConfig(const RecognitionConfig& from);
+  RecognitionConfig(RecognitionConfig&& from) noexcept
+    : RecognitionConfig() {
+    *this = ::std::move(from);
   }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
+
+  inline RecognitionConfig& operator=(const RecognitionConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecognitionConfig& operator=(RecognitionConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecognitionConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RecognitionConfig* internal_default_instance() {
+    return reinterpret_cast<const RecognitionConfig*>(
+               &_RecognitionConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(RecognitionConfig& a, RecognitionConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecognitionConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecognitionConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecognitionConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecognitionConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecognitionConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecognitionConfig& from) {
+    RecognitionConfig::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
   private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_kaldi_5fserve_2eproto);
-    return ::descriptor_table_kaldi_5fserve_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecognitionConfig* other);
 
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.RecognitionConfig";
+  }
+  protected:
+  explicit RecognitionConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
 
+  typedef RecognitionConfig_AudioEncoding AudioEncoding;
+  static constexpr AudioEncoding ENCODING_UNSPECIFIED =
+    RecognitionConfig_AudioEncoding_ENCODING_UNSPECIFIED;
+  static constexpr AudioEncoding LINEAR16 =
+    RecognitionConfig_AudioEncoding_LINEAR16;
+  static constexpr AudioEncoding FLAC =
+    RecognitionConfig_AudioEncoding_FLAC;
+  static inline bool AudioEncoding_IsValid(int value) {
+    return RecognitionConfig_AudioEncoding_IsValid(value);
+  }
+  static constexpr AudioEncoding AudioEncoding_MIN =
+    RecognitionConfig_AudioEncoding_AudioEncoding_MIN;
+  static constexpr AudioEncoding AudioEncoding_MAX =
+    RecognitionConfig_AudioEncoding_AudioEncoding_MAX;
+  static constexpr int AudioEncoding_ARRAYSIZE =
+    RecognitionConfig_AudioEncoding_AudioEncoding_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  AudioEncoding_descriptor() {
+    return RecognitionConfig_AudioEncoding_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& AudioEncoding_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, AudioEncoding>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function AudioEncoding_Name.");
+    return RecognitionConfig_AudioEncoding_Name(enum_t_value);
+  }
+  static inline bool AudioEncoding_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      AudioEncoding* value) {
+    return RecognitionConfig_AudioEncoding_Parse(name, value);
+  }
+
+  typedef RecognitionConfig_Priority Priority;
+  static constexpr Priority PRIORITY_UNSPECIFIED =
+    RecognitionConfig_Priority_PRIORITY_UNSPECIFIED;
+  static constexpr Priority LOW =
+    RecognitionConfig_Priority_LOW;
+  static constexpr Priority HIGH =
+    RecognitionConfig_Priority_HIGH;
+  static inline bool Priority_IsValid(int value) {
+    return RecognitionConfig_Priority_IsValid(value);
+  }
+  static constexpr Priority Priority_MIN =
+    RecognitionConfig_Priority_Priority_MIN;
+  static constexpr Priority Priority_MAX =
+    RecognitionConfig_Priority_Priority_MAX;
+  static constexpr int Priority_ARRAYSIZE =
+    RecognitionConfig_Priority_Priority_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Priority_descriptor() {
+    return RecognitionConfig_Priority_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Priority_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Priority>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Priority_Name.");
+    return RecognitionConfig_Priority_Name(enum_t_value);
+  }
+  static inline bool Priority_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Priority* value) {
+    return RecognitionConfig_Priority_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPhrasesFieldNumber = 1,
-    kTypeFieldNumber = 2,
+    kSpeechContextsFieldNumber = 6,
+    kLanguageCodeFieldNumber = 3,
+    kModelFieldNumber = 10,
+    kEncodingFieldNumber = 1,
+    kSampleRateHertzFieldNumber = 2,
+    kMaxAlternativesFieldNumber = 4,
+    kAudioChannelCountFieldNumber = 7,
+    kPunctuationFieldNumber = 5,
+    kRawFieldNumber = 11,
+    kWordLevelFieldNumber = 13,
+    kReportUsageFieldNumber = 15,
+    kDataBytesFieldNumber = 12,
+    kPriorityFieldNumber = 14,
+    kInterimResultsOnChangeFieldNumber = 16,
+    kContinuousFieldNumber = 17,
+    kParallelSegmentsFieldNumber = 18,
   };
-  // repeated string phrases = 1;
-  int phrases_size() const;
+  // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
+  int speech_contexts_size() const;
   private:
-  int _internal_phrases_size() const;
+  int _internal_speech_contexts_size() const;
   public:
-  void clear_phrases();
-  const std::string& phrases(int index) const;
-  std::string* mutable_phrases(int index);
-  void set_phrases(int index, const std::string& value);
-  void set_phrases(int index, std::string&& value);
-  void set_phrases(int index, const char* value);
-  void set_phrases(int index, const char* value, size_t size);
-  std::string* add_phrases();
-  void add_phrases(const std::string& value);
-  void add_phrases(std::string&& value);
-  void add_phrases(const char* value);
-  void add_phrases(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& phrases() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_phrases();
+  void clear_speech_contexts();
+  ::kaldi_serve::SpeechContext* mutable_speech_contexts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >*
+      mutable_speech_contexts();
   private:
-  const std::string& _internal_phrases(int index) const;
-  std::string* _internal_add_phrases();
+  const ::kaldi_serve::SpeechContext& _internal_speech_contexts(int index) const;
+  ::kaldi_serve::SpeechContext* _internal_add_speech_contexts();
   public:
+  const ::kaldi_serve::SpeechContext& speech_contexts(int index) const;
+  ::kaldi_serve::SpeechContext* add_speech_contexts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >&
+      speech_contexts() const;
 
-  // string type = 2;
-  void clear_type();
-  const std::string& type() const;
-  void set_type(const std::string& value);
-  void set_type(std::string&& value);
-  void set_type(const char* value);
-  void set_type(const char* value, size_t size);
-  std::string* mutable_type();
-  std::string* release_type();
-  void set_allocated_type(std::string* type);
+  // string language_code = 3;
+  void clear_language_code();
+  const std::string& language_code() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_language_code(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_language_code();
+  PROTOBUF_NODISCARD std::string* release_language_code();
+  void set_allocated_language_code(std::string* language_code);
   private:
-  const std::string& _internal_type() const;
-  void _internal_set_type(const std::string& value);
-  std::string* _internal_mutable_type();
+  const std::string& _internal_language_code() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_language_code(const std::string& value);
+  std::string* _internal_mutable_language_code();
   public:
 
-  // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechContext)
- private:
-  class _Internal;
+  // string model = 10;
+  void clear_model();
+  const std::string& model() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_model(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_model();
+  PROTOBUF_NODISCARD std::string* release_model();
+  void set_allocated_model(std::string* model);
+  private:
+  const std::string& _internal_model() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_model(const std::string& value);
+  std::string* _internal_mutable_model();
+  public:
 
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> phrases_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_kaldi_5fserve_2eproto;
-};
-// ===================================================================
+  // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
+  void clear_encoding();
+  ::kaldi_serve::RecognitionConfig_AudioEncoding encoding() const;
+  void set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value);
+  private:
+  ::kaldi_serve::RecognitionConfig_AudioEncoding _internal_encoding() const;
+  void _internal_set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value);
+  public:
 
+  // int32 sample_rate_hertz = 2;
+  void clear_sample_rate_hertz();
+  int32_t sample_rate_hertz() const;
+  void set_sample_rate_hertz(int32_t value);
+  private:
+  int32_t _internal_sample_rate_hertz() const;
+  void _internal_set_sample_rate_hertz(int32_t value);
+  public:
 
-// ===================================================================
+  // int32 max_alternatives = 4;
+  void clear_max_alternatives();
+  int32_t max_alternatives() const;
+  void set_max_alternatives(int32_t value);
+  private:
+  int32_t _internal_max_alternatives() const;
+  void _internal_set_max_alternatives(int32_t value);
+  public:
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// ModelList
+  // int32 audio_channel_count = 7;
+  void clear_audio_channel_count();
+  int32_t audio_channel_count() const;
+  void set_audio_channel_count(int32_t value);
+  private:
+  int32_t _internal_audio_channel_count() const;
+  void _internal_set_audio_channel_count(int32_t value);
+  public:
+
+  // bool punctuation = 5;
+  void clear_punctuation();
+  bool punctuation() const;
+  void set_punctuation(bool value);
+  private:
+  bool _internal_punctuation() const;
+  void _internal_set_punctuation(bool value);
+  public:
+
+  // bool raw = 11;
+  void clear_raw();
+  bool raw() const;
+  void set_raw(bool value);
+  private:
+  bool _internal_raw() const;
+  void _internal_set_raw(bool value);
+  public:
+
+  // bool word_level = 13;
+  void clear_word_level();
+  bool word_level() const;
+  void set_word_level(bool value);
+  private:
+  bool _internal_word_level() const;
+  void _internal_set_word_level(bool value);
+  public:
+
+  // bool report_usage = 15;
+  void clear_report_usage();
+  bool report_usage() const;
+  void set_report_usage(bool value);
+  private:
+  bool _internal_report_usage() const;
+  void _internal_set_report_usage(bool value);
+  public:
+
+  // int32 data_bytes = 12;
+  void clear_data_bytes();
+  int32_t data_bytes() const;
+  void set_data_bytes(int32_t value);
+  private:
+  int32_t _internal_data_bytes() const;
+  void _internal_set_data_bytes(int32_t value);
+  public:
+
+  // .kaldi_serve.RecognitionConfig.Priority priority = 14;
+  void clear_priority();
+  ::kaldi_serve::RecognitionConfig_Priority priority() const;
+  void set_priority(::kaldi_serve::RecognitionConfig_Priority value);
+  private:
+  ::kaldi_serve::RecognitionConfig_Priority _internal_priority() const;
+  void _internal_set_priority(::kaldi_serve::RecognitionConfig_Priority value);
+  public:
+
+  // bool interim_results_on_change = 16;
+  void clear_interim_results_on_change();
+  bool interim_results_on_change() const;
+  void set_interim_results_on_change(bool value);
+  private:
+  bool _internal_interim_results_on_change() const;
+  void _internal_set_interim_results_on_change(bool value);
+  public:
+
+  // bool continuous = 17;
+  void clear_continuous();
+  bool continuous() const;
+  void set_continuous(bool value);
+  private:
+  bool _internal_continuous() const;
+  void _internal_set_continuous(bool value);
+  public:
+
+  // int32 parallel_segments = 18;
+  void clear_parallel_segments();
+  int32_t parallel_segments() const;
+  void set_parallel_segments(int32_t value);
+  private:
+  int32_t _internal_parallel_segments() const;
+  void _internal_set_parallel_segments(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.RecognitionConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext > speech_contexts_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr language_code_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr model_;
+    int encoding_;
+    int32_t sample_rate_hertz_;
+    int32_t max_alternatives_;
+    int32_t audio_channel_count_;
+    bool punctuation_;
+    bool raw_;
+    bool word_level_;
+    bool report_usage_;
+    int32_t data_bytes_;
+    int priority_;
+    bool interim_results_on_change_;
+    bool continuous_;
+    int32_t parallel_segments_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RecognitionAudio final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.RecognitionAudio) */ {
+ public:
+  inline RecognitionAudio() : RecognitionAudio(nullptr) {}
+  ~RecognitionAudio() override;
+  explicit PROTOBUF_CONSTEXPR RecognitionAudio(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RecognitionAudio(const RecognitionAudio& from);
+  RecognitionAudio(RecognitionAudio&& from) noexcept
+    : RecognitionAudio() {
+    *this = ::std::move(from);
+  }
+
+  inline RecognitionAudio& operator=(const RecognitionAudio& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RecognitionAudio& operator=(RecognitionAudio&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RecognitionAudio& default_instance() {
+    return *internal_default_instance();
+  }
+  enum AudioSourceCase {
+    kContent = 1,
+    kUri = 2,
+    AUDIO_SOURCE_NOT_SET = 0,
+  };
+
+  static inline const RecognitionAudio* internal_default_instance() {
+    return reinterpret_cast<const RecognitionAudio*>(
+               &_RecognitionAudio_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(RecognitionAudio& a, RecognitionAudio& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RecognitionAudio* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RecognitionAudio* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RecognitionAudio* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RecognitionAudio>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RecognitionAudio& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RecognitionAudio& from) {
+    RecognitionAudio::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RecognitionAudio* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.RecognitionAudio";
+  }
+  protected:
+  explicit RecognitionAudio(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContentFieldNumber = 1,
+    kUriFieldNumber = 2,
+  };
+  // bytes content = 1;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // string uri = 2;
+  bool has_uri() const;
+  private:
+  bool _internal_has_uri() const;
+  public:
+  void clear_uri();
+  const std::string& uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uri();
+  PROTOBUF_NODISCARD std::string* release_uri();
+  void set_allocated_uri(std::string* uri);
+  private:
+  const std::string& _internal_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uri(const std::string& value);
+  std::string* _internal_mutable_uri();
+  public:
+
+  void clear_audio_source();
+  AudioSourceCase audio_source_case() const;
+  // @@protoc_insertion_point(class_scope:kaldi_serve.RecognitionAudio)
+ private:
+  class _Internal;
+  void set_has_content();
+  void set_has_uri();
+
+  inline bool has_audio_source() const;
+  inline void clear_has_audio_source();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union AudioSourceUnion {
+      constexpr AudioSourceUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
+    } audio_source_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SpeechRecognitionResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechRecognitionResult) */ {
+ public:
+  inline SpeechRecognitionResult() : SpeechRecognitionResult(nullptr) {}
+  ~SpeechRecognitionResult() override;
+  explicit PROTOBUF_CONSTEXPR SpeechRecognitionResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SpeechRecognitionResult(const SpeechRecognitionResult& from);
+  SpeechRecognitionResult(SpeechRecognitionResult&& from) noexcept
+    : SpeechRecognitionResult() {
+    *this = ::std::move(from);
+  }
+
+  inline SpeechRecognitionResult& operator=(const SpeechRecognitionResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SpeechRecognitionResult& operator=(SpeechRecognitionResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpeechRecognitionResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpeechRecognitionResult* internal_default_instance() {
+    return reinterpret_cast<const SpeechRecognitionResult*>(
+               &_SpeechRecognitionResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(SpeechRecognitionResult& a, SpeechRecognitionResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpeechRecognitionResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpeechRecognitionResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SpeechRecognitionResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpeechRecognitionResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SpeechRecognitionResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpeechRecognitionResult& from) {
+    SpeechRecognitionResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpeechRecognitionResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.SpeechRecognitionResult";
+  }
+  protected:
+  explicit SpeechRecognitionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAlternativesFieldNumber = 1,
+    kIsFinalFieldNumber = 2,
+    kStabilityFieldNumber = 3,
+  };
+  // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
+  int alternatives_size() const;
+  private:
+  int _internal_alternatives_size() const;
+  public:
+  void clear_alternatives();
+  ::kaldi_serve::SpeechRecognitionAlternative* mutable_alternatives(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >*
+      mutable_alternatives();
+  private:
+  const ::kaldi_serve::SpeechRecognitionAlternative& _internal_alternatives(int index) const;
+  ::kaldi_serve::SpeechRecognitionAlternative* _internal_add_alternatives();
+  public:
+  const ::kaldi_serve::SpeechRecognitionAlternative& alternatives(int index) const;
+  ::kaldi_serve::SpeechRecognitionAlternative* add_alternatives();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >&
+      alternatives() const;
+
+  // bool is_final = 2;
+  void clear_is_final();
+  bool is_final() const;
+  void set_is_final(bool value);
+  private:
+  bool _internal_is_final() const;
+  void _internal_set_is_final(bool value);
+  public:
+
+  // float stability = 3;
+  void clear_stability();
+  float stability() const;
+  void set_stability(float value);
+  private:
+  float _internal_stability() const;
+  void _internal_set_stability(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechRecognitionResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative > alternatives_;
+    bool is_final_;
+    float stability_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SpeechRecognitionAlternative final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechRecognitionAlternative) */ {
+ public:
+  inline SpeechRecognitionAlternative() : SpeechRecognitionAlternative(nullptr) {}
+  ~SpeechRecognitionAlternative() override;
+  explicit PROTOBUF_CONSTEXPR SpeechRecognitionAlternative(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SpeechRecognitionAlternative(const SpeechRecognitionAlternative& from);
+  SpeechRecognitionAlternative(SpeechRecognitionAlternative&& from) noexcept
+    : SpeechRecognitionAlternative() {
+    *this = ::std::move(from);
+  }
+
+  inline SpeechRecognitionAlternative& operator=(const SpeechRecognitionAlternative& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SpeechRecognitionAlternative& operator=(SpeechRecognitionAlternative&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpeechRecognitionAlternative& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpeechRecognitionAlternative* internal_default_instance() {
+    return reinterpret_cast<const SpeechRecognitionAlternative*>(
+               &_SpeechRecognitionAlternative_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(SpeechRecognitionAlternative& a, SpeechRecognitionAlternative& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpeechRecognitionAlternative* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpeechRecognitionAlternative* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SpeechRecognitionAlternative* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpeechRecognitionAlternative>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SpeechRecognitionAlternative& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpeechRecognitionAlternative& from) {
+    SpeechRecognitionAlternative::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpeechRecognitionAlternative* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.SpeechRecognitionAlternative";
+  }
+  protected:
+  explicit SpeechRecognitionAlternative(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWordsFieldNumber = 5,
+    kTranscriptFieldNumber = 1,
+    kConfidenceFieldNumber = 2,
+    kAmScoreFieldNumber = 3,
+    kLmScoreFieldNumber = 4,
+  };
+  // repeated .kaldi_serve.Word words = 5;
+  int words_size() const;
+  private:
+  int _internal_words_size() const;
+  public:
+  void clear_words();
+  ::kaldi_serve::Word* mutable_words(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >*
+      mutable_words();
+  private:
+  const ::kaldi_serve::Word& _internal_words(int index) const;
+  ::kaldi_serve::Word* _internal_add_words();
+  public:
+  const ::kaldi_serve::Word& words(int index) const;
+  ::kaldi_serve::Word* add_words();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >&
+      words() const;
+
+  // string transcript = 1;
+  void clear_transcript();
+  const std::string& transcript() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_transcript(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_transcript();
+  PROTOBUF_NODISCARD std::string* release_transcript();
+  void set_allocated_transcript(std::string* transcript);
+  private:
+  const std::string& _internal_transcript() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_transcript(const std::string& value);
+  std::string* _internal_mutable_transcript();
+  public:
+
+  // float confidence = 2;
+  void clear_confidence();
+  float confidence() const;
+  void set_confidence(float value);
+  private:
+  float _internal_confidence() const;
+  void _internal_set_confidence(float value);
+  public:
+
+  // float am_score = 3;
+  void clear_am_score();
+  float am_score() const;
+  void set_am_score(float value);
+  private:
+  float _internal_am_score() const;
+  void _internal_set_am_score(float value);
+  public:
+
+  // float lm_score = 4;
+  void clear_lm_score();
+  float lm_score() const;
+  void set_lm_score(float value);
+  private:
+  float _internal_lm_score() const;
+  void _internal_set_lm_score(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechRecognitionAlternative)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word > words_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr transcript_;
+    float confidence_;
+    float am_score_;
+    float lm_score_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Word final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.Word) */ {
+ public:
+  inline Word() : Word(nullptr) {}
+  ~Word() override;
+  explicit PROTOBUF_CONSTEXPR Word(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Word(const Word& from);
+  Word(Word&& from) noexcept
+    : Word() {
+    *this = ::std::move(from);
+  }
+
+  inline Word& operator=(const Word& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Word& operator=(Word&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Word& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Word* internal_default_instance() {
+    return reinterpret_cast<const Word*>(
+               &_Word_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(Word& a, Word& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Word* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Word* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Word* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Word>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Word& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Word& from) {
+    Word::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Word* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.Word";
+  }
+  protected:
+  explicit Word(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWordFieldNumber = 3,
+    kStartTimeFieldNumber = 1,
+    kEndTimeFieldNumber = 2,
+    kConfidenceFieldNumber = 4,
+  };
+  // string word = 3;
+  void clear_word();
+  const std::string& word() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_word(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_word();
+  PROTOBUF_NODISCARD std::string* release_word();
+  void set_allocated_word(std::string* word);
+  private:
+  const std::string& _internal_word() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_word(const std::string& value);
+  std::string* _internal_mutable_word();
+  public:
+
+  // float start_time = 1;
+  void clear_start_time();
+  float start_time() const;
+  void set_start_time(float value);
+  private:
+  float _internal_start_time() const;
+  void _internal_set_start_time(float value);
+  public:
+
+  // float end_time = 2;
+  void clear_end_time();
+  float end_time() const;
+  void set_end_time(float value);
+  private:
+  float _internal_end_time() const;
+  void _internal_set_end_time(float value);
+  public:
+
+  // float confidence = 4;
+  void clear_confidence();
+  float confidence() const;
+  void set_confidence(float value);
+  private:
+  float _internal_confidence() const;
+  void _internal_set_confidence(float value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.Word)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr word_;
+    float start_time_;
+    float end_time_;
+    float confidence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SpeechContext final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:kaldi_serve.SpeechContext) */ {
+ public:
+  inline SpeechContext() : SpeechContext(nullptr) {}
+  ~SpeechContext() override;
+  explicit PROTOBUF_CONSTEXPR SpeechContext(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SpeechContext(const SpeechContext& from);
+  SpeechContext(SpeechContext&& from) noexcept
+    : SpeechContext() {
+    *this = ::std::move(from);
+  }
+
+  inline SpeechContext& operator=(const SpeechContext& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SpeechContext& operator=(SpeechContext&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpeechContext& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpeechContext* internal_default_instance() {
+    return reinterpret_cast<const SpeechContext*>(
+               &_SpeechContext_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(SpeechContext& a, SpeechContext& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpeechContext* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpeechContext* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SpeechContext* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpeechContext>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SpeechContext& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpeechContext& from) {
+    SpeechContext::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpeechContext* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "kaldi_serve.SpeechContext";
+  }
+  protected:
+  explicit SpeechContext(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPhrasesFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // repeated string phrases = 1;
+  int phrases_size() const;
+  private:
+  int _internal_phrases_size() const;
+  public:
+  void clear_phrases();
+  const std::string& phrases(int index) const;
+  std::string* mutable_phrases(int index);
+  void set_phrases(int index, const std::string& value);
+  void set_phrases(int index, std::string&& value);
+  void set_phrases(int index, const char* value);
+  void set_phrases(int index, const char* value, size_t size);
+  std::string* add_phrases();
+  void add_phrases(const std::string& value);
+  void add_phrases(std::string&& value);
+  void add_phrases(const char* value);
+  void add_phrases(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& phrases() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_phrases();
+  private:
+  const std::string& _internal_phrases(int index) const;
+  std::string* _internal_add_phrases();
+  public:
+
+  // string type = 2;
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // @@protoc_insertion_point(class_scope:kaldi_serve.SpeechContext)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> phrases_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kaldi_5fserve_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ModelList
 
 // repeated .kaldi_serve.Model models = 1;
 inline int ModelList::_internal_models_size() const {
-  return models_.size();
+  return _impl_.models_.size();
+}
+inline int ModelList::models_size() const {
+  return _internal_models_size();
+}
+inline void ModelList::clear_models() {
+  _impl_.models_.Clear();
+}
+inline ::kaldi_serve::Model* ModelList::mutable_models(int index) {
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.ModelList.models)
+  return _impl_.models_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Model >*
+ModelList::mutable_models() {
+  // @@protoc_insertion_point(field_mutable_list:kaldi_serve.ModelList.models)
+  return &_impl_.models_;
+}
+inline const ::kaldi_serve::Model& ModelList::_internal_models(int index) const {
+  return _impl_.models_.Get(index);
+}
+inline const ::kaldi_serve::Model& ModelList::models(int index) const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelList.models)
+  return _internal_models(index);
+}
+inline ::kaldi_serve::Model* ModelList::_internal_add_models() {
+  return _impl_.models_.Add();
 }
-inline int ModelList::models_size() const {
+inline ::kaldi_serve::Model* ModelList::add_models() {
+  ::kaldi_serve::Model* _add = _internal_add_models();
+  // @@protoc_insertion_point(field_add:kaldi_serve.ModelList.models)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Model >&
+ModelList::models() const {
+  // @@protoc_insertion_point(field_list:kaldi_serve.ModelList.models)
+  return _impl_.models_;
+}
+
+// -------------------------------------------------------------------
+
+// Model
+
+// string name = 1;
+inline void Model::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Model::name() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.Model.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Model::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.Model.name)
+}
+inline std::string* Model::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.Model.name)
+  return _s;
+}
+inline const std::string& Model::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Model::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Model::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Model::release_name() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.Model.name)
+  return _impl_.name_.Release();
+}
+inline void Model::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.Model.name)
+}
+
+// string language_code = 2;
+inline void Model::clear_language_code() {
+  _impl_.language_code_.ClearToEmpty();
+}
+inline const std::string& Model::language_code() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.Model.language_code)
+  return _internal_language_code();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Model::set_language_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.language_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.Model.language_code)
+}
+inline std::string* Model::mutable_language_code() {
+  std::string* _s = _internal_mutable_language_code();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.Model.language_code)
+  return _s;
+}
+inline const std::string& Model::_internal_language_code() const {
+  return _impl_.language_code_.Get();
+}
+inline void Model::_internal_set_language_code(const std::string& value) {
+  
+  _impl_.language_code_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Model::_internal_mutable_language_code() {
+  
+  return _impl_.language_code_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Model::release_language_code() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.Model.language_code)
+  return _impl_.language_code_.Release();
+}
+inline void Model::set_allocated_language_code(std::string* language_code) {
+  if (language_code != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.language_code_.SetAllocated(language_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.language_code_.IsDefault()) {
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.Model.language_code)
+}
+
+// -------------------------------------------------------------------
+
+// ServerStats
+
+// repeated .kaldi_serve.ModelStats models = 1;
+inline int ServerStats::_internal_models_size() const {
+  return _impl_.models_.size();
+}
+inline int ServerStats::models_size() const {
   return _internal_models_size();
 }
-inline void ModelList::clear_models() {
-  models_.Clear();
+inline void ServerStats::clear_models() {
+  _impl_.models_.Clear();
+}
+inline ::kaldi_serve::ModelStats* ServerStats::mutable_models(int index) {
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.ServerStats.models)
+  return _impl_.models_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::ModelStats >*
+ServerStats::mutable_models() {
+  // @@protoc_insertion_point(field_mutable_list:kaldi_serve.ServerStats.models)
+  return &_impl_.models_;
+}
+inline const ::kaldi_serve::ModelStats& ServerStats::_internal_models(int index) const {
+  return _impl_.models_.Get(index);
+}
+inline const ::kaldi_serve::ModelStats& ServerStats::models(int index) const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ServerStats.models)
+  return _internal_models(index);
+}
+inline ::kaldi_serve::ModelStats* ServerStats::_internal_add_models() {
+  return _impl_.models_.Add();
+}
+inline ::kaldi_serve::ModelStats* ServerStats::add_models() {
+  ::kaldi_serve::ModelStats* _add = _internal_add_models();
+  // @@protoc_insertion_point(field_add:kaldi_serve.ServerStats.models)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::ModelStats >&
+ServerStats::models() const {
+  // @@protoc_insertion_point(field_list:kaldi_serve.ServerStats.models)
+  return _impl_.models_;
+}
+
+// int64 memory_rss_bytes = 2;
+inline void ServerStats::clear_memory_rss_bytes() {
+  _impl_.memory_rss_bytes_ = int64_t{0};
+}
+inline int64_t ServerStats::_internal_memory_rss_bytes() const {
+  return _impl_.memory_rss_bytes_;
+}
+inline int64_t ServerStats::memory_rss_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ServerStats.memory_rss_bytes)
+  return _internal_memory_rss_bytes();
+}
+inline void ServerStats::_internal_set_memory_rss_bytes(int64_t value) {
+  
+  _impl_.memory_rss_bytes_ = value;
+}
+inline void ServerStats::set_memory_rss_bytes(int64_t value) {
+  _internal_set_memory_rss_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ServerStats.memory_rss_bytes)
+}
+
+// -------------------------------------------------------------------
+
+// ModelStats
+
+// .kaldi_serve.Model model = 1;
+inline bool ModelStats::_internal_has_model() const {
+  return this != internal_default_instance() && _impl_.model_ != nullptr;
+}
+inline bool ModelStats::has_model() const {
+  return _internal_has_model();
+}
+inline void ModelStats::clear_model() {
+  if (GetArenaForAllocation() == nullptr && _impl_.model_ != nullptr) {
+    delete _impl_.model_;
+  }
+  _impl_.model_ = nullptr;
+}
+inline const ::kaldi_serve::Model& ModelStats::_internal_model() const {
+  const ::kaldi_serve::Model* p = _impl_.model_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::Model&>(
+      ::kaldi_serve::_Model_default_instance_);
+}
+inline const ::kaldi_serve::Model& ModelStats::model() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelStats.model)
+  return _internal_model();
+}
+inline void ModelStats::unsafe_arena_set_allocated_model(
+    ::kaldi_serve::Model* model) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.model_);
+  }
+  _impl_.model_ = model;
+  if (model) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.ModelStats.model)
+}
+inline ::kaldi_serve::Model* ModelStats::release_model() {
+  
+  ::kaldi_serve::Model* temp = _impl_.model_;
+  _impl_.model_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kaldi_serve::Model* ModelStats::unsafe_arena_release_model() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.ModelStats.model)
+  
+  ::kaldi_serve::Model* temp = _impl_.model_;
+  _impl_.model_ = nullptr;
+  return temp;
+}
+inline ::kaldi_serve::Model* ModelStats::_internal_mutable_model() {
+  
+  if (_impl_.model_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::Model>(GetArenaForAllocation());
+    _impl_.model_ = p;
+  }
+  return _impl_.model_;
+}
+inline ::kaldi_serve::Model* ModelStats::mutable_model() {
+  ::kaldi_serve::Model* _msg = _internal_mutable_model();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.ModelStats.model)
+  return _msg;
+}
+inline void ModelStats::set_allocated_model(::kaldi_serve::Model* model) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.model_;
+  }
+  if (model) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(model);
+    if (message_arena != submessage_arena) {
+      model = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, model, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.model_ = model;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.ModelStats.model)
+}
+
+// int32 decoders = 2;
+inline void ModelStats::clear_decoders() {
+  _impl_.decoders_ = 0;
+}
+inline int32_t ModelStats::_internal_decoders() const {
+  return _impl_.decoders_;
+}
+inline int32_t ModelStats::decoders() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelStats.decoders)
+  return _internal_decoders();
+}
+inline void ModelStats::_internal_set_decoders(int32_t value) {
+  
+  _impl_.decoders_ = value;
+}
+inline void ModelStats::set_decoders(int32_t value) {
+  _internal_set_decoders(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelStats.decoders)
+}
+
+// int32 idle_decoders = 3;
+inline void ModelStats::clear_idle_decoders() {
+  _impl_.idle_decoders_ = 0;
+}
+inline int32_t ModelStats::_internal_idle_decoders() const {
+  return _impl_.idle_decoders_;
+}
+inline int32_t ModelStats::idle_decoders() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelStats.idle_decoders)
+  return _internal_idle_decoders();
+}
+inline void ModelStats::_internal_set_idle_decoders(int32_t value) {
+  
+  _impl_.idle_decoders_ = value;
+}
+inline void ModelStats::set_idle_decoders(int32_t value) {
+  _internal_set_idle_decoders(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelStats.idle_decoders)
+}
+
+// int32 max_decoders = 4;
+inline void ModelStats::clear_max_decoders() {
+  _impl_.max_decoders_ = 0;
+}
+inline int32_t ModelStats::_internal_max_decoders() const {
+  return _impl_.max_decoders_;
+}
+inline int32_t ModelStats::max_decoders() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelStats.max_decoders)
+  return _internal_max_decoders();
+}
+inline void ModelStats::_internal_set_max_decoders(int32_t value) {
+  
+  _impl_.max_decoders_ = value;
+}
+inline void ModelStats::set_max_decoders(int32_t value) {
+  _internal_set_max_decoders(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelStats.max_decoders)
+}
+
+// int32 waiting_requests = 5;
+inline void ModelStats::clear_waiting_requests() {
+  _impl_.waiting_requests_ = 0;
+}
+inline int32_t ModelStats::_internal_waiting_requests() const {
+  return _impl_.waiting_requests_;
+}
+inline int32_t ModelStats::waiting_requests() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelStats.waiting_requests)
+  return _internal_waiting_requests();
+}
+inline void ModelStats::_internal_set_waiting_requests(int32_t value) {
+  
+  _impl_.waiting_requests_ = value;
+}
+inline void ModelStats::set_waiting_requests(int32_t value) {
+  _internal_set_waiting_requests(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelStats.waiting_requests)
+}
+
+// float real_time_factor = 6;
+inline void ModelStats::clear_real_time_factor() {
+  _impl_.real_time_factor_ = 0;
+}
+inline float ModelStats::_internal_real_time_factor() const {
+  return _impl_.real_time_factor_;
+}
+inline float ModelStats::real_time_factor() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelStats.real_time_factor)
+  return _internal_real_time_factor();
+}
+inline void ModelStats::_internal_set_real_time_factor(float value) {
+  
+  _impl_.real_time_factor_ = value;
+}
+inline void ModelStats::set_real_time_factor(float value) {
+  _internal_set_real_time_factor(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelStats.real_time_factor)
+}
+
+// float decoder_hold_secs = 7;
+inline void ModelStats::clear_decoder_hold_secs() {
+  _impl_.decoder_hold_secs_ = 0;
+}
+inline float ModelStats::_internal_decoder_hold_secs() const {
+  return _impl_.decoder_hold_secs_;
+}
+inline float ModelStats::decoder_hold_secs() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelStats.decoder_hold_secs)
+  return _internal_decoder_hold_secs();
+}
+inline void ModelStats::_internal_set_decoder_hold_secs(float value) {
+  
+  _impl_.decoder_hold_secs_ = value;
+}
+inline void ModelStats::set_decoder_hold_secs(float value) {
+  _internal_set_decoder_hold_secs(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelStats.decoder_hold_secs)
+}
+
+// .kaldi_serve.ModelMemory memory = 8;
+inline bool ModelStats::_internal_has_memory() const {
+  return this != internal_default_instance() && _impl_.memory_ != nullptr;
+}
+inline bool ModelStats::has_memory() const {
+  return _internal_has_memory();
+}
+inline void ModelStats::clear_memory() {
+  if (GetArenaForAllocation() == nullptr && _impl_.memory_ != nullptr) {
+    delete _impl_.memory_;
+  }
+  _impl_.memory_ = nullptr;
+}
+inline const ::kaldi_serve::ModelMemory& ModelStats::_internal_memory() const {
+  const ::kaldi_serve::ModelMemory* p = _impl_.memory_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::ModelMemory&>(
+      ::kaldi_serve::_ModelMemory_default_instance_);
+}
+inline const ::kaldi_serve::ModelMemory& ModelStats::memory() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelStats.memory)
+  return _internal_memory();
+}
+inline void ModelStats::unsafe_arena_set_allocated_memory(
+    ::kaldi_serve::ModelMemory* memory) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.memory_);
+  }
+  _impl_.memory_ = memory;
+  if (memory) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.ModelStats.memory)
+}
+inline ::kaldi_serve::ModelMemory* ModelStats::release_memory() {
+  
+  ::kaldi_serve::ModelMemory* temp = _impl_.memory_;
+  _impl_.memory_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kaldi_serve::ModelMemory* ModelStats::unsafe_arena_release_memory() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.ModelStats.memory)
+  
+  ::kaldi_serve::ModelMemory* temp = _impl_.memory_;
+  _impl_.memory_ = nullptr;
+  return temp;
+}
+inline ::kaldi_serve::ModelMemory* ModelStats::_internal_mutable_memory() {
+  
+  if (_impl_.memory_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::ModelMemory>(GetArenaForAllocation());
+    _impl_.memory_ = p;
+  }
+  return _impl_.memory_;
+}
+inline ::kaldi_serve::ModelMemory* ModelStats::mutable_memory() {
+  ::kaldi_serve::ModelMemory* _msg = _internal_mutable_memory();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.ModelStats.memory)
+  return _msg;
+}
+inline void ModelStats::set_allocated_memory(::kaldi_serve::ModelMemory* memory) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.memory_;
+  }
+  if (memory) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(memory);
+    if (message_arena != submessage_arena) {
+      memory = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, memory, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.memory_ = memory;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.ModelStats.memory)
+}
+
+// -------------------------------------------------------------------
+
+// ModelMemory
+
+// int64 hclg_bytes = 1;
+inline void ModelMemory::clear_hclg_bytes() {
+  _impl_.hclg_bytes_ = int64_t{0};
+}
+inline int64_t ModelMemory::_internal_hclg_bytes() const {
+  return _impl_.hclg_bytes_;
+}
+inline int64_t ModelMemory::hclg_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelMemory.hclg_bytes)
+  return _internal_hclg_bytes();
+}
+inline void ModelMemory::_internal_set_hclg_bytes(int64_t value) {
+  
+  _impl_.hclg_bytes_ = value;
+}
+inline void ModelMemory::set_hclg_bytes(int64_t value) {
+  _internal_set_hclg_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelMemory.hclg_bytes)
+}
+
+// int64 am_nnet_bytes = 2;
+inline void ModelMemory::clear_am_nnet_bytes() {
+  _impl_.am_nnet_bytes_ = int64_t{0};
+}
+inline int64_t ModelMemory::_internal_am_nnet_bytes() const {
+  return _impl_.am_nnet_bytes_;
+}
+inline int64_t ModelMemory::am_nnet_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelMemory.am_nnet_bytes)
+  return _internal_am_nnet_bytes();
+}
+inline void ModelMemory::_internal_set_am_nnet_bytes(int64_t value) {
+  
+  _impl_.am_nnet_bytes_ = value;
+}
+inline void ModelMemory::set_am_nnet_bytes(int64_t value) {
+  _internal_set_am_nnet_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelMemory.am_nnet_bytes)
+}
+
+// int64 ivector_extractor_bytes = 3;
+inline void ModelMemory::clear_ivector_extractor_bytes() {
+  _impl_.ivector_extractor_bytes_ = int64_t{0};
+}
+inline int64_t ModelMemory::_internal_ivector_extractor_bytes() const {
+  return _impl_.ivector_extractor_bytes_;
+}
+inline int64_t ModelMemory::ivector_extractor_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelMemory.ivector_extractor_bytes)
+  return _internal_ivector_extractor_bytes();
+}
+inline void ModelMemory::_internal_set_ivector_extractor_bytes(int64_t value) {
+  
+  _impl_.ivector_extractor_bytes_ = value;
+}
+inline void ModelMemory::set_ivector_extractor_bytes(int64_t value) {
+  _internal_set_ivector_extractor_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelMemory.ivector_extractor_bytes)
+}
+
+// int64 rnnlm_bytes = 4;
+inline void ModelMemory::clear_rnnlm_bytes() {
+  _impl_.rnnlm_bytes_ = int64_t{0};
+}
+inline int64_t ModelMemory::_internal_rnnlm_bytes() const {
+  return _impl_.rnnlm_bytes_;
+}
+inline int64_t ModelMemory::rnnlm_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelMemory.rnnlm_bytes)
+  return _internal_rnnlm_bytes();
+}
+inline void ModelMemory::_internal_set_rnnlm_bytes(int64_t value) {
+  
+  _impl_.rnnlm_bytes_ = value;
+}
+inline void ModelMemory::set_rnnlm_bytes(int64_t value) {
+  _internal_set_rnnlm_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelMemory.rnnlm_bytes)
+}
+
+// int64 word_embedding_bytes = 5;
+inline void ModelMemory::clear_word_embedding_bytes() {
+  _impl_.word_embedding_bytes_ = int64_t{0};
+}
+inline int64_t ModelMemory::_internal_word_embedding_bytes() const {
+  return _impl_.word_embedding_bytes_;
+}
+inline int64_t ModelMemory::word_embedding_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelMemory.word_embedding_bytes)
+  return _internal_word_embedding_bytes();
+}
+inline void ModelMemory::_internal_set_word_embedding_bytes(int64_t value) {
+  
+  _impl_.word_embedding_bytes_ = value;
+}
+inline void ModelMemory::set_word_embedding_bytes(int64_t value) {
+  _internal_set_word_embedding_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelMemory.word_embedding_bytes)
+}
+
+// int64 lm_fst_bytes = 6;
+inline void ModelMemory::clear_lm_fst_bytes() {
+  _impl_.lm_fst_bytes_ = int64_t{0};
+}
+inline int64_t ModelMemory::_internal_lm_fst_bytes() const {
+  return _impl_.lm_fst_bytes_;
+}
+inline int64_t ModelMemory::lm_fst_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelMemory.lm_fst_bytes)
+  return _internal_lm_fst_bytes();
+}
+inline void ModelMemory::_internal_set_lm_fst_bytes(int64_t value) {
+  
+  _impl_.lm_fst_bytes_ = value;
+}
+inline void ModelMemory::set_lm_fst_bytes(int64_t value) {
+  _internal_set_lm_fst_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelMemory.lm_fst_bytes)
+}
+
+// int64 word_syms_bytes = 7;
+inline void ModelMemory::clear_word_syms_bytes() {
+  _impl_.word_syms_bytes_ = int64_t{0};
+}
+inline int64_t ModelMemory::_internal_word_syms_bytes() const {
+  return _impl_.word_syms_bytes_;
 }
-inline ::kaldi_serve::Model* ModelList::mutable_models(int index) {
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.ModelList.models)
-  return models_.Mutable(index);
+inline int64_t ModelMemory::word_syms_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelMemory.word_syms_bytes)
+  return _internal_word_syms_bytes();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Model >*
-ModelList::mutable_models() {
-  // @@protoc_insertion_point(field_mutable_list:kaldi_serve.ModelList.models)
-  return &models_;
+inline void ModelMemory::_internal_set_word_syms_bytes(int64_t value) {
+  
+  _impl_.word_syms_bytes_ = value;
 }
-inline const ::kaldi_serve::Model& ModelList::_internal_models(int index) const {
-  return models_.Get(index);
+inline void ModelMemory::set_word_syms_bytes(int64_t value) {
+  _internal_set_word_syms_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelMemory.word_syms_bytes)
 }
-inline const ::kaldi_serve::Model& ModelList::models(int index) const {
-  // @@protoc_insertion_point(field_get:kaldi_serve.ModelList.models)
-  return _internal_models(index);
+
+// int64 total_bytes = 8;
+inline void ModelMemory::clear_total_bytes() {
+  _impl_.total_bytes_ = int64_t{0};
 }
-inline ::kaldi_serve::Model* ModelList::_internal_add_models() {
-  return models_.Add();
+inline int64_t ModelMemory::_internal_total_bytes() const {
+  return _impl_.total_bytes_;
 }
-inline ::kaldi_serve::Model* ModelList::add_models() {
-  // @@protoc_insertion_point(field_add:kaldi_serve.ModelList.models)
-  return _internal_add_models();
+inline int64_t ModelMemory::total_bytes() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ModelMemory.total_bytes)
+  return _internal_total_bytes();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Model >&
-ModelList::models() const {
-  // @@protoc_insertion_point(field_list:kaldi_serve.ModelList.models)
-  return models_;
+inline void ModelMemory::_internal_set_total_bytes(int64_t value) {
+  
+  _impl_.total_bytes_ = value;
+}
+inline void ModelMemory::set_total_bytes(int64_t value) {
+  _internal_set_total_bytes(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ModelMemory.total_bytes)
 }
 
 // -------------------------------------------------------------------
 
-// Model
+// RecognizeRequest
 
-// string name = 1;
-inline void Model::clear_name() {
-  name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// .kaldi_serve.RecognitionConfig config = 1;
+inline bool RecognizeRequest::_internal_has_config() const {
+  return this != internal_default_instance() && _impl_.config_ != nullptr;
 }
-inline const std::string& Model::name() const {
-  // @@protoc_insertion_point(field_get:kaldi_serve.Model.name)
-  return _internal_name();
+inline bool RecognizeRequest::has_config() const {
+  return _internal_has_config();
 }
-inline void Model::set_name(const std::string& value) {
-  _internal_set_name(value);
-  // @@protoc_insertion_point(field_set:kaldi_serve.Model.name)
+inline void RecognizeRequest::clear_config() {
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
+  }
+  _impl_.config_ = nullptr;
 }
-inline std::string* Model::mutable_name() {
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.Model.name)
-  return _internal_mutable_name();
+inline const ::kaldi_serve::RecognitionConfig& RecognizeRequest::_internal_config() const {
+  const ::kaldi_serve::RecognitionConfig* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::RecognitionConfig&>(
+      ::kaldi_serve::_RecognitionConfig_default_instance_);
 }
-inline const std::string& Model::_internal_name() const {
-  return name_.GetNoArena();
+inline const ::kaldi_serve::RecognitionConfig& RecognizeRequest::config() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.config)
+  return _internal_config();
 }
-inline void Model::_internal_set_name(const std::string& value) {
+inline void RecognizeRequest::unsafe_arena_set_allocated_config(
+    ::kaldi_serve::RecognitionConfig* config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
+  }
+  _impl_.config_ = config;
+  if (config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.RecognizeRequest.config)
+}
+inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::release_config() {
   
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  ::kaldi_serve::RecognitionConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Model::set_name(std::string&& value) {
+inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::unsafe_arena_release_config() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.config)
   
-  name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.Model.name)
+  ::kaldi_serve::RecognitionConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+  return temp;
 }
-inline void Model::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::_internal_mutable_config() {
   
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.Model.name)
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionConfig>(GetArenaForAllocation());
+    _impl_.config_ = p;
+  }
+  return _impl_.config_;
+}
+inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::mutable_config() {
+  ::kaldi_serve::RecognitionConfig* _msg = _internal_mutable_config();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.config)
+  return _msg;
+}
+inline void RecognizeRequest::set_allocated_config(::kaldi_serve::RecognitionConfig* config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.config_;
+  }
+  if (config) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
+    if (message_arena != submessage_arena) {
+      config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, config, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.config_ = config;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.config)
+}
+
+// .kaldi_serve.RecognitionAudio audio = 2;
+inline bool RecognizeRequest::_internal_has_audio() const {
+  return this != internal_default_instance() && _impl_.audio_ != nullptr;
+}
+inline bool RecognizeRequest::has_audio() const {
+  return _internal_has_audio();
+}
+inline void RecognizeRequest::clear_audio() {
+  if (GetArenaForAllocation() == nullptr && _impl_.audio_ != nullptr) {
+    delete _impl_.audio_;
+  }
+  _impl_.audio_ = nullptr;
+}
+inline const ::kaldi_serve::RecognitionAudio& RecognizeRequest::_internal_audio() const {
+  const ::kaldi_serve::RecognitionAudio* p = _impl_.audio_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::RecognitionAudio&>(
+      ::kaldi_serve::_RecognitionAudio_default_instance_);
+}
+inline const ::kaldi_serve::RecognitionAudio& RecognizeRequest::audio() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.audio)
+  return _internal_audio();
+}
+inline void RecognizeRequest::unsafe_arena_set_allocated_audio(
+    ::kaldi_serve::RecognitionAudio* audio) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.audio_);
+  }
+  _impl_.audio_ = audio;
+  if (audio) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.RecognizeRequest.audio)
 }
-inline void Model::set_name(const char* value, size_t size) {
+inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::release_audio() {
   
-  name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.Model.name)
+  ::kaldi_serve::RecognitionAudio* temp = _impl_.audio_;
+  _impl_.audio_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* Model::_internal_mutable_name() {
+inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::unsafe_arena_release_audio() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.audio)
   
-  return name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::kaldi_serve::RecognitionAudio* temp = _impl_.audio_;
+  _impl_.audio_ = nullptr;
+  return temp;
 }
-inline std::string* Model::release_name() {
-  // @@protoc_insertion_point(field_release:kaldi_serve.Model.name)
+inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::_internal_mutable_audio() {
   
-  return name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (_impl_.audio_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionAudio>(GetArenaForAllocation());
+    _impl_.audio_ = p;
+  }
+  return _impl_.audio_;
 }
-inline void Model::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::mutable_audio() {
+  ::kaldi_serve::RecognitionAudio* _msg = _internal_mutable_audio();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.audio)
+  return _msg;
+}
+inline void RecognizeRequest::set_allocated_audio(::kaldi_serve::RecognitionAudio* audio) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.audio_;
+  }
+  if (audio) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(audio);
+    if (message_arena != submessage_arena) {
+      audio = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, audio, submessage_arena);
+    }
     
   } else {
     
   }
-  name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name);
-  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.Model.name)
+  _impl_.audio_ = audio;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.audio)
 }
 
-// string language_code = 2;
-inline void Model::clear_language_code() {
-  language_code_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// string uuid = 3;
+inline void RecognizeRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
 }
-inline const std::string& Model::language_code() const {
-  // @@protoc_insertion_point(field_get:kaldi_serve.Model.language_code)
-  return _internal_language_code();
+inline const std::string& RecognizeRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.uuid)
+  return _internal_uuid();
 }
-inline void Model::set_language_code(const std::string& value) {
-  _internal_set_language_code(value);
-  // @@protoc_insertion_point(field_set:kaldi_serve.Model.language_code)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecognizeRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognizeRequest.uuid)
 }
-inline std::string* Model::mutable_language_code() {
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.Model.language_code)
-  return _internal_mutable_language_code();
+inline std::string* RecognizeRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.uuid)
+  return _s;
 }
-inline const std::string& Model::_internal_language_code() const {
-  return language_code_.GetNoArena();
+inline const std::string& RecognizeRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
 }
-inline void Model::_internal_set_language_code(const std::string& value) {
+inline void RecognizeRequest::_internal_set_uuid(const std::string& value) {
   
-  language_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
 }
-inline void Model::set_language_code(std::string&& value) {
+inline std::string* RecognizeRequest::_internal_mutable_uuid() {
   
-  language_code_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.Model.language_code)
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
 }
-inline void Model::set_language_code(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  language_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.Model.language_code)
+inline std::string* RecognizeRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.uuid)
+  return _impl_.uuid_.Release();
 }
-inline void Model::set_language_code(const char* value, size_t size) {
-  
-  language_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.Model.language_code)
+inline void RecognizeRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.uuid)
 }
-inline std::string* Model::_internal_mutable_language_code() {
+
+// string tenant = 4;
+inline void RecognizeRequest::clear_tenant() {
+  _impl_.tenant_.ClearToEmpty();
+}
+inline const std::string& RecognizeRequest::tenant() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.tenant)
+  return _internal_tenant();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecognizeRequest::set_tenant(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tenant_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognizeRequest.tenant)
+}
+inline std::string* RecognizeRequest::mutable_tenant() {
+  std::string* _s = _internal_mutable_tenant();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.tenant)
+  return _s;
+}
+inline const std::string& RecognizeRequest::_internal_tenant() const {
+  return _impl_.tenant_.Get();
+}
+inline void RecognizeRequest::_internal_set_tenant(const std::string& value) {
   
-  return language_code_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.tenant_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Model::release_language_code() {
-  // @@protoc_insertion_point(field_release:kaldi_serve.Model.language_code)
+inline std::string* RecognizeRequest::_internal_mutable_tenant() {
   
-  return language_code_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.tenant_.Mutable(GetArenaForAllocation());
 }
-inline void Model::set_allocated_language_code(std::string* language_code) {
-  if (language_code != nullptr) {
+inline std::string* RecognizeRequest::release_tenant() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.tenant)
+  return _impl_.tenant_.Release();
+}
+inline void RecognizeRequest::set_allocated_tenant(std::string* tenant) {
+  if (tenant != nullptr) {
     
   } else {
     
   }
-  language_code_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), language_code);
-  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.Model.language_code)
+  _impl_.tenant_.SetAllocated(tenant, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tenant_.IsDefault()) {
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.tenant)
 }
 
 // -------------------------------------------------------------------
 
-// RecognizeRequest
+// BatchRecognizeRequest
 
 // .kaldi_serve.RecognitionConfig config = 1;
-inline bool RecognizeRequest::_internal_has_config() const {
-  return this != internal_default_instance() && config_ != nullptr;
+inline bool BatchRecognizeRequest::_internal_has_config() const {
+  return this != internal_default_instance() && _impl_.config_ != nullptr;
 }
-inline bool RecognizeRequest::has_config() const {
+inline bool BatchRecognizeRequest::has_config() const {
   return _internal_has_config();
 }
-inline void RecognizeRequest::clear_config() {
-  if (GetArenaNoVirtual() == nullptr && config_ != nullptr) {
-    delete config_;
+inline void BatchRecognizeRequest::clear_config() {
+  if (GetArenaForAllocation() == nullptr && _impl_.config_ != nullptr) {
+    delete _impl_.config_;
   }
-  config_ = nullptr;
+  _impl_.config_ = nullptr;
 }
-inline const ::kaldi_serve::RecognitionConfig& RecognizeRequest::_internal_config() const {
-  const ::kaldi_serve::RecognitionConfig* p = config_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::kaldi_serve::RecognitionConfig*>(
-      &::kaldi_serve::_RecognitionConfig_default_instance_);
+inline const ::kaldi_serve::RecognitionConfig& BatchRecognizeRequest::_internal_config() const {
+  const ::kaldi_serve::RecognitionConfig* p = _impl_.config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::RecognitionConfig&>(
+      ::kaldi_serve::_RecognitionConfig_default_instance_);
 }
-inline const ::kaldi_serve::RecognitionConfig& RecognizeRequest::config() const {
-  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.config)
+inline const ::kaldi_serve::RecognitionConfig& BatchRecognizeRequest::config() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeRequest.config)
   return _internal_config();
 }
-inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::release_config() {
-  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.config)
+inline void BatchRecognizeRequest::unsafe_arena_set_allocated_config(
+    ::kaldi_serve::RecognitionConfig* config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.config_);
+  }
+  _impl_.config_ = config;
+  if (config) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.BatchRecognizeRequest.config)
+}
+inline ::kaldi_serve::RecognitionConfig* BatchRecognizeRequest::release_config() {
   
-  ::kaldi_serve::RecognitionConfig* temp = config_;
-  config_ = nullptr;
+  ::kaldi_serve::RecognitionConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::_internal_mutable_config() {
+inline ::kaldi_serve::RecognitionConfig* BatchRecognizeRequest::unsafe_arena_release_config() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.BatchRecognizeRequest.config)
+  
+  ::kaldi_serve::RecognitionConfig* temp = _impl_.config_;
+  _impl_.config_ = nullptr;
+  return temp;
+}
+inline ::kaldi_serve::RecognitionConfig* BatchRecognizeRequest::_internal_mutable_config() {
   
-  if (config_ == nullptr) {
-    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionConfig>(GetArenaNoVirtual());
-    config_ = p;
+  if (_impl_.config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionConfig>(GetArenaForAllocation());
+    _impl_.config_ = p;
   }
-  return config_;
+  return _impl_.config_;
 }
-inline ::kaldi_serve::RecognitionConfig* RecognizeRequest::mutable_config() {
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.config)
-  return _internal_mutable_config();
+inline ::kaldi_serve::RecognitionConfig* BatchRecognizeRequest::mutable_config() {
+  ::kaldi_serve::RecognitionConfig* _msg = _internal_mutable_config();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.BatchRecognizeRequest.config)
+  return _msg;
 }
-inline void RecognizeRequest::set_allocated_config(::kaldi_serve::RecognitionConfig* config) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline void BatchRecognizeRequest::set_allocated_config(::kaldi_serve::RecognitionConfig* config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete config_;
+    delete _impl_.config_;
   }
   if (config) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(config);
     if (message_arena != submessage_arena) {
       config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, config, submessage_arena);
@@ -2082,128 +4493,352 @@ inline void RecognizeRequest::set_allocated_config(::kaldi_serve::RecognitionCon
   } else {
     
   }
-  config_ = config;
-  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.config)
+  _impl_.config_ = config;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.BatchRecognizeRequest.config)
+}
+
+// repeated .kaldi_serve.RecognitionAudio audios = 2;
+inline int BatchRecognizeRequest::_internal_audios_size() const {
+  return _impl_.audios_.size();
+}
+inline int BatchRecognizeRequest::audios_size() const {
+  return _internal_audios_size();
+}
+inline void BatchRecognizeRequest::clear_audios() {
+  _impl_.audios_.Clear();
+}
+inline ::kaldi_serve::RecognitionAudio* BatchRecognizeRequest::mutable_audios(int index) {
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.BatchRecognizeRequest.audios)
+  return _impl_.audios_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::RecognitionAudio >*
+BatchRecognizeRequest::mutable_audios() {
+  // @@protoc_insertion_point(field_mutable_list:kaldi_serve.BatchRecognizeRequest.audios)
+  return &_impl_.audios_;
+}
+inline const ::kaldi_serve::RecognitionAudio& BatchRecognizeRequest::_internal_audios(int index) const {
+  return _impl_.audios_.Get(index);
+}
+inline const ::kaldi_serve::RecognitionAudio& BatchRecognizeRequest::audios(int index) const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeRequest.audios)
+  return _internal_audios(index);
+}
+inline ::kaldi_serve::RecognitionAudio* BatchRecognizeRequest::_internal_add_audios() {
+  return _impl_.audios_.Add();
+}
+inline ::kaldi_serve::RecognitionAudio* BatchRecognizeRequest::add_audios() {
+  ::kaldi_serve::RecognitionAudio* _add = _internal_add_audios();
+  // @@protoc_insertion_point(field_add:kaldi_serve.BatchRecognizeRequest.audios)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::RecognitionAudio >&
+BatchRecognizeRequest::audios() const {
+  // @@protoc_insertion_point(field_list:kaldi_serve.BatchRecognizeRequest.audios)
+  return _impl_.audios_;
+}
+
+// string uuid = 3;
+inline void BatchRecognizeRequest::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& BatchRecognizeRequest::uuid() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeRequest.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchRecognizeRequest::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.BatchRecognizeRequest.uuid)
+}
+inline std::string* BatchRecognizeRequest::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.BatchRecognizeRequest.uuid)
+  return _s;
+}
+inline const std::string& BatchRecognizeRequest::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void BatchRecognizeRequest::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchRecognizeRequest::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchRecognizeRequest::release_uuid() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.BatchRecognizeRequest.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void BatchRecognizeRequest::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.BatchRecognizeRequest.uuid)
+}
+
+// string tenant = 4;
+inline void BatchRecognizeRequest::clear_tenant() {
+  _impl_.tenant_.ClearToEmpty();
+}
+inline const std::string& BatchRecognizeRequest::tenant() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeRequest.tenant)
+  return _internal_tenant();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchRecognizeRequest::set_tenant(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.tenant_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.BatchRecognizeRequest.tenant)
+}
+inline std::string* BatchRecognizeRequest::mutable_tenant() {
+  std::string* _s = _internal_mutable_tenant();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.BatchRecognizeRequest.tenant)
+  return _s;
+}
+inline const std::string& BatchRecognizeRequest::_internal_tenant() const {
+  return _impl_.tenant_.Get();
+}
+inline void BatchRecognizeRequest::_internal_set_tenant(const std::string& value) {
+  
+  _impl_.tenant_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchRecognizeRequest::_internal_mutable_tenant() {
+  
+  return _impl_.tenant_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchRecognizeRequest::release_tenant() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.BatchRecognizeRequest.tenant)
+  return _impl_.tenant_.Release();
+}
+inline void BatchRecognizeRequest::set_allocated_tenant(std::string* tenant) {
+  if (tenant != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.tenant_.SetAllocated(tenant, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.tenant_.IsDefault()) {
+    _impl_.tenant_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.BatchRecognizeRequest.tenant)
+}
+
+// int32 max_parallel = 5;
+inline void BatchRecognizeRequest::clear_max_parallel() {
+  _impl_.max_parallel_ = 0;
+}
+inline int32_t BatchRecognizeRequest::_internal_max_parallel() const {
+  return _impl_.max_parallel_;
+}
+inline int32_t BatchRecognizeRequest::max_parallel() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeRequest.max_parallel)
+  return _internal_max_parallel();
+}
+inline void BatchRecognizeRequest::_internal_set_max_parallel(int32_t value) {
+  
+  _impl_.max_parallel_ = value;
+}
+inline void BatchRecognizeRequest::set_max_parallel(int32_t value) {
+  _internal_set_max_parallel(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.BatchRecognizeRequest.max_parallel)
+}
+
+// -------------------------------------------------------------------
+
+// BatchRecognizeResponse
+
+// int32 index = 1;
+inline void BatchRecognizeResponse::clear_index() {
+  _impl_.index_ = 0;
+}
+inline int32_t BatchRecognizeResponse::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t BatchRecognizeResponse::index() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeResponse.index)
+  return _internal_index();
+}
+inline void BatchRecognizeResponse::_internal_set_index(int32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void BatchRecognizeResponse::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.BatchRecognizeResponse.index)
 }
 
-// .kaldi_serve.RecognitionAudio audio = 2;
-inline bool RecognizeRequest::_internal_has_audio() const {
-  return this != internal_default_instance() && audio_ != nullptr;
+// .kaldi_serve.RecognizeResponse response = 2;
+inline bool BatchRecognizeResponse::_internal_has_response() const {
+  return this != internal_default_instance() && _impl_.response_ != nullptr;
 }
-inline bool RecognizeRequest::has_audio() const {
-  return _internal_has_audio();
+inline bool BatchRecognizeResponse::has_response() const {
+  return _internal_has_response();
 }
-inline void RecognizeRequest::clear_audio() {
-  if (GetArenaNoVirtual() == nullptr && audio_ != nullptr) {
-    delete audio_;
+inline void BatchRecognizeResponse::clear_response() {
+  if (GetArenaForAllocation() == nullptr && _impl_.response_ != nullptr) {
+    delete _impl_.response_;
   }
-  audio_ = nullptr;
+  _impl_.response_ = nullptr;
 }
-inline const ::kaldi_serve::RecognitionAudio& RecognizeRequest::_internal_audio() const {
-  const ::kaldi_serve::RecognitionAudio* p = audio_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::kaldi_serve::RecognitionAudio*>(
-      &::kaldi_serve::_RecognitionAudio_default_instance_);
+inline const ::kaldi_serve::RecognizeResponse& BatchRecognizeResponse::_internal_response() const {
+  const ::kaldi_serve::RecognizeResponse* p = _impl_.response_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::RecognizeResponse&>(
+      ::kaldi_serve::_RecognizeResponse_default_instance_);
 }
-inline const ::kaldi_serve::RecognitionAudio& RecognizeRequest::audio() const {
-  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.audio)
-  return _internal_audio();
+inline const ::kaldi_serve::RecognizeResponse& BatchRecognizeResponse::response() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeResponse.response)
+  return _internal_response();
 }
-inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::release_audio() {
-  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.audio)
+inline void BatchRecognizeResponse::unsafe_arena_set_allocated_response(
+    ::kaldi_serve::RecognizeResponse* response) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.response_);
+  }
+  _impl_.response_ = response;
+  if (response) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.BatchRecognizeResponse.response)
+}
+inline ::kaldi_serve::RecognizeResponse* BatchRecognizeResponse::release_response() {
   
-  ::kaldi_serve::RecognitionAudio* temp = audio_;
-  audio_ = nullptr;
+  ::kaldi_serve::RecognizeResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::_internal_mutable_audio() {
+inline ::kaldi_serve::RecognizeResponse* BatchRecognizeResponse::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.BatchRecognizeResponse.response)
+  
+  ::kaldi_serve::RecognizeResponse* temp = _impl_.response_;
+  _impl_.response_ = nullptr;
+  return temp;
+}
+inline ::kaldi_serve::RecognizeResponse* BatchRecognizeResponse::_internal_mutable_response() {
   
-  if (audio_ == nullptr) {
-    auto* p = CreateMaybeMessage<::kaldi_serve::RecognitionAudio>(GetArenaNoVirtual());
-    audio_ = p;
+  if (_impl_.response_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::RecognizeResponse>(GetArenaForAllocation());
+    _impl_.response_ = p;
   }
-  return audio_;
+  return _impl_.response_;
 }
-inline ::kaldi_serve::RecognitionAudio* RecognizeRequest::mutable_audio() {
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.audio)
-  return _internal_mutable_audio();
+inline ::kaldi_serve::RecognizeResponse* BatchRecognizeResponse::mutable_response() {
+  ::kaldi_serve::RecognizeResponse* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.BatchRecognizeResponse.response)
+  return _msg;
 }
-inline void RecognizeRequest::set_allocated_audio(::kaldi_serve::RecognitionAudio* audio) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+inline void BatchRecognizeResponse::set_allocated_response(::kaldi_serve::RecognizeResponse* response) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete audio_;
+    delete _impl_.response_;
   }
-  if (audio) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+  if (response) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
     if (message_arena != submessage_arena) {
-      audio = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, audio, submessage_arena);
+      response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, response, submessage_arena);
     }
     
   } else {
     
   }
-  audio_ = audio;
-  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.audio)
+  _impl_.response_ = response;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.BatchRecognizeResponse.response)
 }
 
-// string uuid = 3;
-inline void RecognizeRequest::clear_uuid() {
-  uuid_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// int32 error_code = 3;
+inline void BatchRecognizeResponse::clear_error_code() {
+  _impl_.error_code_ = 0;
 }
-inline const std::string& RecognizeRequest::uuid() const {
-  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeRequest.uuid)
-  return _internal_uuid();
+inline int32_t BatchRecognizeResponse::_internal_error_code() const {
+  return _impl_.error_code_;
 }
-inline void RecognizeRequest::set_uuid(const std::string& value) {
-  _internal_set_uuid(value);
-  // @@protoc_insertion_point(field_set:kaldi_serve.RecognizeRequest.uuid)
+inline int32_t BatchRecognizeResponse::error_code() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeResponse.error_code)
+  return _internal_error_code();
 }
-inline std::string* RecognizeRequest::mutable_uuid() {
-  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeRequest.uuid)
-  return _internal_mutable_uuid();
+inline void BatchRecognizeResponse::_internal_set_error_code(int32_t value) {
+  
+  _impl_.error_code_ = value;
 }
-inline const std::string& RecognizeRequest::_internal_uuid() const {
-  return uuid_.GetNoArena();
+inline void BatchRecognizeResponse::set_error_code(int32_t value) {
+  _internal_set_error_code(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.BatchRecognizeResponse.error_code)
 }
-inline void RecognizeRequest::_internal_set_uuid(const std::string& value) {
-  
-  uuid_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+
+// string error_message = 4;
+inline void BatchRecognizeResponse::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
 }
-inline void RecognizeRequest::set_uuid(std::string&& value) {
-  
-  uuid_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognizeRequest.uuid)
+inline const std::string& BatchRecognizeResponse::error_message() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.BatchRecognizeResponse.error_message)
+  return _internal_error_message();
 }
-inline void RecognizeRequest::set_uuid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  uuid_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognizeRequest.uuid)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchRecognizeResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:kaldi_serve.BatchRecognizeResponse.error_message)
 }
-inline void RecognizeRequest::set_uuid(const char* value, size_t size) {
-  
-  uuid_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognizeRequest.uuid)
+inline std::string* BatchRecognizeResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.BatchRecognizeResponse.error_message)
+  return _s;
 }
-inline std::string* RecognizeRequest::_internal_mutable_uuid() {
+inline const std::string& BatchRecognizeResponse::_internal_error_message() const {
+  return _impl_.error_message_.Get();
+}
+inline void BatchRecognizeResponse::_internal_set_error_message(const std::string& value) {
   
-  return uuid_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RecognizeRequest::release_uuid() {
-  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeRequest.uuid)
+inline std::string* BatchRecognizeResponse::_internal_mutable_error_message() {
   
-  return uuid_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline void RecognizeRequest::set_allocated_uuid(std::string* uuid) {
-  if (uuid != nullptr) {
+inline std::string* BatchRecognizeResponse::release_error_message() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.BatchRecognizeResponse.error_message)
+  return _impl_.error_message_.Release();
+}
+inline void BatchRecognizeResponse::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  uuid_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), uuid);
-  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeRequest.uuid)
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.BatchRecognizeResponse.error_message)
 }
 
 // -------------------------------------------------------------------
@@ -2212,41 +4847,176 @@ inline void RecognizeRequest::set_allocated_uuid(std::string* uuid) {
 
 // repeated .kaldi_serve.SpeechRecognitionResult results = 1;
 inline int RecognizeResponse::_internal_results_size() const {
-  return results_.size();
+  return _impl_.results_.size();
 }
 inline int RecognizeResponse::results_size() const {
   return _internal_results_size();
 }
 inline void RecognizeResponse::clear_results() {
-  results_.Clear();
+  _impl_.results_.Clear();
 }
 inline ::kaldi_serve::SpeechRecognitionResult* RecognizeResponse::mutable_results(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeResponse.results)
-  return results_.Mutable(index);
+  return _impl_.results_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >*
 RecognizeResponse::mutable_results() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.RecognizeResponse.results)
-  return &results_;
+  return &_impl_.results_;
 }
 inline const ::kaldi_serve::SpeechRecognitionResult& RecognizeResponse::_internal_results(int index) const {
-  return results_.Get(index);
+  return _impl_.results_.Get(index);
 }
 inline const ::kaldi_serve::SpeechRecognitionResult& RecognizeResponse::results(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeResponse.results)
   return _internal_results(index);
 }
 inline ::kaldi_serve::SpeechRecognitionResult* RecognizeResponse::_internal_add_results() {
-  return results_.Add();
+  return _impl_.results_.Add();
 }
 inline ::kaldi_serve::SpeechRecognitionResult* RecognizeResponse::add_results() {
+  ::kaldi_serve::SpeechRecognitionResult* _add = _internal_add_results();
   // @@protoc_insertion_point(field_add:kaldi_serve.RecognizeResponse.results)
-  return _internal_add_results();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionResult >&
 RecognizeResponse::results() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.RecognizeResponse.results)
-  return results_;
+  return _impl_.results_;
+}
+
+// .kaldi_serve.ResourceUsage usage = 2;
+inline bool RecognizeResponse::_internal_has_usage() const {
+  return this != internal_default_instance() && _impl_.usage_ != nullptr;
+}
+inline bool RecognizeResponse::has_usage() const {
+  return _internal_has_usage();
+}
+inline void RecognizeResponse::clear_usage() {
+  if (GetArenaForAllocation() == nullptr && _impl_.usage_ != nullptr) {
+    delete _impl_.usage_;
+  }
+  _impl_.usage_ = nullptr;
+}
+inline const ::kaldi_serve::ResourceUsage& RecognizeResponse::_internal_usage() const {
+  const ::kaldi_serve::ResourceUsage* p = _impl_.usage_;
+  return p != nullptr ? *p : reinterpret_cast<const ::kaldi_serve::ResourceUsage&>(
+      ::kaldi_serve::_ResourceUsage_default_instance_);
+}
+inline const ::kaldi_serve::ResourceUsage& RecognizeResponse::usage() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognizeResponse.usage)
+  return _internal_usage();
+}
+inline void RecognizeResponse::unsafe_arena_set_allocated_usage(
+    ::kaldi_serve::ResourceUsage* usage) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.usage_);
+  }
+  _impl_.usage_ = usage;
+  if (usage) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:kaldi_serve.RecognizeResponse.usage)
+}
+inline ::kaldi_serve::ResourceUsage* RecognizeResponse::release_usage() {
+  
+  ::kaldi_serve::ResourceUsage* temp = _impl_.usage_;
+  _impl_.usage_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::kaldi_serve::ResourceUsage* RecognizeResponse::unsafe_arena_release_usage() {
+  // @@protoc_insertion_point(field_release:kaldi_serve.RecognizeResponse.usage)
+  
+  ::kaldi_serve::ResourceUsage* temp = _impl_.usage_;
+  _impl_.usage_ = nullptr;
+  return temp;
+}
+inline ::kaldi_serve::ResourceUsage* RecognizeResponse::_internal_mutable_usage() {
+  
+  if (_impl_.usage_ == nullptr) {
+    auto* p = CreateMaybeMessage<::kaldi_serve::ResourceUsage>(GetArenaForAllocation());
+    _impl_.usage_ = p;
+  }
+  return _impl_.usage_;
+}
+inline ::kaldi_serve::ResourceUsage* RecognizeResponse::mutable_usage() {
+  ::kaldi_serve::ResourceUsage* _msg = _internal_mutable_usage();
+  // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognizeResponse.usage)
+  return _msg;
+}
+inline void RecognizeResponse::set_allocated_usage(::kaldi_serve::ResourceUsage* usage) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.usage_;
+  }
+  if (usage) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(usage);
+    if (message_arena != submessage_arena) {
+      usage = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, usage, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.usage_ = usage;
+  // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognizeResponse.usage)
+}
+
+// -------------------------------------------------------------------
+
+// ResourceUsage
+
+// float audio_secs = 1;
+inline void ResourceUsage::clear_audio_secs() {
+  _impl_.audio_secs_ = 0;
+}
+inline float ResourceUsage::_internal_audio_secs() const {
+  return _impl_.audio_secs_;
+}
+inline float ResourceUsage::audio_secs() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ResourceUsage.audio_secs)
+  return _internal_audio_secs();
+}
+inline void ResourceUsage::_internal_set_audio_secs(float value) {
+  
+  _impl_.audio_secs_ = value;
+}
+inline void ResourceUsage::set_audio_secs(float value) {
+  _internal_set_audio_secs(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ResourceUsage.audio_secs)
+}
+
+// float cpu_secs = 2;
+inline void ResourceUsage::clear_cpu_secs() {
+  _impl_.cpu_secs_ = 0;
+}
+inline float ResourceUsage::_internal_cpu_secs() const {
+  return _impl_.cpu_secs_;
+}
+inline float ResourceUsage::cpu_secs() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.ResourceUsage.cpu_secs)
+  return _internal_cpu_secs();
+}
+inline void ResourceUsage::_internal_set_cpu_secs(float value) {
+  
+  _impl_.cpu_secs_ = value;
+}
+inline void ResourceUsage::set_cpu_secs(float value) {
+  _internal_set_cpu_secs(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.ResourceUsage.cpu_secs)
 }
 
 // -------------------------------------------------------------------
@@ -2255,10 +5025,10 @@ RecognizeResponse::results() const {
 
 // .kaldi_serve.RecognitionConfig.AudioEncoding encoding = 1;
 inline void RecognitionConfig::clear_encoding() {
-  encoding_ = 0;
+  _impl_.encoding_ = 0;
 }
 inline ::kaldi_serve::RecognitionConfig_AudioEncoding RecognitionConfig::_internal_encoding() const {
-  return static_cast< ::kaldi_serve::RecognitionConfig_AudioEncoding >(encoding_);
+  return static_cast< ::kaldi_serve::RecognitionConfig_AudioEncoding >(_impl_.encoding_);
 }
 inline ::kaldi_serve::RecognitionConfig_AudioEncoding RecognitionConfig::encoding() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.encoding)
@@ -2266,7 +5036,7 @@ inline ::kaldi_serve::RecognitionConfig_AudioEncoding RecognitionConfig::encodin
 }
 inline void RecognitionConfig::_internal_set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value) {
   
-  encoding_ = value;
+  _impl_.encoding_ = value;
 }
 inline void RecognitionConfig::set_encoding(::kaldi_serve::RecognitionConfig_AudioEncoding value) {
   _internal_set_encoding(value);
@@ -2275,73 +5045,58 @@ inline void RecognitionConfig::set_encoding(::kaldi_serve::RecognitionConfig_Aud
 
 // int32 sample_rate_hertz = 2;
 inline void RecognitionConfig::clear_sample_rate_hertz() {
-  sample_rate_hertz_ = 0;
+  _impl_.sample_rate_hertz_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RecognitionConfig::_internal_sample_rate_hertz() const {
-  return sample_rate_hertz_;
+inline int32_t RecognitionConfig::_internal_sample_rate_hertz() const {
+  return _impl_.sample_rate_hertz_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RecognitionConfig::sample_rate_hertz() const {
+inline int32_t RecognitionConfig::sample_rate_hertz() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.sample_rate_hertz)
   return _internal_sample_rate_hertz();
 }
-inline void RecognitionConfig::_internal_set_sample_rate_hertz(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RecognitionConfig::_internal_set_sample_rate_hertz(int32_t value) {
   
-  sample_rate_hertz_ = value;
+  _impl_.sample_rate_hertz_ = value;
 }
-inline void RecognitionConfig::set_sample_rate_hertz(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RecognitionConfig::set_sample_rate_hertz(int32_t value) {
   _internal_set_sample_rate_hertz(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.sample_rate_hertz)
 }
 
 // string language_code = 3;
 inline void RecognitionConfig::clear_language_code() {
-  language_code_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.language_code_.ClearToEmpty();
 }
 inline const std::string& RecognitionConfig::language_code() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.language_code)
   return _internal_language_code();
 }
-inline void RecognitionConfig::set_language_code(const std::string& value) {
-  _internal_set_language_code(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecognitionConfig::set_language_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.language_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.language_code)
 }
 inline std::string* RecognitionConfig::mutable_language_code() {
+  std::string* _s = _internal_mutable_language_code();
   // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.language_code)
-  return _internal_mutable_language_code();
+  return _s;
 }
 inline const std::string& RecognitionConfig::_internal_language_code() const {
-  return language_code_.GetNoArena();
+  return _impl_.language_code_.Get();
 }
 inline void RecognitionConfig::_internal_set_language_code(const std::string& value) {
   
-  language_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void RecognitionConfig::set_language_code(std::string&& value) {
-  
-  language_code_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognitionConfig.language_code)
-}
-inline void RecognitionConfig::set_language_code(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  language_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognitionConfig.language_code)
-}
-inline void RecognitionConfig::set_language_code(const char* value, size_t size) {
-  
-  language_code_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognitionConfig.language_code)
+  _impl_.language_code_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RecognitionConfig::_internal_mutable_language_code() {
   
-  return language_code_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.language_code_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RecognitionConfig::release_language_code() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionConfig.language_code)
-  
-  return language_code_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.language_code_.Release();
 }
 inline void RecognitionConfig::set_allocated_language_code(std::string* language_code) {
   if (language_code != nullptr) {
@@ -2349,36 +5104,41 @@ inline void RecognitionConfig::set_allocated_language_code(std::string* language
   } else {
     
   }
-  language_code_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), language_code);
+  _impl_.language_code_.SetAllocated(language_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.language_code_.IsDefault()) {
+    _impl_.language_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionConfig.language_code)
 }
 
 // int32 max_alternatives = 4;
 inline void RecognitionConfig::clear_max_alternatives() {
-  max_alternatives_ = 0;
+  _impl_.max_alternatives_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RecognitionConfig::_internal_max_alternatives() const {
-  return max_alternatives_;
+inline int32_t RecognitionConfig::_internal_max_alternatives() const {
+  return _impl_.max_alternatives_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RecognitionConfig::max_alternatives() const {
+inline int32_t RecognitionConfig::max_alternatives() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.max_alternatives)
   return _internal_max_alternatives();
 }
-inline void RecognitionConfig::_internal_set_max_alternatives(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RecognitionConfig::_internal_set_max_alternatives(int32_t value) {
   
-  max_alternatives_ = value;
+  _impl_.max_alternatives_ = value;
 }
-inline void RecognitionConfig::set_max_alternatives(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RecognitionConfig::set_max_alternatives(int32_t value) {
   _internal_set_max_alternatives(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.max_alternatives)
 }
 
 // bool punctuation = 5;
 inline void RecognitionConfig::clear_punctuation() {
-  punctuation_ = false;
+  _impl_.punctuation_ = false;
 }
 inline bool RecognitionConfig::_internal_punctuation() const {
-  return punctuation_;
+  return _impl_.punctuation_;
 }
 inline bool RecognitionConfig::punctuation() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.punctuation)
@@ -2386,7 +5146,7 @@ inline bool RecognitionConfig::punctuation() const {
 }
 inline void RecognitionConfig::_internal_set_punctuation(bool value) {
   
-  punctuation_ = value;
+  _impl_.punctuation_ = value;
 }
 inline void RecognitionConfig::set_punctuation(bool value) {
   _internal_set_punctuation(value);
@@ -2395,112 +5155,98 @@ inline void RecognitionConfig::set_punctuation(bool value) {
 
 // repeated .kaldi_serve.SpeechContext speech_contexts = 6;
 inline int RecognitionConfig::_internal_speech_contexts_size() const {
-  return speech_contexts_.size();
+  return _impl_.speech_contexts_.size();
 }
 inline int RecognitionConfig::speech_contexts_size() const {
   return _internal_speech_contexts_size();
 }
 inline void RecognitionConfig::clear_speech_contexts() {
-  speech_contexts_.Clear();
+  _impl_.speech_contexts_.Clear();
 }
 inline ::kaldi_serve::SpeechContext* RecognitionConfig::mutable_speech_contexts(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.speech_contexts)
-  return speech_contexts_.Mutable(index);
+  return _impl_.speech_contexts_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >*
 RecognitionConfig::mutable_speech_contexts() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.RecognitionConfig.speech_contexts)
-  return &speech_contexts_;
+  return &_impl_.speech_contexts_;
 }
 inline const ::kaldi_serve::SpeechContext& RecognitionConfig::_internal_speech_contexts(int index) const {
-  return speech_contexts_.Get(index);
+  return _impl_.speech_contexts_.Get(index);
 }
 inline const ::kaldi_serve::SpeechContext& RecognitionConfig::speech_contexts(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.speech_contexts)
   return _internal_speech_contexts(index);
 }
 inline ::kaldi_serve::SpeechContext* RecognitionConfig::_internal_add_speech_contexts() {
-  return speech_contexts_.Add();
+  return _impl_.speech_contexts_.Add();
 }
 inline ::kaldi_serve::SpeechContext* RecognitionConfig::add_speech_contexts() {
+  ::kaldi_serve::SpeechContext* _add = _internal_add_speech_contexts();
   // @@protoc_insertion_point(field_add:kaldi_serve.RecognitionConfig.speech_contexts)
-  return _internal_add_speech_contexts();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechContext >&
 RecognitionConfig::speech_contexts() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.RecognitionConfig.speech_contexts)
-  return speech_contexts_;
+  return _impl_.speech_contexts_;
 }
 
 // int32 audio_channel_count = 7;
 inline void RecognitionConfig::clear_audio_channel_count() {
-  audio_channel_count_ = 0;
+  _impl_.audio_channel_count_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RecognitionConfig::_internal_audio_channel_count() const {
-  return audio_channel_count_;
+inline int32_t RecognitionConfig::_internal_audio_channel_count() const {
+  return _impl_.audio_channel_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RecognitionConfig::audio_channel_count() const {
+inline int32_t RecognitionConfig::audio_channel_count() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.audio_channel_count)
   return _internal_audio_channel_count();
 }
-inline void RecognitionConfig::_internal_set_audio_channel_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RecognitionConfig::_internal_set_audio_channel_count(int32_t value) {
   
-  audio_channel_count_ = value;
+  _impl_.audio_channel_count_ = value;
 }
-inline void RecognitionConfig::set_audio_channel_count(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RecognitionConfig::set_audio_channel_count(int32_t value) {
   _internal_set_audio_channel_count(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.audio_channel_count)
 }
 
 // string model = 10;
 inline void RecognitionConfig::clear_model() {
-  model_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.model_.ClearToEmpty();
 }
 inline const std::string& RecognitionConfig::model() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.model)
   return _internal_model();
 }
-inline void RecognitionConfig::set_model(const std::string& value) {
-  _internal_set_model(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RecognitionConfig::set_model(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.model_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.model)
 }
 inline std::string* RecognitionConfig::mutable_model() {
+  std::string* _s = _internal_mutable_model();
   // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionConfig.model)
-  return _internal_mutable_model();
+  return _s;
 }
 inline const std::string& RecognitionConfig::_internal_model() const {
-  return model_.GetNoArena();
+  return _impl_.model_.Get();
 }
 inline void RecognitionConfig::_internal_set_model(const std::string& value) {
   
-  model_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void RecognitionConfig::set_model(std::string&& value) {
-  
-  model_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognitionConfig.model)
-}
-inline void RecognitionConfig::set_model(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  model_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognitionConfig.model)
-}
-inline void RecognitionConfig::set_model(const char* value, size_t size) {
-  
-  model_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognitionConfig.model)
+  _impl_.model_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RecognitionConfig::_internal_mutable_model() {
   
-  return model_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.model_.Mutable(GetArenaForAllocation());
 }
 inline std::string* RecognitionConfig::release_model() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionConfig.model)
-  
-  return model_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.model_.Release();
 }
 inline void RecognitionConfig::set_allocated_model(std::string* model) {
   if (model != nullptr) {
@@ -2508,16 +5254,21 @@ inline void RecognitionConfig::set_allocated_model(std::string* model) {
   } else {
     
   }
-  model_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), model);
+  _impl_.model_.SetAllocated(model, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.model_.IsDefault()) {
+    _impl_.model_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionConfig.model)
 }
 
 // bool raw = 11;
 inline void RecognitionConfig::clear_raw() {
-  raw_ = false;
+  _impl_.raw_ = false;
 }
 inline bool RecognitionConfig::_internal_raw() const {
-  return raw_;
+  return _impl_.raw_;
 }
 inline bool RecognitionConfig::raw() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.raw)
@@ -2525,7 +5276,7 @@ inline bool RecognitionConfig::raw() const {
 }
 inline void RecognitionConfig::_internal_set_raw(bool value) {
   
-  raw_ = value;
+  _impl_.raw_ = value;
 }
 inline void RecognitionConfig::set_raw(bool value) {
   _internal_set_raw(value);
@@ -2534,30 +5285,30 @@ inline void RecognitionConfig::set_raw(bool value) {
 
 // int32 data_bytes = 12;
 inline void RecognitionConfig::clear_data_bytes() {
-  data_bytes_ = 0;
+  _impl_.data_bytes_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RecognitionConfig::_internal_data_bytes() const {
-  return data_bytes_;
+inline int32_t RecognitionConfig::_internal_data_bytes() const {
+  return _impl_.data_bytes_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RecognitionConfig::data_bytes() const {
+inline int32_t RecognitionConfig::data_bytes() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.data_bytes)
   return _internal_data_bytes();
 }
-inline void RecognitionConfig::_internal_set_data_bytes(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RecognitionConfig::_internal_set_data_bytes(int32_t value) {
   
-  data_bytes_ = value;
+  _impl_.data_bytes_ = value;
 }
-inline void RecognitionConfig::set_data_bytes(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RecognitionConfig::set_data_bytes(int32_t value) {
   _internal_set_data_bytes(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.data_bytes)
 }
 
 // bool word_level = 13;
 inline void RecognitionConfig::clear_word_level() {
-  word_level_ = false;
+  _impl_.word_level_ = false;
 }
 inline bool RecognitionConfig::_internal_word_level() const {
-  return word_level_;
+  return _impl_.word_level_;
 }
 inline bool RecognitionConfig::word_level() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.word_level)
@@ -2565,13 +5316,113 @@ inline bool RecognitionConfig::word_level() const {
 }
 inline void RecognitionConfig::_internal_set_word_level(bool value) {
   
-  word_level_ = value;
+  _impl_.word_level_ = value;
 }
 inline void RecognitionConfig::set_word_level(bool value) {
   _internal_set_word_level(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.word_level)
 }
 
+// .kaldi_serve.RecognitionConfig.Priority priority = 14;
+inline void RecognitionConfig::clear_priority() {
+  _impl_.priority_ = 0;
+}
+inline ::kaldi_serve::RecognitionConfig_Priority RecognitionConfig::_internal_priority() const {
+  return static_cast< ::kaldi_serve::RecognitionConfig_Priority >(_impl_.priority_);
+}
+inline ::kaldi_serve::RecognitionConfig_Priority RecognitionConfig::priority() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.priority)
+  return _internal_priority();
+}
+inline void RecognitionConfig::_internal_set_priority(::kaldi_serve::RecognitionConfig_Priority value) {
+  
+  _impl_.priority_ = value;
+}
+inline void RecognitionConfig::set_priority(::kaldi_serve::RecognitionConfig_Priority value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.priority)
+}
+
+// bool report_usage = 15;
+inline void RecognitionConfig::clear_report_usage() {
+  _impl_.report_usage_ = false;
+}
+inline bool RecognitionConfig::_internal_report_usage() const {
+  return _impl_.report_usage_;
+}
+inline bool RecognitionConfig::report_usage() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.report_usage)
+  return _internal_report_usage();
+}
+inline void RecognitionConfig::_internal_set_report_usage(bool value) {
+  
+  _impl_.report_usage_ = value;
+}
+inline void RecognitionConfig::set_report_usage(bool value) {
+  _internal_set_report_usage(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.report_usage)
+}
+
+// bool interim_results_on_change = 16;
+inline void RecognitionConfig::clear_interim_results_on_change() {
+  _impl_.interim_results_on_change_ = false;
+}
+inline bool RecognitionConfig::_internal_interim_results_on_change() const {
+  return _impl_.interim_results_on_change_;
+}
+inline bool RecognitionConfig::interim_results_on_change() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.interim_results_on_change)
+  return _internal_interim_results_on_change();
+}
+inline void RecognitionConfig::_internal_set_interim_results_on_change(bool value) {
+  
+  _impl_.interim_results_on_change_ = value;
+}
+inline void RecognitionConfig::set_interim_results_on_change(bool value) {
+  _internal_set_interim_results_on_change(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.interim_results_on_change)
+}
+
+// bool continuous = 17;
+inline void RecognitionConfig::clear_continuous() {
+  _impl_.continuous_ = false;
+}
+inline bool RecognitionConfig::_internal_continuous() const {
+  return _impl_.continuous_;
+}
+inline bool RecognitionConfig::continuous() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.continuous)
+  return _internal_continuous();
+}
+inline void RecognitionConfig::_internal_set_continuous(bool value) {
+  
+  _impl_.continuous_ = value;
+}
+inline void RecognitionConfig::set_continuous(bool value) {
+  _internal_set_continuous(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.continuous)
+}
+
+// int32 parallel_segments = 18;
+inline void RecognitionConfig::clear_parallel_segments() {
+  _impl_.parallel_segments_ = 0;
+}
+inline int32_t RecognitionConfig::_internal_parallel_segments() const {
+  return _impl_.parallel_segments_;
+}
+inline int32_t RecognitionConfig::parallel_segments() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionConfig.parallel_segments)
+  return _internal_parallel_segments();
+}
+inline void RecognitionConfig::_internal_set_parallel_segments(int32_t value) {
+  
+  _impl_.parallel_segments_ = value;
+}
+inline void RecognitionConfig::set_parallel_segments(int32_t value) {
+  _internal_set_parallel_segments(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionConfig.parallel_segments)
+}
+
 // -------------------------------------------------------------------
 
 // RecognitionAudio
@@ -2580,12 +5431,15 @@ inline void RecognitionConfig::set_word_level(bool value) {
 inline bool RecognitionAudio::_internal_has_content() const {
   return audio_source_case() == kContent;
 }
+inline bool RecognitionAudio::has_content() const {
+  return _internal_has_content();
+}
 inline void RecognitionAudio::set_has_content() {
-  _oneof_case_[0] = kContent;
+  _impl_._oneof_case_[0] = kContent;
 }
 inline void RecognitionAudio::clear_content() {
   if (_internal_has_content()) {
-    audio_source_.content_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.content_.Destroy();
     clear_has_audio_source();
   }
 }
@@ -2593,72 +5447,48 @@ inline const std::string& RecognitionAudio::content() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionAudio.content)
   return _internal_content();
 }
-inline void RecognitionAudio::set_content(const std::string& value) {
-  _internal_set_content(value);
+template <typename ArgT0, typename... ArgT>
+inline void RecognitionAudio::set_content(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_content()) {
+    clear_audio_source();
+    set_has_content();
+    _impl_.audio_source_.content_.InitDefault();
+  }
+  _impl_.audio_source_.content_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.content)
 }
 inline std::string* RecognitionAudio::mutable_content() {
+  std::string* _s = _internal_mutable_content();
   // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionAudio.content)
-  return _internal_mutable_content();
+  return _s;
 }
 inline const std::string& RecognitionAudio::_internal_content() const {
   if (_internal_has_content()) {
-    return audio_source_.content_.GetNoArena();
+    return _impl_.audio_source_.content_.Get();
   }
-  return *&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
 inline void RecognitionAudio::_internal_set_content(const std::string& value) {
   if (!_internal_has_content()) {
     clear_audio_source();
     set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  audio_source_.content_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void RecognitionAudio::set_content(std::string&& value) {
-  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.content)
-  if (!_internal_has_content()) {
-    clear_audio_source();
-    set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  audio_source_.content_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognitionAudio.content)
-}
-inline void RecognitionAudio::set_content(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  if (!_internal_has_content()) {
-    clear_audio_source();
-    set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  audio_source_.content_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognitionAudio.content)
-}
-inline void RecognitionAudio::set_content(const void* value, size_t size) {
-  if (!_internal_has_content()) {
-    clear_audio_source();
-    set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.content_.InitDefault();
   }
-  audio_source_.content_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognitionAudio.content)
+  _impl_.audio_source_.content_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RecognitionAudio::_internal_mutable_content() {
   if (!_internal_has_content()) {
     clear_audio_source();
     set_has_content();
-    audio_source_.content_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.content_.InitDefault();
   }
-  return audio_source_.content_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.audio_source_.content_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* RecognitionAudio::release_content() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionAudio.content)
   if (_internal_has_content()) {
     clear_has_audio_source();
-    return audio_source_.content_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    return _impl_.audio_source_.content_.Release();
   } else {
     return nullptr;
   }
@@ -2669,7 +5499,7 @@ inline void RecognitionAudio::set_allocated_content(std::string* content) {
   }
   if (content != nullptr) {
     set_has_content();
-    audio_source_.content_.UnsafeSetDefault(content);
+    _impl_.audio_source_.content_.InitAllocated(content, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionAudio.content)
 }
@@ -2678,12 +5508,15 @@ inline void RecognitionAudio::set_allocated_content(std::string* content) {
 inline bool RecognitionAudio::_internal_has_uri() const {
   return audio_source_case() == kUri;
 }
+inline bool RecognitionAudio::has_uri() const {
+  return _internal_has_uri();
+}
 inline void RecognitionAudio::set_has_uri() {
-  _oneof_case_[0] = kUri;
+  _impl_._oneof_case_[0] = kUri;
 }
 inline void RecognitionAudio::clear_uri() {
   if (_internal_has_uri()) {
-    audio_source_.uri_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.uri_.Destroy();
     clear_has_audio_source();
   }
 }
@@ -2691,72 +5524,48 @@ inline const std::string& RecognitionAudio::uri() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.RecognitionAudio.uri)
   return _internal_uri();
 }
-inline void RecognitionAudio::set_uri(const std::string& value) {
-  _internal_set_uri(value);
+template <typename ArgT0, typename... ArgT>
+inline void RecognitionAudio::set_uri(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_uri()) {
+    clear_audio_source();
+    set_has_uri();
+    _impl_.audio_source_.uri_.InitDefault();
+  }
+  _impl_.audio_source_.uri_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.uri)
 }
 inline std::string* RecognitionAudio::mutable_uri() {
+  std::string* _s = _internal_mutable_uri();
   // @@protoc_insertion_point(field_mutable:kaldi_serve.RecognitionAudio.uri)
-  return _internal_mutable_uri();
+  return _s;
 }
 inline const std::string& RecognitionAudio::_internal_uri() const {
   if (_internal_has_uri()) {
-    return audio_source_.uri_.GetNoArena();
+    return _impl_.audio_source_.uri_.Get();
   }
-  return *&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
 inline void RecognitionAudio::_internal_set_uri(const std::string& value) {
   if (!_internal_has_uri()) {
     clear_audio_source();
     set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  audio_source_.uri_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void RecognitionAudio::set_uri(std::string&& value) {
-  // @@protoc_insertion_point(field_set:kaldi_serve.RecognitionAudio.uri)
-  if (!_internal_has_uri()) {
-    clear_audio_source();
-    set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  audio_source_.uri_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.RecognitionAudio.uri)
-}
-inline void RecognitionAudio::set_uri(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  if (!_internal_has_uri()) {
-    clear_audio_source();
-    set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  audio_source_.uri_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.RecognitionAudio.uri)
-}
-inline void RecognitionAudio::set_uri(const char* value, size_t size) {
-  if (!_internal_has_uri()) {
-    clear_audio_source();
-    set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.uri_.InitDefault();
   }
-  audio_source_.uri_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.RecognitionAudio.uri)
+  _impl_.audio_source_.uri_.Set(value, GetArenaForAllocation());
 }
 inline std::string* RecognitionAudio::_internal_mutable_uri() {
   if (!_internal_has_uri()) {
     clear_audio_source();
     set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.audio_source_.uri_.InitDefault();
   }
-  return audio_source_.uri_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.audio_source_.uri_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* RecognitionAudio::release_uri() {
   // @@protoc_insertion_point(field_release:kaldi_serve.RecognitionAudio.uri)
   if (_internal_has_uri()) {
     clear_has_audio_source();
-    return audio_source_.uri_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    return _impl_.audio_source_.uri_.Release();
   } else {
     return nullptr;
   }
@@ -2767,7 +5576,7 @@ inline void RecognitionAudio::set_allocated_uri(std::string* uri) {
   }
   if (uri != nullptr) {
     set_has_uri();
-    audio_source_.uri_.UnsafeSetDefault(uri);
+    _impl_.audio_source_.uri_.InitAllocated(uri, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.RecognitionAudio.uri)
 }
@@ -2776,10 +5585,10 @@ inline bool RecognitionAudio::has_audio_source() const {
   return audio_source_case() != AUDIO_SOURCE_NOT_SET;
 }
 inline void RecognitionAudio::clear_has_audio_source() {
-  _oneof_case_[0] = AUDIO_SOURCE_NOT_SET;
+  _impl_._oneof_case_[0] = AUDIO_SOURCE_NOT_SET;
 }
 inline RecognitionAudio::AudioSourceCase RecognitionAudio::audio_source_case() const {
-  return RecognitionAudio::AudioSourceCase(_oneof_case_[0]);
+  return RecognitionAudio::AudioSourceCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -2787,41 +5596,82 @@ inline RecognitionAudio::AudioSourceCase RecognitionAudio::audio_source_case() c
 
 // repeated .kaldi_serve.SpeechRecognitionAlternative alternatives = 1;
 inline int SpeechRecognitionResult::_internal_alternatives_size() const {
-  return alternatives_.size();
+  return _impl_.alternatives_.size();
 }
 inline int SpeechRecognitionResult::alternatives_size() const {
   return _internal_alternatives_size();
 }
 inline void SpeechRecognitionResult::clear_alternatives() {
-  alternatives_.Clear();
+  _impl_.alternatives_.Clear();
 }
 inline ::kaldi_serve::SpeechRecognitionAlternative* SpeechRecognitionResult::mutable_alternatives(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return alternatives_.Mutable(index);
+  return _impl_.alternatives_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >*
 SpeechRecognitionResult::mutable_alternatives() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return &alternatives_;
+  return &_impl_.alternatives_;
 }
 inline const ::kaldi_serve::SpeechRecognitionAlternative& SpeechRecognitionResult::_internal_alternatives(int index) const {
-  return alternatives_.Get(index);
+  return _impl_.alternatives_.Get(index);
 }
 inline const ::kaldi_serve::SpeechRecognitionAlternative& SpeechRecognitionResult::alternatives(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionResult.alternatives)
   return _internal_alternatives(index);
 }
 inline ::kaldi_serve::SpeechRecognitionAlternative* SpeechRecognitionResult::_internal_add_alternatives() {
-  return alternatives_.Add();
+  return _impl_.alternatives_.Add();
 }
 inline ::kaldi_serve::SpeechRecognitionAlternative* SpeechRecognitionResult::add_alternatives() {
+  ::kaldi_serve::SpeechRecognitionAlternative* _add = _internal_add_alternatives();
   // @@protoc_insertion_point(field_add:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return _internal_add_alternatives();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::SpeechRecognitionAlternative >&
 SpeechRecognitionResult::alternatives() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.SpeechRecognitionResult.alternatives)
-  return alternatives_;
+  return _impl_.alternatives_;
+}
+
+// bool is_final = 2;
+inline void SpeechRecognitionResult::clear_is_final() {
+  _impl_.is_final_ = false;
+}
+inline bool SpeechRecognitionResult::_internal_is_final() const {
+  return _impl_.is_final_;
+}
+inline bool SpeechRecognitionResult::is_final() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionResult.is_final)
+  return _internal_is_final();
+}
+inline void SpeechRecognitionResult::_internal_set_is_final(bool value) {
+  
+  _impl_.is_final_ = value;
+}
+inline void SpeechRecognitionResult::set_is_final(bool value) {
+  _internal_set_is_final(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.SpeechRecognitionResult.is_final)
+}
+
+// float stability = 3;
+inline void SpeechRecognitionResult::clear_stability() {
+  _impl_.stability_ = 0;
+}
+inline float SpeechRecognitionResult::_internal_stability() const {
+  return _impl_.stability_;
+}
+inline float SpeechRecognitionResult::stability() const {
+  // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionResult.stability)
+  return _internal_stability();
+}
+inline void SpeechRecognitionResult::_internal_set_stability(float value) {
+  
+  _impl_.stability_ = value;
+}
+inline void SpeechRecognitionResult::set_stability(float value) {
+  _internal_set_stability(value);
+  // @@protoc_insertion_point(field_set:kaldi_serve.SpeechRecognitionResult.stability)
 }
 
 // -------------------------------------------------------------------
@@ -2830,53 +5680,38 @@ SpeechRecognitionResult::alternatives() const {
 
 // string transcript = 1;
 inline void SpeechRecognitionAlternative::clear_transcript() {
-  transcript_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.transcript_.ClearToEmpty();
 }
 inline const std::string& SpeechRecognitionAlternative::transcript() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.transcript)
   return _internal_transcript();
 }
-inline void SpeechRecognitionAlternative::set_transcript(const std::string& value) {
-  _internal_set_transcript(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpeechRecognitionAlternative::set_transcript(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.transcript_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechRecognitionAlternative.transcript)
 }
 inline std::string* SpeechRecognitionAlternative::mutable_transcript() {
+  std::string* _s = _internal_mutable_transcript();
   // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechRecognitionAlternative.transcript)
-  return _internal_mutable_transcript();
+  return _s;
 }
 inline const std::string& SpeechRecognitionAlternative::_internal_transcript() const {
-  return transcript_.GetNoArena();
+  return _impl_.transcript_.Get();
 }
 inline void SpeechRecognitionAlternative::_internal_set_transcript(const std::string& value) {
   
-  transcript_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void SpeechRecognitionAlternative::set_transcript(std::string&& value) {
-  
-  transcript_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.SpeechRecognitionAlternative.transcript)
-}
-inline void SpeechRecognitionAlternative::set_transcript(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  transcript_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.SpeechRecognitionAlternative.transcript)
-}
-inline void SpeechRecognitionAlternative::set_transcript(const char* value, size_t size) {
-  
-  transcript_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.SpeechRecognitionAlternative.transcript)
+  _impl_.transcript_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SpeechRecognitionAlternative::_internal_mutable_transcript() {
   
-  return transcript_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.transcript_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SpeechRecognitionAlternative::release_transcript() {
   // @@protoc_insertion_point(field_release:kaldi_serve.SpeechRecognitionAlternative.transcript)
-  
-  return transcript_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.transcript_.Release();
 }
 inline void SpeechRecognitionAlternative::set_allocated_transcript(std::string* transcript) {
   if (transcript != nullptr) {
@@ -2884,16 +5719,21 @@ inline void SpeechRecognitionAlternative::set_allocated_transcript(std::string*
   } else {
     
   }
-  transcript_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), transcript);
+  _impl_.transcript_.SetAllocated(transcript, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.transcript_.IsDefault()) {
+    _impl_.transcript_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.SpeechRecognitionAlternative.transcript)
 }
 
 // float confidence = 2;
 inline void SpeechRecognitionAlternative::clear_confidence() {
-  confidence_ = 0;
+  _impl_.confidence_ = 0;
 }
 inline float SpeechRecognitionAlternative::_internal_confidence() const {
-  return confidence_;
+  return _impl_.confidence_;
 }
 inline float SpeechRecognitionAlternative::confidence() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.confidence)
@@ -2901,7 +5741,7 @@ inline float SpeechRecognitionAlternative::confidence() const {
 }
 inline void SpeechRecognitionAlternative::_internal_set_confidence(float value) {
   
-  confidence_ = value;
+  _impl_.confidence_ = value;
 }
 inline void SpeechRecognitionAlternative::set_confidence(float value) {
   _internal_set_confidence(value);
@@ -2910,10 +5750,10 @@ inline void SpeechRecognitionAlternative::set_confidence(float value) {
 
 // float am_score = 3;
 inline void SpeechRecognitionAlternative::clear_am_score() {
-  am_score_ = 0;
+  _impl_.am_score_ = 0;
 }
 inline float SpeechRecognitionAlternative::_internal_am_score() const {
-  return am_score_;
+  return _impl_.am_score_;
 }
 inline float SpeechRecognitionAlternative::am_score() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.am_score)
@@ -2921,7 +5761,7 @@ inline float SpeechRecognitionAlternative::am_score() const {
 }
 inline void SpeechRecognitionAlternative::_internal_set_am_score(float value) {
   
-  am_score_ = value;
+  _impl_.am_score_ = value;
 }
 inline void SpeechRecognitionAlternative::set_am_score(float value) {
   _internal_set_am_score(value);
@@ -2930,10 +5770,10 @@ inline void SpeechRecognitionAlternative::set_am_score(float value) {
 
 // float lm_score = 4;
 inline void SpeechRecognitionAlternative::clear_lm_score() {
-  lm_score_ = 0;
+  _impl_.lm_score_ = 0;
 }
 inline float SpeechRecognitionAlternative::_internal_lm_score() const {
-  return lm_score_;
+  return _impl_.lm_score_;
 }
 inline float SpeechRecognitionAlternative::lm_score() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.lm_score)
@@ -2941,7 +5781,7 @@ inline float SpeechRecognitionAlternative::lm_score() const {
 }
 inline void SpeechRecognitionAlternative::_internal_set_lm_score(float value) {
   
-  lm_score_ = value;
+  _impl_.lm_score_ = value;
 }
 inline void SpeechRecognitionAlternative::set_lm_score(float value) {
   _internal_set_lm_score(value);
@@ -2950,41 +5790,42 @@ inline void SpeechRecognitionAlternative::set_lm_score(float value) {
 
 // repeated .kaldi_serve.Word words = 5;
 inline int SpeechRecognitionAlternative::_internal_words_size() const {
-  return words_.size();
+  return _impl_.words_.size();
 }
 inline int SpeechRecognitionAlternative::words_size() const {
   return _internal_words_size();
 }
 inline void SpeechRecognitionAlternative::clear_words() {
-  words_.Clear();
+  _impl_.words_.Clear();
 }
 inline ::kaldi_serve::Word* SpeechRecognitionAlternative::mutable_words(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechRecognitionAlternative.words)
-  return words_.Mutable(index);
+  return _impl_.words_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >*
 SpeechRecognitionAlternative::mutable_words() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.SpeechRecognitionAlternative.words)
-  return &words_;
+  return &_impl_.words_;
 }
 inline const ::kaldi_serve::Word& SpeechRecognitionAlternative::_internal_words(int index) const {
-  return words_.Get(index);
+  return _impl_.words_.Get(index);
 }
 inline const ::kaldi_serve::Word& SpeechRecognitionAlternative::words(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechRecognitionAlternative.words)
   return _internal_words(index);
 }
 inline ::kaldi_serve::Word* SpeechRecognitionAlternative::_internal_add_words() {
-  return words_.Add();
+  return _impl_.words_.Add();
 }
 inline ::kaldi_serve::Word* SpeechRecognitionAlternative::add_words() {
+  ::kaldi_serve::Word* _add = _internal_add_words();
   // @@protoc_insertion_point(field_add:kaldi_serve.SpeechRecognitionAlternative.words)
-  return _internal_add_words();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::kaldi_serve::Word >&
 SpeechRecognitionAlternative::words() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.SpeechRecognitionAlternative.words)
-  return words_;
+  return _impl_.words_;
 }
 
 // -------------------------------------------------------------------
@@ -2993,10 +5834,10 @@ SpeechRecognitionAlternative::words() const {
 
 // float start_time = 1;
 inline void Word::clear_start_time() {
-  start_time_ = 0;
+  _impl_.start_time_ = 0;
 }
 inline float Word::_internal_start_time() const {
-  return start_time_;
+  return _impl_.start_time_;
 }
 inline float Word::start_time() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.Word.start_time)
@@ -3004,7 +5845,7 @@ inline float Word::start_time() const {
 }
 inline void Word::_internal_set_start_time(float value) {
   
-  start_time_ = value;
+  _impl_.start_time_ = value;
 }
 inline void Word::set_start_time(float value) {
   _internal_set_start_time(value);
@@ -3013,10 +5854,10 @@ inline void Word::set_start_time(float value) {
 
 // float end_time = 2;
 inline void Word::clear_end_time() {
-  end_time_ = 0;
+  _impl_.end_time_ = 0;
 }
 inline float Word::_internal_end_time() const {
-  return end_time_;
+  return _impl_.end_time_;
 }
 inline float Word::end_time() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.Word.end_time)
@@ -3024,7 +5865,7 @@ inline float Word::end_time() const {
 }
 inline void Word::_internal_set_end_time(float value) {
   
-  end_time_ = value;
+  _impl_.end_time_ = value;
 }
 inline void Word::set_end_time(float value) {
   _internal_set_end_time(value);
@@ -3033,53 +5874,38 @@ inline void Word::set_end_time(float value) {
 
 // string word = 3;
 inline void Word::clear_word() {
-  word_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.word_.ClearToEmpty();
 }
 inline const std::string& Word::word() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.Word.word)
   return _internal_word();
 }
-inline void Word::set_word(const std::string& value) {
-  _internal_set_word(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Word::set_word(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.word_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.Word.word)
 }
 inline std::string* Word::mutable_word() {
+  std::string* _s = _internal_mutable_word();
   // @@protoc_insertion_point(field_mutable:kaldi_serve.Word.word)
-  return _internal_mutable_word();
+  return _s;
 }
 inline const std::string& Word::_internal_word() const {
-  return word_.GetNoArena();
+  return _impl_.word_.Get();
 }
 inline void Word::_internal_set_word(const std::string& value) {
   
-  word_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Word::set_word(std::string&& value) {
-  
-  word_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.Word.word)
-}
-inline void Word::set_word(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  word_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.Word.word)
-}
-inline void Word::set_word(const char* value, size_t size) {
-  
-  word_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.Word.word)
+  _impl_.word_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Word::_internal_mutable_word() {
   
-  return word_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.word_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Word::release_word() {
   // @@protoc_insertion_point(field_release:kaldi_serve.Word.word)
-  
-  return word_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.word_.Release();
 }
 inline void Word::set_allocated_word(std::string* word) {
   if (word != nullptr) {
@@ -3087,16 +5913,21 @@ inline void Word::set_allocated_word(std::string* word) {
   } else {
     
   }
-  word_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), word);
+  _impl_.word_.SetAllocated(word, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.word_.IsDefault()) {
+    _impl_.word_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.Word.word)
 }
 
 // float confidence = 4;
 inline void Word::clear_confidence() {
-  confidence_ = 0;
+  _impl_.confidence_ = 0;
 }
 inline float Word::_internal_confidence() const {
-  return confidence_;
+  return _impl_.confidence_;
 }
 inline float Word::confidence() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.Word.confidence)
@@ -3104,7 +5935,7 @@ inline float Word::confidence() const {
 }
 inline void Word::_internal_set_confidence(float value) {
   
-  confidence_ = value;
+  _impl_.confidence_ = value;
 }
 inline void Word::set_confidence(float value) {
   _internal_set_confidence(value);
@@ -3117,20 +5948,21 @@ inline void Word::set_confidence(float value) {
 
 // repeated string phrases = 1;
 inline int SpeechContext::_internal_phrases_size() const {
-  return phrases_.size();
+  return _impl_.phrases_.size();
 }
 inline int SpeechContext::phrases_size() const {
   return _internal_phrases_size();
 }
 inline void SpeechContext::clear_phrases() {
-  phrases_.Clear();
+  _impl_.phrases_.Clear();
 }
 inline std::string* SpeechContext::add_phrases() {
+  std::string* _s = _internal_add_phrases();
   // @@protoc_insertion_point(field_add_mutable:kaldi_serve.SpeechContext.phrases)
-  return _internal_add_phrases();
+  return _s;
 }
 inline const std::string& SpeechContext::_internal_phrases(int index) const {
-  return phrases_.Get(index);
+  return _impl_.phrases_.Get(index);
 }
 inline const std::string& SpeechContext::phrases(int index) const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechContext.phrases)
@@ -3138,106 +5970,91 @@ inline const std::string& SpeechContext::phrases(int index) const {
 }
 inline std::string* SpeechContext::mutable_phrases(int index) {
   // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechContext.phrases)
-  return phrases_.Mutable(index);
+  return _impl_.phrases_.Mutable(index);
 }
 inline void SpeechContext::set_phrases(int index, const std::string& value) {
+  _impl_.phrases_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechContext.phrases)
-  phrases_.Mutable(index)->assign(value);
 }
 inline void SpeechContext::set_phrases(int index, std::string&& value) {
+  _impl_.phrases_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechContext.phrases)
-  phrases_.Mutable(index)->assign(std::move(value));
 }
 inline void SpeechContext::set_phrases(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  phrases_.Mutable(index)->assign(value);
+  _impl_.phrases_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:kaldi_serve.SpeechContext.phrases)
 }
 inline void SpeechContext::set_phrases(int index, const char* value, size_t size) {
-  phrases_.Mutable(index)->assign(
+  _impl_.phrases_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:kaldi_serve.SpeechContext.phrases)
 }
 inline std::string* SpeechContext::_internal_add_phrases() {
-  return phrases_.Add();
+  return _impl_.phrases_.Add();
 }
 inline void SpeechContext::add_phrases(const std::string& value) {
-  phrases_.Add()->assign(value);
+  _impl_.phrases_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:kaldi_serve.SpeechContext.phrases)
 }
 inline void SpeechContext::add_phrases(std::string&& value) {
-  phrases_.Add(std::move(value));
+  _impl_.phrases_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:kaldi_serve.SpeechContext.phrases)
 }
 inline void SpeechContext::add_phrases(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  phrases_.Add()->assign(value);
+  _impl_.phrases_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:kaldi_serve.SpeechContext.phrases)
 }
 inline void SpeechContext::add_phrases(const char* value, size_t size) {
-  phrases_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.phrases_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:kaldi_serve.SpeechContext.phrases)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 SpeechContext::phrases() const {
   // @@protoc_insertion_point(field_list:kaldi_serve.SpeechContext.phrases)
-  return phrases_;
+  return _impl_.phrases_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 SpeechContext::mutable_phrases() {
   // @@protoc_insertion_point(field_mutable_list:kaldi_serve.SpeechContext.phrases)
-  return &phrases_;
+  return &_impl_.phrases_;
 }
 
 // string type = 2;
 inline void SpeechContext::clear_type() {
-  type_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.type_.ClearToEmpty();
 }
 inline const std::string& SpeechContext::type() const {
   // @@protoc_insertion_point(field_get:kaldi_serve.SpeechContext.type)
   return _internal_type();
 }
-inline void SpeechContext::set_type(const std::string& value) {
-  _internal_set_type(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpeechContext::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:kaldi_serve.SpeechContext.type)
 }
 inline std::string* SpeechContext::mutable_type() {
+  std::string* _s = _internal_mutable_type();
   // @@protoc_insertion_point(field_mutable:kaldi_serve.SpeechContext.type)
-  return _internal_mutable_type();
+  return _s;
 }
 inline const std::string& SpeechContext::_internal_type() const {
-  return type_.GetNoArena();
+  return _impl_.type_.Get();
 }
 inline void SpeechContext::_internal_set_type(const std::string& value) {
   
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void SpeechContext::set_type(std::string&& value) {
-  
-  type_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:kaldi_serve.SpeechContext.type)
-}
-inline void SpeechContext::set_type(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:kaldi_serve.SpeechContext.type)
-}
-inline void SpeechContext::set_type(const char* value, size_t size) {
-  
-  type_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:kaldi_serve.SpeechContext.type)
+  _impl_.type_.Set(value, GetArenaForAllocation());
 }
 inline std::string* SpeechContext::_internal_mutable_type() {
   
-  return type_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.type_.Mutable(GetArenaForAllocation());
 }
 inline std::string* SpeechContext::release_type() {
   // @@protoc_insertion_point(field_release:kaldi_serve.SpeechContext.type)
-  
-  return type_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  return _impl_.type_.Release();
 }
 inline void SpeechContext::set_allocated_type(std::string* type) {
   if (type != nullptr) {
@@ -3245,7 +6062,12 @@ inline void SpeechContext::set_allocated_type(std::string* type) {
   } else {
     
   }
-  type_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), type);
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:kaldi_serve.SpeechContext.type)
 }
 
@@ -3270,6 +6092,18 @@ inline void SpeechContext::set_allocated_type(std::string* type) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3282,6 +6116,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::kaldi_serve::RecognitionConfig_AudioEncoding>() {
   return ::kaldi_serve::RecognitionConfig_AudioEncoding_descriptor();
 }
+template <> struct is_proto_enum< ::kaldi_serve::RecognitionConfig_Priority> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::kaldi_serve::RecognitionConfig_Priority>() {
+  return ::kaldi_serve::RecognitionConfig_Priority_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
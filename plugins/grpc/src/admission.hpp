@@ -0,0 +1,155 @@
+// admission.hpp - Admission Control & Load Shedding
+#pragma once
+
+// stl includes
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+// lib includes
+#include <kaldiserve/decoder.hpp>
+#include <kaldiserve/utils.hpp>
+
+// gRPC inludes
+#include <grpcpp/server_context.h>
+
+using namespace kaldiserve;
+
+
+// weight of the latest request in the moving averages
+static const double ADMISSION_EWMA_ALPHA = 0.1;
+// min interval (secs) between two reads of the host's cpu counters
+static const double CPU_SAMPLE_INTERVAL = 1.0;
+
+
+// AdmissionController ::
+// Decides per model whether a new request should be let in or shed right away.
+// Requests are rejected with UNAVAILABLE (which clients and load balancers treat as
+// retryable) when too many are already waiting for a decoder, when the expected
+// wait for a decoder is over the bound, when requests queue up while decoding has
+// recently been running slower than the bound on real-time factor or when the
+// host's cpus are saturated.
+class AdmissionController final {
+
+  public:
+    explicit AdmissionController(const ModelSpec &model_spec) noexcept
+        : max_waiting_(model_spec.admission_max_waiting),
+          max_wait_(model_spec.admission_max_wait),
+          max_rtf_(model_spec.admission_max_rtf),
+          max_cpu_(model_spec.admission_max_cpu) {}
+
+    // OK if a new request may go on to acquire a decoder from the queue
+    grpc::Status admit(const DecoderQueue &queue) {
+        const std::size_t waiting = queue.waiting();
+
+        if (max_waiting_ > 0 && waiting >= std::size_t(max_waiting_)) {
+            return reject_("too many requests waiting for a decoder (" + std::to_string(waiting) + ")");
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (max_wait_ > 0 && waiting > 0) {
+            // every waiter ahead (and this one) needs a decoder to be given back,
+            // which happens at a rate of capacity / avg. hold time
+            const double expected_wait = (waiting + 1) * hold_secs_ / queue.capacity();
+            if (expected_wait > max_wait_) {
+                return reject_("expected wait for a decoder is " + to_string_(expected_wait) + "s");
+            }
+        }
+
+        // only while requests queue up: shed requests aren't around to bring the average back down
+        if (max_rtf_ > 0 && waiting > 0 && rtf_ > max_rtf_) {
+            return reject_("decoding is running at " + to_string_(rtf_) + "x real-time");
+        }
+
+        if (max_cpu_ > 0) {
+            sample_cpu_();
+            if (cpu_ > max_cpu_) {
+                return reject_("cpu utilization is at " + to_string_(100 * cpu_) + "%");
+            }
+        }
+
+        return grpc::Status::OK;
+    }
+
+    // Records a finished request that held `decoder` since `acquired_at`.
+    void record(const Decoder *const decoder,
+                const std::chrono::steady_clock::time_point &acquired_at) {
+        const double hold_secs = elapsed_secs(acquired_at);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        hold_secs_ += ADMISSION_EWMA_ALPHA * (hold_secs - hold_secs_);
+        const DecodingStats &stats = decoder->stats();
+        if (stats.audio_secs > 0) {
+            rtf_ += ADMISSION_EWMA_ALPHA * (stats.compute_secs() / stats.audio_secs - rtf_);
+        }
+    }
+
+    // moving average of the real-time factor of recent requests
+    inline double rtf() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return rtf_;
+    }
+
+    // moving average of how long recent requests held a decoder (secs)
+    inline double hold_secs() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hold_secs_;
+    }
+
+  private:
+    // bounds (0 disables)
+    const int max_waiting_;
+    const double max_wait_;
+    const double max_rtf_;
+    const double max_cpu_;
+
+    std::mutex mutex_;
+    // moving averages of how long requests hold a decoder and of their real-time factor
+    double hold_secs_ = 0;
+    double rtf_ = 0;
+
+    // host cpu utilization between the last two samples of /proc/stat
+    double cpu_ = 0;
+    unsigned long long cpu_busy_ = 0, cpu_total_ = 0;
+    std::chrono::steady_clock::time_point cpu_sampled_at_;
+
+    inline static grpc::Status reject_(const std::string &reason) {
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE, "Server overloaded, retry later :: " + reason);
+    }
+
+    inline static std::string to_string_(const double &value) {
+        std::ostringstream ss;
+        ss.precision(2);
+        ss << std::fixed << value;
+        return ss.str();
+    }
+
+    // refreshes `cpu_` at most once every CPU_SAMPLE_INTERVAL (called with mutex_ held)
+    void sample_cpu_() {
+        const auto now = std::chrono::steady_clock::now();
+        if (std::chrono::duration<double>(now - cpu_sampled_at_).count() < CPU_SAMPLE_INTERVAL) return;
+        cpu_sampled_at_ = now;
+
+        std::FILE *file = std::fopen("/proc/stat", "r");
+        if (file == nullptr) return;
+
+        unsigned long long user = 0, nice = 0, system = 0, idle = 0, iowait = 0, irq = 0, softirq = 0, steal = 0;
+        const int n = std::fscanf(file, "cpu %llu %llu %llu %llu %llu %llu %llu %llu",
+                                  &user, &nice, &system, &idle, &iowait, &irq, &softirq, &steal);
+        std::fclose(file);
+        if (n < 4) return;
+
+        const unsigned long long busy = user + nice + system + irq + softirq + steal;
+        const unsigned long long total = busy + idle + iowait;
+
+        if (cpu_total_ != 0 && total > cpu_total_) {
+            cpu_ = double(busy - cpu_busy_) / double(total - cpu_total_);
+        }
+        cpu_busy_ = busy;
+        cpu_total_ = total;
+    }
+};
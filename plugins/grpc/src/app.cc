@@ -4,6 +4,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 #include <stdlib.h>
 
@@ -14,6 +15,7 @@
 // local includes
 #include "config.hpp"
 #include "server.hpp"
+#include "async_server.hpp"
 
 // vendor includes
 #include "vendor/CLI11.hpp"
@@ -31,10 +33,30 @@ int main(int argc, char *argv[]) {
 
     app.add_flag("-d,--debug", DEBUG, "Flag to enable debug mode");
 
+    bool async = false;
+    app.add_flag("--async", async, "Serve with the asynchronous (completion queue) server");
+
+    std::size_t n_workers = std::max(std::thread::hardware_concurrency(), 1u);
+    app.add_option("--workers", n_workers, "No. of decoding worker threads of the async server (defaults to no. of cores)");
+
+    std::size_t n_io_threads = 1;
+    app.add_option("--io-threads", n_io_threads, "No. of completion queue threads of the async server");
+
+    int metrics_port = 0;
+    app.add_option("--metrics-port", metrics_port, "Port to export Prometheus metrics on at /metrics (disabled if 0)");
+
+    std::string trace_file;
+    app.add_option("--trace-file", trace_file, "File to append per-request traces to (as OTLP/JSON lines)");
+
+    std::string trace_collector;
+    app.add_option("--trace-collector", trace_collector, "host:port of an OTLP/HTTP collector to export per-request traces to");
+
     app.add_flag_callback("-v,--version", print_version, "Show program version and exit");
 
     CLI11_PARSE(app, argc, argv);
 
+    if (DEBUG) set_log_level(LogLevel::DEBUG);
+
     std::vector<ModelSpec> model_specs;
     parse_model_specs(model_spec_toml, model_specs);
 
@@ -48,7 +70,24 @@ int main(int argc, char *argv[]) {
         std::cout << "::   - " << model_spec.name + " (" + model_spec.language_code + ")" << ENDL;
     }
 
-    run_server(model_specs);
+    std::vector<TenantSpec> tenant_specs;
+    parse_tenant_specs(model_spec_toml, tenant_specs);
+
+    if (tenant_specs.size() != 0) {
+        std::cout << ":: Fair-sharing decoders among " << tenant_specs.size() << " tenants" << ENDL;
+    }
+
+    std::unique_ptr<TraceExporter> tracer;
+    if (!trace_file.empty() || !trace_collector.empty()) {
+        tracer = make_uniq<TraceExporter>(trace_file, trace_collector);
+        std::cout << ":: Tracing requests" << ENDL;
+    }
+
+    if (async) {
+        run_async_server(model_specs, tenant_specs, n_workers, n_io_threads, metrics_port, tracer.get());
+    } else {
+        run_server(model_specs, tenant_specs, metrics_port, tracer.get());
+    }
 
     return 0;
 }
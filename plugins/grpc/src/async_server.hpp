@@ -0,0 +1,1245 @@
+// async_server.hpp - Asynchronous Server Interface
+#pragma once
+
+// stl includes
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// lib includes
+#include <kaldiserve/decoder.hpp>
+#include <kaldiserve/utils.hpp>
+
+// kaldi includes
+#include <base/kaldi-error.h>
+
+// gRPC inludes
+#include <grpc/grpc.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+
+// local includes
+#include "admission.hpp"
+#include "config.hpp"
+#include "metrics.hpp"
+#include "server.hpp"
+#include "tracing.hpp"
+#include "kaldi_serve.grpc.pb.h"
+
+using namespace kaldiserve;
+
+
+// WorkStealingPool ::
+// Fixed set of worker threads, each with its own task deque. Tasks submitted
+// from a worker go onto its own deque (keeping a session's work on a warm core),
+// others are spread round-robin; workers run their own tasks in order and steal
+// from the back of other workers' deques when they run out.
+class WorkStealingPool final {
+
+  public:
+    explicit WorkStealingPool(const std::size_t &n_workers);
+
+    WorkStealingPool(const WorkStealingPool &) = delete; // disable copying
+
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete; // disable assignment
+
+    ~WorkStealingPool();
+
+    // queues a task for the workers
+    void submit(std::function<void()> task);
+
+  private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    // worker loop
+    void run_(const std::size_t index);
+
+    // takes a task from the worker's own deque or steals one from the others
+    bool try_take_(const std::size_t &index, std::function<void()> &task);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+
+    // no. of queued tasks and sleeping workers (to skip notifying when all are busy)
+    std::atomic<std::size_t> n_tasks_{0};
+    std::atomic<std::size_t> n_sleeping_{0};
+    std::atomic<std::size_t> next_worker_{0};
+
+    bool stopped_ = false;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+
+    // pool and index of the worker the current thread is (if any)
+    static thread_local WorkStealingPool *current_pool_;
+    static thread_local std::size_t current_index_;
+};
+
+thread_local WorkStealingPool *WorkStealingPool::current_pool_ = nullptr;
+thread_local std::size_t WorkStealingPool::current_index_ = 0;
+
+WorkStealingPool::WorkStealingPool(const std::size_t &n_workers) {
+    for (std::size_t i = 0; i < std::max(n_workers, std::size_t(1)); i++) {
+        workers_.push_back(std::unique_ptr<Worker>(new Worker()));
+    }
+    for (std::size_t i = 0; i < workers_.size(); i++) {
+        threads_.emplace_back(&WorkStealingPool::run_, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    cond_.notify_all();
+    for (auto &thread : threads_) thread.join();
+}
+
+void WorkStealingPool::submit(std::function<void()> task) {
+    const std::size_t index = current_pool_ == this ? current_index_ : next_worker_++ % workers_.size();
+    {
+        Worker &worker = *workers_[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    n_tasks_++;
+
+    // pairs with the sleeping worker re-checking `n_tasks_`
+    if (n_sleeping_.load() > 0) {
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        cond_.notify_one();
+    }
+}
+
+bool WorkStealingPool::try_take_(const std::size_t &index, std::function<void()> &task) {
+    for (std::size_t i = 0; i < workers_.size(); i++) {
+        Worker &worker = *workers_[(index + i) % workers_.size()];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.tasks.empty()) continue;
+
+        // own tasks in order, stolen ones from the other end
+        if (i == 0) {
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+        } else {
+            task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+        }
+        n_tasks_--;
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::run_(const std::size_t index) {
+    current_pool_ = this;
+    current_index_ = index;
+
+    while (true) {
+        std::function<void()> task;
+        if (try_take_(index, task)) {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        n_sleeping_++;
+        while (!stopped_ && n_tasks_.load() == 0) cond_.wait(lock);
+        n_sleeping_--;
+        if (stopped_ && n_tasks_.load() == 0) return;
+    }
+}
+
+
+// Base of the completion queue tags.
+class AsyncCall {
+
+  public:
+    virtual ~AsyncCall() = default;
+
+    // handles the completion of the tagged operation
+    virtual void proceed(const bool &ok) = 0;
+};
+
+
+// Tag of one kind of a call's operations, dispatching their completions to a handler.
+class OpTag final : public AsyncCall {
+
+  public:
+    explicit OpTag(std::function<void(const bool &)> handler) : handler_(std::move(handler)) {}
+
+    void proceed(const bool &ok) override {
+        handler_(ok);
+    }
+
+  private:
+    std::function<void(const bool &)> handler_;
+};
+
+
+// AsyncKaldiServeImpl ::
+// Completion queue based implementation of the `KaldiServe` service. Network
+// I/O is event-driven on a few completion queue threads, decoders are acquired
+// without blocking (`DecoderQueue::acquire_async`) and each recognition is a
+// session whose incoming chunks are queued as tasks and decoded in order on a
+// work-stealing pool of workers, so CPU (and a thread) is only taken when
+// audio actually arrives.
+class AsyncKaldiServeImpl final {
+
+  public:
+    AsyncKaldiServeImpl(const std::vector<ModelSpec> &,
+                        const std::vector<TenantSpec> &,
+                        const std::size_t &n_workers,
+                        TraceExporter *const tracer = nullptr) noexcept;
+
+    // serves on the address with `n_io_threads` completion queues (blocks)
+    void run(const std::string &server_address, const std::size_t &n_io_threads);
+
+    // metrics of the served models (to be exported)
+    inline const MetricsRegistry &metrics() const noexcept {
+        return metrics_;
+    }
+
+  private:
+    class ListModelsCall;
+    class GetServerStatsCall;
+    class RecognizeSession;
+    class RecognizeCall;
+    class StreamingRecognizeCall;
+    class BidiStreamingRecognizeCall;
+    class BatchRecognizeCall;
+
+    // event loop of a completion queue thread
+    void poll_(grpc::ServerCompletionQueue *const);
+
+    kaldi_serve::KaldiServe::AsyncService service_;
+    std::unique_ptr<grpc::Server> server_;
+    std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> cqs_;
+
+    // Map of Thread-safe Decoder MPMC Queues for diff languages/models
+    std::unordered_map<model_id_t, std::unique_ptr<DecoderQueue>, model_id_hash> decoder_queue_map_;
+    // Admission controllers shedding load per model before it piles up in the queues
+    std::unordered_map<model_id_t, std::unique_ptr<AdmissionController>, model_id_hash> admission_map_;
+
+    // Per model metrics of the requests served
+    MetricsRegistry metrics_;
+
+    // Exporter of per-request traces (nullptr if tracing is disabled)
+    TraceExporter *tracer_;
+
+    WorkStealingPool workers_;
+};
+
+
+class AsyncKaldiServeImpl::ListModelsCall final : public AsyncCall {
+
+  public:
+    ListModelsCall(AsyncKaldiServeImpl *const server, grpc::ServerCompletionQueue *const cq)
+        : server_(server), cq_(cq), responder_(&ctx_) {
+        server_->service_.RequestListModels(&ctx_, &request_, &responder_, cq_, cq_, this);
+    }
+
+    void proceed(const bool &ok) override {
+        if (finished_ || !ok) {
+            delete this;
+            return;
+        }
+        // wait for the next call
+        new ListModelsCall(server_, cq_);
+
+        kaldi_serve::ModelList model_list;
+        for (auto const &model_id : server_->decoder_queue_map_) {
+            kaldi_serve::Model *model = model_list.add_models();
+            model->set_name(model_id.first.first);
+            model->set_language_code(model_id.first.second);
+        }
+        finished_ = true;
+        responder_.Finish(model_list, grpc::Status::OK, this);
+    }
+
+  private:
+    AsyncKaldiServeImpl *server_;
+    grpc::ServerCompletionQueue *cq_;
+    grpc::ServerContext ctx_;
+    google::protobuf::Empty request_;
+    grpc::ServerAsyncResponseWriter<kaldi_serve::ModelList> responder_;
+    bool finished_ = false;
+};
+
+
+class AsyncKaldiServeImpl::GetServerStatsCall final : public AsyncCall {
+
+  public:
+    GetServerStatsCall(AsyncKaldiServeImpl *const server, grpc::ServerCompletionQueue *const cq)
+        : server_(server), cq_(cq), responder_(&ctx_) {
+        server_->service_.RequestGetServerStats(&ctx_, &request_, &responder_, cq_, cq_, this);
+    }
+
+    void proceed(const bool &ok) override {
+        if (finished_ || !ok) {
+            delete this;
+            return;
+        }
+        // wait for the next call
+        new GetServerStatsCall(server_, cq_);
+
+        kaldi_serve::ServerStats server_stats;
+        add_server_stats(server_->decoder_queue_map_, server_->admission_map_, &server_stats);
+        finished_ = true;
+        responder_.Finish(server_stats, grpc::Status::OK, this);
+    }
+
+  private:
+    AsyncKaldiServeImpl *server_;
+    grpc::ServerCompletionQueue *cq_;
+    grpc::ServerContext ctx_;
+    google::protobuf::Empty request_;
+    grpc::ServerAsyncResponseWriter<kaldi_serve::ServerStats> responder_;
+    bool finished_ = false;
+};
+
+
+// max tasks of a session run in one go before letting other sessions have the worker
+static const int SESSION_TASKS_PER_TURN = 4;
+
+// RecognizeSession ::
+// State of a recognition call: decoder acquisition, the strand running the
+// session's tasks one at a time in order, read-ahead of audio chunks, error
+// handling and lifetime. Every outstanding operation, the pending acquisition,
+// the running strand and the "done" notification hold a reference to the
+// session; it's deleted once the last one is dropped.
+class AsyncKaldiServeImpl::RecognizeSession {
+
+  public:
+    RecognizeSession(AsyncKaldiServeImpl *const server, grpc::ServerCompletionQueue *const cq)
+        : server_(server), cq_(cq),
+          request_tag_([this](const bool &ok) { on_request_(ok); }),
+          read_tag_([this](const bool &ok) { on_read_(ok); }),
+          finish_tag_([this](const bool &) { unref_(); }),
+          done_tag_([this](const bool &) { done_ = true; unref_(); }) {
+        ctx_.AsyncNotifyWhenDone(&done_tag_);
+    }
+
+    virtual ~RecognizeSession() = default;
+
+  protected:
+    // the call got accepted (or the server is shutting down)
+    virtual void on_request_(const bool &ok) = 0;
+
+    // starts decoding once a decoder got acquired (on the strand)
+    virtual void start_() = 0;
+
+    // decodes the next chunk of a stream (on the strand)
+    virtual void decode_chunk_(const kaldi_serve::RecognizeRequest &chunk) {}
+
+    // wraps up the stream after the last chunk (on the strand)
+    virtual void finalize_() {}
+
+    // issues a read of the next chunk into `request_`
+    virtual void read_() {}
+
+    // sends the final status to the client
+    virtual void send_finish_(const grpc::Status &status) = 0;
+
+    // finishes the call (only the first status counts)
+    void finish_(const grpc::Status &status) {
+        if (finished_.exchange(true)) return;
+        if (queue_ != nullptr) server_->metrics_.count_outcome(model_id_, status.error_code());
+        if (trace_) server_->tracer_->finish(std::move(trace_), status);
+        ref_();
+        send_finish_(status);
+    }
+
+    // starts reading the chunks of a stream
+    void start_reading_() {
+        ref_();
+        read_();
+    }
+
+    // looks up the model and starts acquiring a decoder for it, holding the
+    // strand until `start_` has run (returns false if the call got finished instead)
+    bool acquire_(const kaldi_serve::RecognizeRequest &request, const std::string &rpc, const RequestPriority &rpc_priority) {
+        const kaldi_serve::RecognitionConfig &config = request.config();
+        uuid_ = request.uuid();
+        model_id_ = std::make_pair(config.model(), config.language_code());
+
+        auto it = server_->decoder_queue_map_.find(model_id_);
+        if (it == server_->decoder_queue_map_.end()) {
+            finish_(grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + config.model() + " (" + config.language_code() + ") not found"));
+            return false;
+        }
+        queue_ = it->second.get();
+        admission_ = server_->admission_map_[model_id_].get();
+        if (server_->tracer_ != nullptr) trace_ = server_->tracer_->start(&ctx_, rpc, uuid_, model_id_);
+
+        // shed the request early rather than letting it wait behind a backlog
+        grpc::Status admission_status = admission_->admit(*queue_);
+        if (!admission_status.ok()) {
+            finish_(admission_status);
+            return false;
+        }
+
+        if (DEBUG) start_time_ = std::chrono::system_clock::now();
+        acquire_start_ = std::chrono::steady_clock::now();
+
+        AcquireOptions options;
+        options.deadline = ctx_.deadline();
+        options.is_cancelled = cancellation_token_();
+        options.priority = request_priority(config, rpc_priority);
+        options.tenant = request_tenant(&ctx_, request);
+
+        // chunks arriving meanwhile queue up on the held strand
+        {
+            std::lock_guard<std::mutex> lock(strand_mutex_);
+            strand_running_ = true;
+        }
+        ref_();
+        queue_->acquire_async(options, [this](Decoder *decoder) {
+            server_->workers_.submit([this, decoder]() {
+                on_acquired_(decoder);
+                drain_();
+            });
+        });
+        return true;
+    }
+
+    // queues a task on the session's strand
+    void post_(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(strand_mutex_);
+            strand_tasks_.push(std::move(task));
+            if (strand_running_) return;
+            strand_running_ = true;
+        }
+        ref_();
+        server_->workers_.submit([this]() { drain_(); });
+    }
+
+    // runs a piece of decoding work on the current (worker) thread, pinned to
+    // the decoder's NUMA node, and fails the call if it throws
+    bool decode_(const std::function<void()> &work) {
+        ScopedThreadAffinity affinity(queue_->affinity(decoder_));
+        try {
+            work();
+            return true;
+        } catch (DecodingCancelledError &e) {
+            release_decoder_();
+            finish_(grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding"));
+        } catch (kaldi::KaldiFatalError &e) {
+            release_decoder_();
+            finish_(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, std::string(e.what()) + " :: " + std::string(e.KaldiMessage())));
+        } catch (std::exception &e) {
+            release_decoder_();
+            finish_(grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
+        }
+        return false;
+    }
+
+    // tells the decoder the client went away (the done notification coming in before we finish)
+    std::function<bool()> cancellation_token_() {
+        return [this]() { return done_.load() && !is_finished_(); };
+    }
+
+    // frees up the decoder and pushes it back into the queue
+    void release_decoder_() {
+        if (decoder_ == nullptr) return;
+        admission_->record(decoder_, acquired_at_);
+        server_->metrics_.observe_utterance(model_id_, decoder_->stats());
+        server_->metrics_.observe_decoder_memory(model_id_, decoder_->memory());
+        if (trace_) trace_->spans.insert(trace_->spans.end(), decoder_->spans().begin(), decoder_->spans().end());
+        decoder_->free_decoder();
+        queue_->release(decoder_);
+        decoder_ = nullptr;
+
+        if (DEBUG) {
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start_time_);
+            log_debug("uuid: %s request resolved in: %lldms", uuid_.c_str(), (long long) ms.count());
+        }
+    }
+
+    inline bool is_finished_() const {
+        return finished_.load();
+    }
+
+    void ref_() {
+        refs_++;
+    }
+
+    void unref_() {
+        if (--refs_ == 0) delete this;
+    }
+
+    AsyncKaldiServeImpl *server_;
+    grpc::ServerCompletionQueue *cq_;
+    grpc::ServerContext ctx_;
+
+    OpTag request_tag_;
+    OpTag read_tag_;
+    OpTag finish_tag_;
+
+    kaldi_serve::RecognizeRequest request_;
+    // sample rate and alternatives come from the first request of a stream
+    kaldi_serve::RecognitionConfig first_config_;
+
+    std::string uuid_;
+    model_id_t model_id_;
+    DecoderQueue *queue_ = nullptr;
+    AdmissionController *admission_ = nullptr;
+    Decoder *decoder_ = nullptr;
+    // set while the request is being traced
+    std::unique_ptr<RequestTrace> trace_;
+
+  private:
+    void on_acquired_(Decoder *decoder) {
+        if (decoder == nullptr) {
+            if (done_) {
+                finish_(grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while waiting for a decoder"));
+            } else {
+                finish_(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                     "No decoder available for model " + model_id_.first + " (" + model_id_.second + ") before the deadline"));
+            }
+            return;
+        }
+        decoder_ = decoder;
+        acquired_at_ = std::chrono::steady_clock::now();
+        server_->metrics_.observe_wait(model_id_, elapsed_secs(acquire_start_));
+        if (trace_) {
+            Span span;
+            span.name = "acquire_decoder";
+            span.start_time = trace_->start_time;
+            span.end_time = std::chrono::system_clock::now();
+            trace_->spans.push_back(std::move(span));
+        }
+
+        if (DEBUG) {
+            auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start_time_);
+            log_debug("uuid: %s decoder acquired in: %lldms", uuid_.c_str(), (long long) ms.count());
+        }
+        start_();
+    }
+
+    // a chunk came in: queue it for decoding and read ahead the next one
+    void on_read_(const bool &ok) {
+        if (!is_finished_()) {
+            if (ok) {
+                auto chunk = std::make_shared<kaldi_serve::RecognizeRequest>();
+                chunk->Swap(&request_);
+                post_([this, chunk]() {
+                    if (decoder_ != nullptr && !is_finished_()) decode_chunk_(*chunk);
+                });
+                start_reading_();
+            } else {
+                // end of stream
+                post_([this]() {
+                    if (decoder_ != nullptr && !is_finished_()) finalize_();
+                });
+            }
+        }
+        unref_();
+    }
+
+    // runs the queued tasks of the session
+    void drain_() {
+        for (int i = 0; ; i++) {
+            std::function<void()> task;
+            {
+                std::lock_guard<std::mutex> lock(strand_mutex_);
+                if (strand_tasks_.empty()) {
+                    strand_running_ = false;
+                    break;
+                }
+                if (i == SESSION_TASKS_PER_TURN) {
+                    // give other sessions a go at this worker
+                    server_->workers_.submit([this]() { drain_(); });
+                    return;
+                }
+                task = std::move(strand_tasks_.front());
+                strand_tasks_.pop();
+            }
+            task();
+        }
+        unref_();
+    }
+
+    OpTag done_tag_;
+    std::atomic<bool> done_{false};
+    std::atomic<bool> finished_{false};
+    // the pending request and the done notification
+    std::atomic<int> refs_{2};
+
+    std::mutex strand_mutex_;
+    std::queue<std::function<void()>> strand_tasks_;
+    bool strand_running_ = false;
+
+    std::chrono::system_clock::time_point start_time_;
+    std::chrono::steady_clock::time_point acquire_start_;
+    std::chrono::steady_clock::time_point acquired_at_;
+};
+
+
+class AsyncKaldiServeImpl::RecognizeCall final : public RecognizeSession {
+
+  public:
+    RecognizeCall(AsyncKaldiServeImpl *const server, grpc::ServerCompletionQueue *const cq)
+        : RecognizeSession(server, cq), responder_(&ctx_) {
+        server_->service_.RequestRecognize(&ctx_, &request_, &responder_, cq_, cq_, &request_tag_);
+    }
+
+  private:
+    void on_request_(const bool &ok) override {
+        if (ok) {
+            // wait for the next call
+            new RecognizeCall(server_, cq_);
+            acquire_(request_, "Recognize", RequestPriority::LOW);
+        }
+        unref_();
+    }
+
+    void start_() override {
+        const kaldi_serve::RecognitionConfig &config = request_.config();
+
+        bool decoded = decode_([this, &config]() {
+            std::stringstream input_stream(request_.audio().content());
+            decoder_->start_decoding(uuid_, cancellation_token_(), trace_ != nullptr);
+
+            utterance_results_t k_results_;
+            if (config.parallel_segments() > 1) {
+                // a long audio gets split at silences and decoded on spare decoders too,
+                // with the helpers' segments run on the worker pool like any other work
+                SegmentHelpers helpers(server_->decoder_queue_map_[model_id_].get(), config.parallel_segments(),
+                                       request_tenant(&ctx_, request_));
+                const task_executor_t executor = [this](std::function<void()> task) {
+                    server_->workers_.submit(std::move(task));
+                };
+                if (config.raw()) {
+                    decoder_->decode_segmented_raw_wav_audio(input_stream, config.sample_rate_hertz(), config.data_bytes(),
+                                                             helpers.decoders(), config.max_alternatives(), k_results_,
+                                                             config.word_level(), 1, executor);
+                } else {
+                    decoder_->decode_segmented_wav_audio(input_stream, helpers.decoders(), config.max_alternatives(),
+                                                         k_results_, config.word_level(), 1, executor);
+                }
+            } else {
+                if (config.raw()) {
+                    decoder_->decode_raw_wav_audio(input_stream, config.sample_rate_hertz(), config.data_bytes());
+                } else {
+                    decoder_->decode_wav_audio(input_stream);
+                }
+                decoder_->get_decoded_results(config.max_alternatives(), k_results_, config.word_level());
+            }
+            add_alternatives_to_response(k_results_, decoder_->stats(), &response_, config);
+        });
+        if (!decoded) return;
+
+        release_decoder_();
+        finish_(grpc::Status::OK);
+    }
+
+    void send_finish_(const grpc::Status &status) override {
+        if (status.ok()) {
+            responder_.Finish(response_, status, &finish_tag_);
+        } else {
+            responder_.FinishWithError(status, &finish_tag_);
+        }
+    }
+
+    kaldi_serve::RecognizeResponse response_;
+    grpc::ServerAsyncResponseWriter<kaldi_serve::RecognizeResponse> responder_;
+};
+
+
+class AsyncKaldiServeImpl::StreamingRecognizeCall final : public RecognizeSession {
+
+  public:
+    StreamingRecognizeCall(AsyncKaldiServeImpl *const server, grpc::ServerCompletionQueue *const cq)
+        : RecognizeSession(server, cq), reader_(&ctx_),
+          first_read_tag_([this](const bool &ok) { on_first_read_(ok); }) {
+        server_->service_.RequestStreamingRecognize(&ctx_, &reader_, cq_, cq_, &request_tag_);
+    }
+
+  private:
+    void on_request_(const bool &ok) override {
+        if (ok) {
+            // wait for the next call
+            new StreamingRecognizeCall(server_, cq_);
+            // We first read the request to see if we have the correct model and language to load
+            ref_();
+            reader_.Read(&request_, &first_read_tag_);
+        }
+        unref_();
+    }
+
+    void on_first_read_(const bool &ok) {
+        first_config_ = config_ = request_.config();
+        if (acquire_(request_, "StreamingRecognize", RequestPriority::HIGH)) {
+            // the first request carries audio too
+            read_tag_.proceed(ok);
+            return;
+        }
+        unref_();
+    }
+
+    void start_() override {
+        decoder_->start_decoding(uuid_, cancellation_token_(), trace_ != nullptr);
+    }
+
+    void decode_chunk_(const kaldi_serve::RecognizeRequest &chunk) override {
+        // Assuming: config may change mid-way (only `raw` and `data_bytes` fields)
+        config_ = chunk.config();
+
+        decode_([this, &chunk]() {
+            std::stringstream input_stream_chunk(chunk.audio().content());
+            if (config_.raw()) {
+                decoder_->decode_stream_raw_wav_chunk(input_stream_chunk, first_config_.sample_rate_hertz(), config_.data_bytes());
+            } else {
+                decoder_->decode_stream_wav_chunk(input_stream_chunk);
+            }
+        });
+    }
+
+    void finalize_() override {
+        bool decoded = decode_([this]() {
+            utterance_results_t k_results_;
+            decoder_->get_decoded_results(first_config_.max_alternatives(), k_results_, config_.word_level());
+            add_alternatives_to_response(k_results_, decoder_->stats(), &response_, config_);
+        });
+        if (!decoded) return;
+
+        release_decoder_();
+        finish_(grpc::Status::OK);
+    }
+
+    void read_() override {
+        reader_.Read(&request_, &read_tag_);
+    }
+
+    void send_finish_(const grpc::Status &status) override {
+        if (status.ok()) {
+            reader_.Finish(response_, status, &finish_tag_);
+        } else {
+            reader_.FinishWithError(status, &finish_tag_);
+        }
+    }
+
+    kaldi_serve::RecognitionConfig config_;
+    kaldi_serve::RecognizeResponse response_;
+    grpc::ServerAsyncReader<kaldi_serve::RecognizeResponse, kaldi_serve::RecognizeRequest> reader_;
+    OpTag first_read_tag_;
+};
+
+
+class AsyncKaldiServeImpl::BidiStreamingRecognizeCall final : public RecognizeSession {
+
+  public:
+    BidiStreamingRecognizeCall(AsyncKaldiServeImpl *const server, grpc::ServerCompletionQueue *const cq)
+        : RecognizeSession(server, cq), stream_(&ctx_),
+          first_read_tag_([this](const bool &ok) { on_first_read_(ok); }),
+          write_tag_([this](const bool &ok) { on_write_(ok); }) {
+        server_->service_.RequestBidiStreamingRecognize(&ctx_, &stream_, cq_, cq_, &request_tag_);
+    }
+
+  private:
+    void on_request_(const bool &ok) override {
+        if (ok) {
+            // wait for the next call
+            new BidiStreamingRecognizeCall(server_, cq_);
+            // We first read the request to see if we have the correct model and language to load
+            ref_();
+            stream_.Read(&request_, &first_read_tag_);
+        }
+        unref_();
+    }
+
+    void on_first_read_(const bool &ok) {
+        first_config_ = config_ = request_.config();
+        if (acquire_(request_, "BidiStreamingRecognize", RequestPriority::HIGH)) {
+            // the first request carries audio too
+            read_tag_.proceed(ok);
+            return;
+        }
+        unref_();
+    }
+
+    void start_() override {
+        decoder_->start_decoding(uuid_, cancellation_token_(), trace_ != nullptr);
+    }
+
+    // decodes the chunk and writes back the intermediate results
+    void decode_chunk_(const kaldi_serve::RecognizeRequest &chunk) override {
+        // Assuming: config may change mid-way (only `raw` and `data_bytes` fields)
+        config_ = chunk.config();
+
+        kaldi_serve::RecognizeResponse response;
+        bool segment_final = false;
+        bool decoded = decode_([this, &chunk, &response, &segment_final]() {
+            std::stringstream input_stream_chunk(chunk.audio().content());
+            if (config_.raw()) {
+                decoder_->decode_stream_raw_wav_chunk(input_stream_chunk, first_config_.sample_rate_hertz(), config_.data_bytes());
+            } else {
+                decoder_->decode_stream_wav_chunk(input_stream_chunk);
+            }
+
+            utterance_results_t k_results_;
+            if (first_config_.continuous() && decoder_->endpoint_detected()) {
+                // the segment is over, send its final result and go on with the next one
+                decoder_->get_decoded_results(first_config_.max_alternatives(), k_results_, config_.word_level());
+                add_alternatives_to_response(k_results_, decoder_->stats(), &response, config_);
+                decoder_->start_next_segment();
+                segment_final = true;
+            } else {
+                decoder_->get_decoded_results(first_config_.max_alternatives(), k_results_, config_.word_level(), true);
+                add_alternatives_to_response(k_results_, decoder_->stats(), &response, config_, false);
+            }
+        });
+        if (!decoded) return;
+
+        if (segment_final) {
+            interim_results_ = InterimResults();
+            write_(response);
+        } else if (interim_results_.update(&response, config_.interim_results_on_change())) {
+            write_(response);
+        }
+    }
+
+    void finalize_() override {
+        kaldi_serve::RecognizeResponse response;
+        bool decoded = decode_([this, &response]() {
+            utterance_results_t k_results_;
+            decoder_->get_decoded_results(first_config_.max_alternatives(), k_results_, config_.word_level());
+            add_alternatives_to_response(k_results_, decoder_->stats(), &response, config_);
+        });
+        if (!decoded) return;
+
+        release_decoder_();
+        write_(response);
+        finish_(grpc::Status::OK);
+    }
+
+    void read_() override {
+        stream_.Read(&request_, &read_tag_);
+    }
+
+    // writes a response once the ones before it are out (one write in flight at a time)
+    void write_(const kaldi_serve::RecognizeResponse &response) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        if (write_broken_) return;
+        if (writing_) {
+            pending_writes_.push(response);
+            return;
+        }
+        writing_ = true;
+        in_flight_write_ = response;
+        ref_();
+        stream_.Write(in_flight_write_, &write_tag_);
+    }
+
+    void on_write_(const bool &ok) {
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            if (!ok) {
+                // the stream is broken, the client won't hear from us anymore
+                write_broken_ = true;
+                pending_writes_ = std::queue<kaldi_serve::RecognizeResponse>();
+                post_([this]() {
+                    release_decoder_();
+                    finish_(grpc::Status(grpc::StatusCode::CANCELLED, "Stream closed while writing results"));
+                });
+            }
+
+            if (!pending_writes_.empty()) {
+                in_flight_write_ = std::move(pending_writes_.front());
+                pending_writes_.pop();
+                stream_.Write(in_flight_write_, &write_tag_);
+                // the reference of the completed write carries over
+                return;
+            }
+            writing_ = false;
+
+            // the status waits for the writes ahead of it
+            if (pending_finish_) {
+                pending_finish_ = false;
+                stream_.Finish(pending_status_, &finish_tag_);
+            }
+        }
+        unref_();
+    }
+
+    void send_finish_(const grpc::Status &status) override {
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            // sent by `on_write_` (with the reference `finish_` took) once the writes are out
+            if (writing_) {
+                pending_finish_ = true;
+                pending_status_ = status;
+                return;
+            }
+        }
+        stream_.Finish(status, &finish_tag_);
+    }
+
+    kaldi_serve::RecognitionConfig config_;
+    // decoded chunks run one at a time on the strand
+    InterimResults interim_results_;
+    grpc::ServerAsyncReaderWriter<kaldi_serve::RecognizeResponse, kaldi_serve::RecognizeRequest> stream_;
+    OpTag first_read_tag_;
+    OpTag write_tag_;
+
+    std::mutex write_mutex_;
+    std::queue<kaldi_serve::RecognizeResponse> pending_writes_;
+    kaldi_serve::RecognizeResponse in_flight_write_;
+    bool writing_ = false;
+    bool write_broken_ = false;
+    bool pending_finish_ = false;
+    grpc::Status pending_status_;
+};
+
+
+// BatchRecognizeCall ::
+// Decodes the audios of a batch in parallel lanes, as many as the model has
+// decoders (capped by the request). Each lane acquires a decoder per audio
+// (without blocking, so that other requests get their turn in between),
+// decodes it on a worker and writes back the result as soon as it's done.
+// Every pending acquisition, running decode, write in flight and the "done"
+// notification hold a reference to the call; it's deleted once the last one
+// is dropped.
+class AsyncKaldiServeImpl::BatchRecognizeCall final : public AsyncCall {
+
+  public:
+    BatchRecognizeCall(AsyncKaldiServeImpl *const server, grpc::ServerCompletionQueue *const cq)
+        : server_(server), cq_(cq), writer_(&ctx_),
+          write_tag_([this](const bool &ok) { on_write_(ok); }),
+          finish_tag_([this](const bool &) { unref_(); }),
+          done_tag_([this](const bool &) { done_ = true; unref_(); }) {
+        ctx_.AsyncNotifyWhenDone(&done_tag_);
+        server_->service_.RequestBatchRecognize(&ctx_, &request_, &writer_, cq_, cq_, this);
+    }
+
+    // the call got accepted (or the server is shutting down)
+    void proceed(const bool &ok) override {
+        if (ok) {
+            // wait for the next call
+            new BatchRecognizeCall(server_, cq_);
+            start_();
+        }
+        unref_();
+    }
+
+  private:
+    void start_() {
+        const kaldi_serve::RecognitionConfig &config = request_.config();
+        model_id_ = std::make_pair(config.model(), config.language_code());
+
+        auto it = server_->decoder_queue_map_.find(model_id_);
+        if (it == server_->decoder_queue_map_.end()) {
+            finish_(grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + config.model() + " (" + config.language_code() + ") not found"));
+            return;
+        }
+        // the batch is already spread over the model's decoders
+        if (config.parallel_segments() > 1) {
+            finish_(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "parallel_segments is not supported by BatchRecognize"));
+            return;
+        }
+        queue_ = it->second.get();
+        admission_ = server_->admission_map_[model_id_].get();
+        if (server_->tracer_ != nullptr) trace_ = server_->tracer_->start(&ctx_, "BatchRecognize", request_.uuid(), model_id_);
+
+        // the batch is admitted (or shed) as a whole
+        grpc::Status admission_status = admission_->admit(*queue_);
+        if (!admission_status.ok()) {
+            finish_(admission_status);
+            return;
+        }
+
+        options_.deadline = ctx_.deadline();
+        options_.is_cancelled = cancellation_token_();
+        options_.priority = request_priority(config, RequestPriority::LOW);
+        options_.tenant = request_tenant(&ctx_, request_);
+
+        const std::size_t n_lanes = batch_parallelism(request_, *queue_);
+        if (n_lanes == 0) {
+            finish_(grpc::Status::OK);
+            return;
+        }
+        n_lanes_ = n_lanes;
+        for (std::size_t i = 0; i < n_lanes; i++) next_audio_();
+    }
+
+    // takes the next audio of the batch and acquires a decoder for it (or ends the lane)
+    void next_audio_() {
+        const std::size_t index = next_audio_index_++;
+        if (index >= std::size_t(request_.audios_size()) || failed_) {
+            end_lane_();
+            return;
+        }
+
+        ref_();
+        const auto acquire_start = std::chrono::steady_clock::now();
+        queue_->acquire_async(options_, [this, index, acquire_start](Decoder *decoder) {
+            server_->workers_.submit([this, index, acquire_start, decoder]() {
+                decode_audio_(index, acquire_start, decoder);
+                unref_();
+            });
+        });
+    }
+
+    void decode_audio_(const std::size_t &index,
+                       const std::chrono::steady_clock::time_point &acquire_start,
+                       Decoder *decoder) {
+        if (decoder == nullptr) {
+            if (done_) {
+                fail_(grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while waiting for a decoder"));
+            } else {
+                fail_(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                   "No decoder available for model " + model_id_.first + " (" + model_id_.second + ") before the deadline"));
+            }
+            end_lane_();
+            return;
+        }
+        server_->metrics_.observe_wait(model_id_, elapsed_secs(acquire_start));
+        const auto acquired_at = std::chrono::steady_clock::now();
+
+        kaldi_serve::BatchRecognizeResponse response;
+        response.set_index(int32(index));
+        grpc::Status status = grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding");
+        if (!failed_) {
+            status = recognize_audio(decoder, queue_->affinity(decoder), request_.config(), request_.audios(index),
+                                     request_.uuid() + ":" + std::to_string(index), cancellation_token_(),
+                                     trace_ != nullptr, response.mutable_response());
+        }
+
+        if (status.error_code() == grpc::StatusCode::CANCELLED) {
+            decoder->free_decoder();
+            queue_->release(decoder);
+            fail_(status);
+            end_lane_();
+            return;
+        }
+        release_decoder_(decoder, acquired_at);
+
+        // a failed audio doesn't fail the batch
+        if (!status.ok()) {
+            response.clear_response();
+            response.set_error_code(int32(status.error_code()));
+            response.set_error_message(status.error_message());
+        }
+        write_(response);
+        next_audio_();
+    }
+
+    // records the request's metrics (and the decoder's spans), frees up the
+    // decoder and pushes it back into the queue
+    void release_decoder_(Decoder *const decoder, const std::chrono::steady_clock::time_point &acquired_at) {
+        admission_->record(decoder, acquired_at);
+        server_->metrics_.observe_utterance(model_id_, decoder->stats());
+        server_->metrics_.observe_decoder_memory(model_id_, decoder->memory());
+        if (trace_) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            trace_->spans.insert(trace_->spans.end(), decoder->spans().begin(), decoder->spans().end());
+        }
+        decoder->free_decoder();
+        queue_->release(decoder);
+    }
+
+    // tells the decoders the client went away (the call isn't finished before the lanes end)
+    std::function<bool()> cancellation_token_() {
+        return [this]() { return done_.load(); };
+    }
+
+    // fails the batch (only the first status counts), stopping the lanes after their current audio
+    void fail_(const grpc::Status &status) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!failed_.exchange(true)) status_ = status;
+    }
+
+    // finishes the call with the batch's status once the last lane ends
+    void end_lane_() {
+        if (--n_lanes_ > 0) return;
+
+        grpc::Status status;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            status = status_;
+        }
+        finish_(status);
+    }
+
+    void finish_(const grpc::Status &status) {
+        if (queue_ != nullptr) server_->metrics_.count_outcome(model_id_, status.error_code());
+        if (trace_) server_->tracer_->finish(std::move(trace_), status);
+        ref_();
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            // sent by `on_write_` (with the reference taken above) once the writes are out
+            if (writing_) {
+                pending_finish_ = true;
+                pending_status_ = status;
+                return;
+            }
+        }
+        writer_.Finish(status, &finish_tag_);
+    }
+
+    // writes a response once the ones before it are out (one write in flight at a time)
+    void write_(const kaldi_serve::BatchRecognizeResponse &response) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        if (write_broken_) return;
+        if (writing_) {
+            pending_writes_.push(response);
+            return;
+        }
+        writing_ = true;
+        in_flight_write_ = response;
+        ref_();
+        writer_.Write(in_flight_write_, &write_tag_);
+    }
+
+    void on_write_(const bool &ok) {
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            if (!ok) {
+                // the stream is broken, the client won't hear from us anymore
+                write_broken_ = true;
+                pending_writes_ = std::queue<kaldi_serve::BatchRecognizeResponse>();
+                fail_(grpc::Status(grpc::StatusCode::CANCELLED, "Stream closed while writing results"));
+            }
+
+            if (!pending_writes_.empty()) {
+                in_flight_write_ = std::move(pending_writes_.front());
+                pending_writes_.pop();
+                writer_.Write(in_flight_write_, &write_tag_);
+                // the reference of the completed write carries over
+                return;
+            }
+            writing_ = false;
+
+            // the status waits for the writes ahead of it
+            if (pending_finish_) {
+                pending_finish_ = false;
+                writer_.Finish(pending_status_, &finish_tag_);
+            }
+        }
+        unref_();
+    }
+
+    void ref_() {
+        refs_++;
+    }
+
+    void unref_() {
+        if (--refs_ == 0) delete this;
+    }
+
+    AsyncKaldiServeImpl *server_;
+    grpc::ServerCompletionQueue *cq_;
+    grpc::ServerContext ctx_;
+    kaldi_serve::BatchRecognizeRequest request_;
+    grpc::ServerAsyncWriter<kaldi_serve::BatchRecognizeResponse> writer_;
+
+    OpTag write_tag_;
+    OpTag finish_tag_;
+    OpTag done_tag_;
+
+    model_id_t model_id_;
+    DecoderQueue *queue_ = nullptr;
+    AdmissionController *admission_ = nullptr;
+    AcquireOptions options_;
+    // set while the request is being traced
+    std::unique_ptr<RequestTrace> trace_;
+
+    std::atomic<std::size_t> next_audio_index_{0};
+    std::atomic<std::size_t> n_lanes_{0};
+    std::atomic<bool> failed_{false};
+    std::atomic<bool> done_{false};
+    // the pending request and the done notification
+    std::atomic<int> refs_{2};
+
+    // guards the batch status and the trace
+    std::mutex mutex_;
+    grpc::Status status_;
+
+    std::mutex write_mutex_;
+    std::queue<kaldi_serve::BatchRecognizeResponse> pending_writes_;
+    kaldi_serve::BatchRecognizeResponse in_flight_write_;
+    bool writing_ = false;
+    bool write_broken_ = false;
+    bool pending_finish_ = false;
+    grpc::Status pending_status_;
+};
+
+
+AsyncKaldiServeImpl::AsyncKaldiServeImpl(const std::vector<ModelSpec> &model_specs,
+                                         const std::vector<TenantSpec> &tenant_specs,
+                                         const std::size_t &n_workers,
+                                         TraceExporter *const tracer) noexcept
+    : tracer_(tracer), workers_(n_workers) {
+    for (auto const &model_spec : model_specs) {
+        model_id_t model_id = std::make_pair(model_spec.name, model_spec.language_code);
+        decoder_queue_map_[model_id] = std::unique_ptr<DecoderQueue>(new DecoderQueue(model_spec, tenant_specs));
+        admission_map_[model_id] = std::unique_ptr<AdmissionController>(new AdmissionController(model_spec));
+        metrics_.add_model(model_id, decoder_queue_map_[model_id].get());
+    }
+}
+
+void AsyncKaldiServeImpl::run(const std::string &server_address, const std::size_t &n_io_threads) {
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    builder.RegisterService(&service_);
+    for (std::size_t i = 0; i < std::max(n_io_threads, std::size_t(1)); i++) {
+        cqs_.push_back(builder.AddCompletionQueue());
+    }
+    server_ = builder.BuildAndStart();
+
+    log_info("kaldi-serve gRPC Async Server listening on %s", server_address.c_str());
+
+    std::vector<std::thread> io_threads;
+    for (auto &cq : cqs_) {
+        io_threads.emplace_back(&AsyncKaldiServeImpl::poll_, this, cq.get());
+    }
+    for (auto &io_thread : io_threads) io_thread.join();
+}
+
+void AsyncKaldiServeImpl::poll_(grpc::ServerCompletionQueue *const cq) {
+    // one call of each kind waiting for the next request on this queue
+    new ListModelsCall(this, cq);
+    new GetServerStatsCall(this, cq);
+    new RecognizeCall(this, cq);
+    new StreamingRecognizeCall(this, cq);
+    new BidiStreamingRecognizeCall(this, cq);
+    new BatchRecognizeCall(this, cq);
+
+    void *tag;
+    bool ok;
+    while (cq->Next(&tag, &ok)) {
+        static_cast<AsyncCall *>(tag)->proceed(ok);
+    }
+}
+
+
+void run_async_server(const std::vector<ModelSpec> &model_specs,
+                      const std::vector<TenantSpec> &tenant_specs,
+                      const std::size_t &n_workers,
+                      const std::size_t &n_io_threads,
+                      const int &metrics_port = 0,
+                      TraceExporter *const tracer = nullptr) {
+    AsyncKaldiServeImpl service(model_specs, tenant_specs, n_workers, tracer);
+
+    std::unique_ptr<MetricsServer> metrics_server;
+    if (metrics_port > 0) metrics_server = make_uniq<MetricsServer>(&service.metrics(), metrics_port);
+    service.run("0.0.0.0:5016", n_io_threads);
+}
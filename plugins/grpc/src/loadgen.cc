@@ -0,0 +1,449 @@
+// loadgen.cc - Real-time Streaming Load Generator
+//
+// Replays audio files against a running server as `BidiStreamingRecognize` (or
+// `StreamingRecognize`) streams, sending each chunk only once its audio would
+// have been recorded (i.e. paced at real time), with a no. of concurrent
+// streams that is stepped up over a ramp. For every step it measures the
+// latency of the first partial result, the latency of the final result after
+// the end of audio and the error rate, and reports the most concurrent streams
+// the server sustained within the given bounds.
+
+// stl includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// lib includes
+#include <kaldiserve/config.hpp>
+
+// gRPC inludes
+#include <grpcpp/grpcpp.h>
+
+// local includes
+#include "kaldi_serve.grpc.pb.h"
+
+// vendor includes
+#include "vendor/CLI11.hpp"
+
+using namespace kaldiserve;
+
+
+// max concurrent streams multiplexed over a single connection (servers limit
+// concurrent HTTP/2 streams per connection, 100 by default)
+static const int STREAMS_PER_CHANNEL = 64;
+
+
+// mono 16-bit PCM audio of a wav file
+struct Audio {
+    std::string path;
+    std::string pcm;
+    int sample_rate;
+    double secs;
+};
+
+// outcome of a single replayed stream
+struct StreamResult {
+    grpc::StatusCode code = grpc::StatusCode::OK;
+    // secs from sending the first chunk to receiving the first partial result (-1 if none)
+    double first_partial_secs = -1;
+    // secs from the end of audio to receiving the final result
+    double final_secs = -1;
+    double audio_secs = 0;
+};
+
+struct Options {
+    std::string model = "general";
+    std::string language_code = "en";
+    bool bidi = true;
+    double chunk_secs = 0.5;
+    int max_alternatives = 1;
+    double timeout_secs = 30;
+};
+
+// results of the streams run at one level of concurrency
+struct Step {
+    int concurrency;
+    std::size_t n_streams = 0;
+    std::size_t n_errors = 0;
+    std::map<std::string, std::size_t> errors;
+    double audio_secs = 0;
+    double first_partial[3] = {0, 0, 0};
+    double final[3] = {0, 0, 0};
+    bool within_bounds = true;
+};
+
+
+// reads a mono 16-bit PCM wav file
+Audio read_wav(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("could not read " + path);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    const std::string bytes = ss.str();
+
+    auto u16 = [&bytes](const std::size_t &pos) {
+        return uint16_t(uint8_t(bytes[pos])) | uint16_t(uint8_t(bytes[pos + 1])) << 8;
+    };
+    auto u32 = [&u16](const std::size_t &pos) { return uint32_t(u16(pos)) | uint32_t(u16(pos + 2)) << 16; };
+
+    if (bytes.size() < 12 || bytes.compare(0, 4, "RIFF") != 0 || bytes.compare(8, 4, "WAVE") != 0) {
+        throw std::runtime_error(path + " is not a wav file");
+    }
+
+    Audio audio;
+    audio.path = path;
+    audio.sample_rate = 0;
+    int channels = 0, bits = 0;
+
+    std::size_t pos = 12;
+    while (pos + 8 <= bytes.size()) {
+        const std::string id = bytes.substr(pos, 4);
+        const std::size_t size = std::min<std::size_t>(u32(pos + 4), bytes.size() - pos - 8);
+        if (id == "fmt " && size >= 16) {
+            channels = u16(pos + 10);
+            audio.sample_rate = int(u32(pos + 12));
+            bits = u16(pos + 22);
+        } else if (id == "data") {
+            audio.pcm = bytes.substr(pos + 8, size);
+        }
+        pos += 8 + size + (size & 1);
+    }
+
+    if (channels != 1 || bits != 16 || audio.sample_rate <= 0 || audio.pcm.empty()) {
+        throw std::runtime_error(path + " should be mono 16-bit PCM audio");
+    }
+    audio.secs = double(audio.pcm.size() / 2) / audio.sample_rate;
+    return audio;
+}
+
+// nearest-rank percentile of the values (sorts them)
+double percentile(std::vector<double> &values, const double &p) {
+    if (values.empty()) return 0;
+    std::sort(values.begin(), values.end());
+    std::size_t rank = std::size_t(std::ceil(p / 100.0 * values.size()));
+    return values[std::min(values.size(), std::max<std::size_t>(rank, 1)) - 1];
+}
+
+inline double secs_between(const std::chrono::steady_clock::time_point &from,
+                           const std::chrono::steady_clock::time_point &to) {
+    return std::chrono::duration<double>(to - from).count();
+}
+
+const char *status_code_name(const grpc::StatusCode &code) {
+    switch (code) {
+        case grpc::StatusCode::OK: return "OK";
+        case grpc::StatusCode::CANCELLED: return "CANCELLED";
+        case grpc::StatusCode::INVALID_ARGUMENT: return "INVALID_ARGUMENT";
+        case grpc::StatusCode::DEADLINE_EXCEEDED: return "DEADLINE_EXCEEDED";
+        case grpc::StatusCode::NOT_FOUND: return "NOT_FOUND";
+        case grpc::StatusCode::RESOURCE_EXHAUSTED: return "RESOURCE_EXHAUSTED";
+        case grpc::StatusCode::INTERNAL: return "INTERNAL";
+        case grpc::StatusCode::UNAVAILABLE: return "UNAVAILABLE";
+        default: return "UNKNOWN";
+    }
+}
+
+
+// Replays an audio file as a single stream paced at real time.
+StreamResult replay(kaldi_serve::KaldiServe::Stub *const stub, const Audio &audio,
+                    const Options &options, const std::string &uuid) {
+    StreamResult result;
+    result.audio_secs = audio.secs;
+
+    grpc::ClientContext context;
+    context.set_deadline(std::chrono::system_clock::now() +
+                         std::chrono::milliseconds(int64_t(1000 * (audio.secs + options.timeout_secs))));
+
+    const std::size_t chunk_bytes = std::max<std::size_t>(2, 2 * std::size_t(options.chunk_secs * audio.sample_rate));
+    const std::size_t n_chunks = (audio.pcm.size() + chunk_bytes - 1) / chunk_bytes;
+
+    // sends the chunks through `write`, each once its audio is over
+    std::chrono::steady_clock::time_point first_sent_at, end_of_audio;
+    auto send_chunks = [&](std::function<bool(const kaldi_serve::RecognizeRequest &)> write) {
+        kaldi_serve::RecognizeRequest request;
+        request.set_uuid(uuid);
+        kaldi_serve::RecognitionConfig *config = request.mutable_config();
+        config->set_encoding(kaldi_serve::RecognitionConfig::LINEAR16);
+        config->set_sample_rate_hertz(audio.sample_rate);
+        config->set_language_code(options.language_code);
+        config->set_model(options.model);
+        config->set_max_alternatives(options.max_alternatives);
+        config->set_raw(true);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < n_chunks; i++) {
+            const std::size_t offset = i * chunk_bytes;
+            const std::size_t size = std::min(chunk_bytes, audio.pcm.size() - offset);
+
+            std::this_thread::sleep_until(start + std::chrono::microseconds(
+                int64_t(1e6 * double(offset + size) / 2 / audio.sample_rate)));
+
+            config->set_data_bytes(int(size));
+            request.mutable_audio()->set_content(audio.pcm.data() + offset, size);
+            if (i == 0) first_sent_at = std::chrono::steady_clock::now();
+            if (!write(request)) break;
+        }
+        end_of_audio = std::chrono::steady_clock::now();
+    };
+
+    grpc::Status status;
+    if (options.bidi) {
+        auto stream = stub->BidiStreamingRecognize(&context);
+
+        std::thread writer([&]() {
+            send_chunks([&stream](const kaldi_serve::RecognizeRequest &request) { return stream->Write(request); });
+            stream->WritesDone();
+        });
+
+        // the last response is the final result, the ones before are partials
+        kaldi_serve::RecognizeResponse response;
+        std::chrono::steady_clock::time_point first_response_at, last_response_at;
+        bool got_response = false;
+        while (stream->Read(&response)) {
+            last_response_at = std::chrono::steady_clock::now();
+            if (!got_response) first_response_at = last_response_at;
+            got_response = true;
+        }
+        writer.join();
+        status = stream->Finish();
+
+        if (got_response) {
+            result.first_partial_secs = secs_between(first_sent_at, first_response_at);
+            result.final_secs = std::max(0.0, secs_between(end_of_audio, last_response_at));
+        }
+    } else {
+        kaldi_serve::RecognizeResponse response;
+        auto stream = stub->StreamingRecognize(&context, &response);
+
+        send_chunks([&stream](const kaldi_serve::RecognizeRequest &request) { return stream->Write(request); });
+        stream->WritesDone();
+        status = stream->Finish();
+        result.final_secs = secs_between(end_of_audio, std::chrono::steady_clock::now());
+    }
+
+    result.code = status.error_code();
+    return result;
+}
+
+
+int main(int argc, char *argv[]) {
+    CLI::App app{"Kaldi gRPC real-time streaming load generator"};
+
+    std::string wav_list;
+    app.add_option("wav_list", wav_list, "File listing wav files (mono 16-bit PCM) to replay, one per line")
+      ->required()
+      ->check(CLI::ExistingFile);
+
+    std::string server = "0.0.0.0:5016";
+    app.add_option("--server", server, "host:port of the server");
+
+    Options options;
+    app.add_option("--model", options.model, "Name of the model to stream to");
+    app.add_option("--lang", options.language_code, "Language code of the model");
+    app.add_option("--chunk-size", options.chunk_secs, "Secs of audio per chunk");
+    app.add_option("--max-alternatives", options.max_alternatives, "No. of alternatives to ask for");
+    app.add_option("--timeout", options.timeout_secs, "Secs over the audio duration before a stream is timed out");
+
+    bool unary_response = false;
+    app.add_flag("--no-partials", unary_response, "Stream with StreamingRecognize instead of BidiStreamingRecognize");
+
+    int concurrency = 1;
+    app.add_option("--concurrency", concurrency, "Concurrent streams to start the ramp at");
+
+    int ramp_step = 0;
+    app.add_option("--ramp-step", ramp_step, "Concurrent streams to add at every step of the ramp (0 runs a single step)");
+
+    int ramp_max = 0;
+    app.add_option("--ramp-max", ramp_max, "Concurrent streams to end the ramp at");
+
+    double step_secs = 60;
+    app.add_option("--step-secs", step_secs, "Secs to keep each step's streams running for");
+
+    double max_error_rate = 0.01;
+    app.add_option("--max-error-rate", max_error_rate, "Bound on the fraction of failed streams per step");
+
+    double max_first_partial_ms = 0;
+    app.add_option("--max-first-partial", max_first_partial_ms, "Bound on p95 first partial latency in ms (0 disables)");
+
+    double max_final_ms = 0;
+    app.add_option("--max-final", max_final_ms, "Bound on p95 final result latency after end of audio in ms (0 disables)");
+
+    int server_cores = 0;
+    app.add_option("--server-cores", server_cores, "Cores of the server, to report streams per core");
+
+    bool keep_going = false;
+    app.add_flag("--keep-going", keep_going, "Continue the ramp past the first step out of bounds");
+
+    std::string json_path;
+    app.add_option("--json", json_path, "File to write the results to as JSON (- for stdout)");
+
+    CLI11_PARSE(app, argc, argv);
+
+    options.bidi = !unary_response;
+    concurrency = std::max(concurrency, 1);
+    ramp_max = std::max(ramp_max, concurrency);
+    if (ramp_step <= 0) ramp_max = concurrency;
+
+    std::vector<Audio> audios;
+    try {
+        std::ifstream list(wav_list);
+        std::string path;
+        while (std::getline(list, path)) {
+            if (!path.empty()) audios.push_back(read_wav(path));
+        }
+    } catch (std::exception &e) {
+        std::cerr << ":: " << e.what() << ENDL;
+        return 1;
+    }
+    if (audios.empty()) {
+        std::cerr << ":: No audio found in " << wav_list << ENDL;
+        return 1;
+    }
+
+    // spread the streams over enough connections
+    std::vector<std::unique_ptr<kaldi_serve::KaldiServe::Stub>> stubs;
+    const int n_channels = (ramp_max + STREAMS_PER_CHANNEL - 1) / STREAMS_PER_CHANNEL;
+    for (int i = 0; i < n_channels; i++) {
+        grpc::ChannelArguments args;
+        args.SetInt("kaldiserve.loadgen.channel", i); // distinct args keep channels off a shared connection
+        stubs.push_back(kaldi_serve::KaldiServe::NewStub(
+            grpc::CreateCustomChannel(server, grpc::InsecureChannelCredentials(), args)));
+    }
+
+    std::cout << ":: Replaying " << audios.size() << " files to " << server << " with "
+              << (options.bidi ? "BidiStreamingRecognize" : "StreamingRecognize") << " in "
+              << options.chunk_secs << "s chunks" << ENDL;
+    std::cout << std::setw(8) << "streams" << std::setw(10) << "done" << std::setw(10) << "errors"
+              << std::setw(24) << "first partial (ms)" << std::setw(24) << "final (ms)" << ENDL
+              << std::setw(8) << "" << std::setw(10) << "" << std::setw(10) << ""
+              << std::setw(24) << "p50 / p95 / p99" << std::setw(24) << "p50 / p95 / p99" << ENDL;
+
+    std::vector<Step> steps;
+    std::atomic<std::size_t> next_audio(0), next_uuid(0);
+    int max_concurrency = 0;
+
+    for (int n = concurrency; n <= ramp_max; n += std::max(ramp_step, 1)) {
+        std::mutex mutex;
+        std::vector<StreamResult> results;
+        const auto step_start = std::chrono::steady_clock::now();
+        const auto step_end = step_start + std::chrono::milliseconds(int64_t(1000 * step_secs));
+
+        // each client keeps a stream going (back to back) until the step is over
+        std::vector<std::thread> clients;
+        for (int c = 0; c < n; c++) {
+            clients.emplace_back([&, c]() {
+                // stagger the starts over a chunk so that streams don't send in lockstep
+                std::this_thread::sleep_for(std::chrono::microseconds(int64_t(1e6 * options.chunk_secs * c / n)));
+
+                while (std::chrono::steady_clock::now() < step_end) {
+                    const Audio &audio = audios[next_audio++ % audios.size()];
+                    const std::string uuid = "loadgen-" + std::to_string(next_uuid++);
+                    StreamResult result = replay(stubs[c % stubs.size()].get(), audio, options, uuid);
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    results.push_back(result);
+                }
+            });
+        }
+        for (auto &client : clients) client.join();
+
+        Step step;
+        step.concurrency = n;
+        std::vector<double> first_partials, finals;
+        for (auto const &result : results) {
+            step.n_streams++;
+            step.audio_secs += result.audio_secs;
+            if (result.code != grpc::StatusCode::OK) {
+                step.n_errors++;
+                step.errors[status_code_name(result.code)]++;
+                continue;
+            }
+            if (result.first_partial_secs >= 0) first_partials.push_back(1000 * result.first_partial_secs);
+            if (result.final_secs >= 0) finals.push_back(1000 * result.final_secs);
+        }
+        const double percentiles[] = {50, 95, 99};
+        for (int p = 0; p < 3; p++) {
+            step.first_partial[p] = percentile(first_partials, percentiles[p]);
+            step.final[p] = percentile(finals, percentiles[p]);
+        }
+
+        const double error_rate = step.n_streams ? double(step.n_errors) / step.n_streams : 1;
+        step.within_bounds = error_rate <= max_error_rate &&
+                             (max_first_partial_ms <= 0 || !options.bidi || step.first_partial[1] <= max_first_partial_ms) &&
+                             (max_final_ms <= 0 || step.final[1] <= max_final_ms);
+        if (step.within_bounds) max_concurrency = std::max(max_concurrency, n);
+
+        std::ostringstream first_partial, final;
+        first_partial << std::fixed << std::setprecision(0)
+                      << step.first_partial[0] << " / " << step.first_partial[1] << " / " << step.first_partial[2];
+        final << std::fixed << std::setprecision(0) << step.final[0] << " / " << step.final[1] << " / " << step.final[2];
+        std::cout << std::setw(8) << n << std::setw(10) << step.n_streams << std::setw(10) << step.n_errors
+                  << std::setw(24) << (options.bidi ? first_partial.str() : "-") << std::setw(24) << final.str()
+                  << (step.within_bounds ? "" : "   (out of bounds)") << ENDL;
+        for (auto const &error : step.errors) {
+            std::cout << std::setw(28) << error.first << ": " << error.second << ENDL;
+        }
+
+        steps.push_back(step);
+        if (!step.within_bounds && !keep_going) break;
+    }
+
+    std::cout << ":: Max concurrent streams within bounds: " << max_concurrency;
+    if (server_cores > 0) {
+        std::cout << " (" << std::fixed << std::setprecision(2) << double(max_concurrency) / server_cores << " per core)";
+    }
+    std::cout << ENDL;
+
+    if (!json_path.empty()) {
+        std::ostringstream json;
+        json << std::setprecision(6)
+             << "{\"server\":\"" << server << "\",\"model\":\"" << options.model << "\",\"language_code\":\""
+             << options.language_code << "\",\"rpc\":\""
+             << (options.bidi ? "BidiStreamingRecognize" : "StreamingRecognize") << "\""
+             << ",\"chunk_secs\":" << options.chunk_secs << ",\"steps\":[";
+        for (std::size_t s = 0; s < steps.size(); s++) {
+            const Step &step = steps[s];
+            json << (s ? "," : "") << "{\"concurrency\":" << step.concurrency << ",\"streams\":" << step.n_streams
+                 << ",\"errors\":" << step.n_errors << ",\"error_codes\":{";
+            bool first = true;
+            for (auto const &error : step.errors) {
+                json << (first ? "" : ",") << "\"" << error.first << "\":" << error.second;
+                first = false;
+            }
+            json << "},\"audio_secs\":" << step.audio_secs;
+            if (options.bidi) {
+                json << ",\"first_partial_ms\":{\"p50\":" << step.first_partial[0] << ",\"p95\":"
+                     << step.first_partial[1] << ",\"p99\":" << step.first_partial[2] << "}";
+            }
+            json << ",\"final_ms\":{\"p50\":" << step.final[0] << ",\"p95\":" << step.final[1]
+                 << ",\"p99\":" << step.final[2] << "},\"within_bounds\":"
+                 << (step.within_bounds ? "true" : "false") << "}";
+        }
+        json << "],\"max_concurrency\":" << max_concurrency;
+        if (server_cores > 0) json << ",\"max_concurrency_per_core\":" << double(max_concurrency) / server_cores;
+        json << "}";
+
+        if (json_path == "-") {
+            std::cout << json.str() << ENDL;
+        } else {
+            std::ofstream json_file(json_path);
+            json_file << json.str() << "\n";
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,434 @@
+// metrics.hpp - Prometheus Metrics Registry & Exporter
+#pragma once
+
+// stl includes
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// posix includes
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// lib includes
+#include <kaldiserve/decoder.hpp>
+#include <kaldiserve/types.hpp>
+
+// gRPC inludes
+#include <grpcpp/server_context.h>
+
+// local includes
+#include "config.hpp"
+
+using namespace kaldiserve;
+
+
+// upper bounds (secs) of the latency histogram buckets
+static const std::vector<double> LATENCY_BUCKETS = {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30};
+// upper bounds of the real-time factor histogram buckets
+static const std::vector<double> RTF_BUCKETS = {0.05, 0.1, 0.2, 0.3, 0.5, 0.75, 1, 1.5, 2, 5};
+// upper bounds (bytes) of the decoder memory histogram buckets
+static const std::vector<double> MEMORY_BUCKETS = {1 << 16, 1 << 18, 1 << 20, 1 << 22, 1 << 24, 1 << 26, 1 << 28};
+
+// stages of decoding an utterance timed in `DecodingStats`
+static const char *const DECODING_STAGES[] = {"decode", "finalize", "lattice", "rescore", "nbest"};
+
+// time (secs) a scrape connection may stall reading the request or writing the response
+static const int METRICS_IO_TIMEOUT_SECS = 2;
+// bounds (ms) of the backoff between failing accepts (e.g. out of file descriptors)
+static const int METRICS_ACCEPT_BACKOFF_MIN_MS = 10;
+static const int METRICS_ACCEPT_BACKOFF_MAX_MS = 1000;
+
+
+// Name of a gRPC status code as used in the `code` label of request outcomes
+inline const char *status_code_name(const grpc::StatusCode &code) noexcept {
+    switch (code) {
+        case grpc::StatusCode::OK: return "OK";
+        case grpc::StatusCode::CANCELLED: return "CANCELLED";
+        case grpc::StatusCode::INVALID_ARGUMENT: return "INVALID_ARGUMENT";
+        case grpc::StatusCode::DEADLINE_EXCEEDED: return "DEADLINE_EXCEEDED";
+        case grpc::StatusCode::NOT_FOUND: return "NOT_FOUND";
+        case grpc::StatusCode::ALREADY_EXISTS: return "ALREADY_EXISTS";
+        case grpc::StatusCode::PERMISSION_DENIED: return "PERMISSION_DENIED";
+        case grpc::StatusCode::UNAUTHENTICATED: return "UNAUTHENTICATED";
+        case grpc::StatusCode::RESOURCE_EXHAUSTED: return "RESOURCE_EXHAUSTED";
+        case grpc::StatusCode::FAILED_PRECONDITION: return "FAILED_PRECONDITION";
+        case grpc::StatusCode::ABORTED: return "ABORTED";
+        case grpc::StatusCode::OUT_OF_RANGE: return "OUT_OF_RANGE";
+        case grpc::StatusCode::UNIMPLEMENTED: return "UNIMPLEMENTED";
+        case grpc::StatusCode::INTERNAL: return "INTERNAL";
+        case grpc::StatusCode::UNAVAILABLE: return "UNAVAILABLE";
+        case grpc::StatusCode::DATA_LOSS: return "DATA_LOSS";
+        default: return "UNKNOWN";
+    }
+}
+
+
+// Histogram ::
+// Cumulative bucketed distribution of observed values (not thread-safe
+// by itself, guarded by the registry).
+class Histogram final {
+
+  public:
+    explicit Histogram(const std::vector<double> &bounds) noexcept
+        : bounds_(bounds), counts_(bounds.size() + 1, 0) {}
+
+    void observe(const double &value) noexcept {
+        std::size_t i = 0;
+        while (i < bounds_.size() && value > bounds_[i]) i++;
+        counts_[i]++;
+        sum_ += value;
+    }
+
+    // writes the samples of the histogram in the Prometheus text format
+    void render(std::ostream &out, const std::string &name, const std::string &labels) const {
+        uint64_t count = 0;
+        for (std::size_t i = 0; i < bounds_.size(); i++) {
+            count += counts_[i];
+            out << name << "_bucket{" << labels << ",le=\"" << bounds_[i] << "\"} " << count << "\n";
+        }
+        count += counts_.back();
+        out << name << "_bucket{" << labels << ",le=\"+Inf\"} " << count << "\n";
+        out << name << "_sum{" << labels << "} " << sum_ << "\n";
+        out << name << "_count{" << labels << "} " << count << "\n";
+    }
+
+  private:
+    std::vector<double> bounds_;
+    // per bucket (not cumulative), the last one being +Inf
+    std::vector<uint64_t> counts_;
+    double sum_ = 0;
+};
+
+
+// MetricsRegistry ::
+// Per model counters and histograms of the gRPC server, along with the state
+// of the model's decoder pool sampled at scrape time.
+class MetricsRegistry final {
+
+  public:
+    // registers a model (before serving starts)
+    void add_model(const model_id_t &model_id, DecoderQueue *const queue) {
+        models_[model_id] = make_uniq<ModelMetrics>(queue);
+    }
+
+    // time a request waited for a decoder
+    void observe_wait(const model_id_t &model_id, const double &secs) {
+        ModelMetrics *metrics = find_(model_id);
+        if (metrics == nullptr) return;
+
+        std::lock_guard<std::mutex> lock(metrics->mutex);
+        metrics->decoder_wait.observe(secs);
+    }
+
+    // audio and time spent in each stage of decoding an utterance
+    void observe_utterance(const model_id_t &model_id, const DecodingStats &stats) {
+        ModelMetrics *metrics = find_(model_id);
+        if (metrics == nullptr) return;
+
+        const double stage_secs[] = {stats.decode_secs, stats.finalize_secs, stats.lattice_secs,
+                                     stats.rescore_secs, stats.nbest_secs};
+
+        std::lock_guard<std::mutex> lock(metrics->mutex);
+        for (std::size_t i = 0; i < metrics->stages.size(); i++) {
+            metrics->stages[i].observe(stage_secs[i]);
+        }
+        metrics->audio_secs += stats.audio_secs;
+        metrics->cpu_secs += stats.cpu_secs;
+        if (stats.audio_secs > 0) metrics->cpu_rtf.observe(stats.cpu_secs / stats.audio_secs);
+        if (stats.audio_secs > 0) metrics->rtf.observe(stats.compute_secs() / stats.audio_secs);
+    }
+
+    // memory held by a decoder's state at the end of an utterance
+    void observe_decoder_memory(const model_id_t &model_id, const DecoderMemory &memory) {
+        ModelMetrics *metrics = find_(model_id);
+        if (metrics == nullptr) return;
+
+        std::lock_guard<std::mutex> lock(metrics->mutex);
+        metrics->decoder_features.observe(memory.feature_bytes);
+        metrics->decoder_lattice.observe(memory.lattice_bytes);
+    }
+
+    // final status of a request
+    void count_outcome(const model_id_t &model_id, const grpc::StatusCode &code) {
+        ModelMetrics *metrics = find_(model_id);
+        if (metrics == nullptr) return;
+
+        std::lock_guard<std::mutex> lock(metrics->mutex);
+        metrics->outcomes[status_code_name(code)]++;
+    }
+
+    // all metrics in the Prometheus text exposition format
+    std::string render() const {
+        std::ostringstream out;
+        out.precision(12);
+
+        out << "# HELP kaldiserve_decoders Decoders alive in the pool by state.\n"
+            << "# TYPE kaldiserve_decoders gauge\n";
+        for (auto const &model : models_) {
+            const std::size_t alive = model.second->queue->size();
+            const std::size_t idle = std::min(model.second->queue->idle(), alive);
+            out << "kaldiserve_decoders{" << labels_(model.first) << ",state=\"idle\"} " << idle << "\n"
+                << "kaldiserve_decoders{" << labels_(model.first) << ",state=\"busy\"} " << alive - idle << "\n";
+        }
+
+        out << "# HELP kaldiserve_decoders_max Max decoders the pool can grow to.\n"
+            << "# TYPE kaldiserve_decoders_max gauge\n";
+        for (auto const &model : models_) {
+            out << "kaldiserve_decoders_max{" << labels_(model.first) << "} " << model.second->queue->capacity() << "\n";
+        }
+
+        out << "# HELP kaldiserve_requests_waiting Requests waiting for a decoder.\n"
+            << "# TYPE kaldiserve_requests_waiting gauge\n";
+        for (auto const &model : models_) {
+            out << "kaldiserve_requests_waiting{" << labels_(model.first) << "} " << model.second->queue->waiting() << "\n";
+        }
+
+        out << "# HELP kaldiserve_model_memory_bytes Memory held by the model by component.\n"
+            << "# TYPE kaldiserve_model_memory_bytes gauge\n";
+        for (auto const &model : models_) {
+            const ModelMemory memory = model.second->queue->model_memory();
+            const std::pair<const char *, std::size_t> components[] = {
+                {"hclg", memory.hclg_bytes}, {"am_nnet", memory.am_nnet_bytes},
+                {"ivector_extractor", memory.ivector_extractor_bytes}, {"rnnlm", memory.rnnlm_bytes},
+                {"word_embedding", memory.word_embedding_bytes}, {"lm_fst", memory.lm_fst_bytes},
+                {"word_syms", memory.word_syms_bytes}};
+            for (auto const &component : components) {
+                out << "kaldiserve_model_memory_bytes{" << labels_(model.first) << ",component=\"" << component.first
+                    << "\"} " << component.second << "\n";
+            }
+        }
+
+        out << "# HELP kaldiserve_requests_total Requests handled by final status code.\n"
+            << "# TYPE kaldiserve_requests_total counter\n";
+        for (auto const &model : models_) {
+            std::lock_guard<std::mutex> lock(model.second->mutex);
+            for (auto const &outcome : model.second->outcomes) {
+                out << "kaldiserve_requests_total{" << labels_(model.first) << ",code=\"" << outcome.first << "\"} "
+                    << outcome.second << "\n";
+            }
+        }
+
+        out << "# HELP kaldiserve_audio_seconds_total Seconds of audio decoded.\n"
+            << "# TYPE kaldiserve_audio_seconds_total counter\n";
+        for (auto const &model : models_) {
+            std::lock_guard<std::mutex> lock(model.second->mutex);
+            out << "kaldiserve_audio_seconds_total{" << labels_(model.first) << "} " << model.second->audio_secs << "\n";
+        }
+
+        out << "# HELP kaldiserve_cpu_seconds_total CPU time of the threads decoding utterances.\n"
+            << "# TYPE kaldiserve_cpu_seconds_total counter\n";
+        for (auto const &model : models_) {
+            std::lock_guard<std::mutex> lock(model.second->mutex);
+            out << "kaldiserve_cpu_seconds_total{" << labels_(model.first) << "} " << model.second->cpu_secs << "\n";
+        }
+
+        out << "# HELP kaldiserve_decoder_wait_seconds Time requests waited for a decoder.\n"
+            << "# TYPE kaldiserve_decoder_wait_seconds histogram\n";
+        for (auto const &model : models_) {
+            std::lock_guard<std::mutex> lock(model.second->mutex);
+            model.second->decoder_wait.render(out, "kaldiserve_decoder_wait_seconds", labels_(model.first));
+        }
+
+        out << "# HELP kaldiserve_stage_seconds Time spent per utterance in each stage of decoding.\n"
+            << "# TYPE kaldiserve_stage_seconds histogram\n";
+        for (auto const &model : models_) {
+            std::lock_guard<std::mutex> lock(model.second->mutex);
+            for (std::size_t i = 0; i < model.second->stages.size(); i++) {
+                model.second->stages[i].render(out, "kaldiserve_stage_seconds",
+                                               labels_(model.first) + ",stage=\"" + DECODING_STAGES[i] + "\"");
+            }
+        }
+
+        out << "# HELP kaldiserve_decoder_memory_bytes Memory held by a decoder's state at the end of utterances.\n"
+            << "# TYPE kaldiserve_decoder_memory_bytes histogram\n";
+        for (auto const &model : models_) {
+            std::lock_guard<std::mutex> lock(model.second->mutex);
+            model.second->decoder_features.render(out, "kaldiserve_decoder_memory_bytes",
+                                                  labels_(model.first) + ",part=\"features\"");
+            model.second->decoder_lattice.render(out, "kaldiserve_decoder_memory_bytes",
+                                                 labels_(model.first) + ",part=\"lattice\"");
+        }
+
+        out << "# HELP kaldiserve_real_time_factor Compute time over audio duration of utterances.\n"
+            << "# TYPE kaldiserve_real_time_factor histogram\n";
+        for (auto const &model : models_) {
+            std::lock_guard<std::mutex> lock(model.second->mutex);
+            model.second->rtf.render(out, "kaldiserve_real_time_factor", labels_(model.first));
+        }
+
+        out << "# HELP kaldiserve_cpu_real_time_factor CPU time over audio duration of utterances.\n"
+            << "# TYPE kaldiserve_cpu_real_time_factor histogram\n";
+        for (auto const &model : models_) {
+            std::lock_guard<std::mutex> lock(model.second->mutex);
+            model.second->cpu_rtf.render(out, "kaldiserve_cpu_real_time_factor", labels_(model.first));
+        }
+
+        return out.str();
+    }
+
+  private:
+    struct ModelMetrics {
+        explicit ModelMetrics(DecoderQueue *const queue)
+            : queue(queue), decoder_wait(LATENCY_BUCKETS), rtf(RTF_BUCKETS), cpu_rtf(RTF_BUCKETS),
+              decoder_features(MEMORY_BUCKETS), decoder_lattice(MEMORY_BUCKETS),
+              stages(sizeof(DECODING_STAGES) / sizeof(DECODING_STAGES[0]), Histogram(LATENCY_BUCKETS)) {}
+
+        DecoderQueue *queue;
+
+        mutable std::mutex mutex;
+        Histogram decoder_wait;
+        Histogram rtf;
+        Histogram cpu_rtf;
+        Histogram decoder_features;
+        Histogram decoder_lattice;
+        std::vector<Histogram> stages;
+        double audio_secs = 0;
+        double cpu_secs = 0;
+        std::map<std::string, uint64_t> outcomes;
+    };
+
+    // models are fixed once serving starts, so lookups need no locking
+    std::unordered_map<model_id_t, std::unique_ptr<ModelMetrics>, model_id_hash> models_;
+
+    ModelMetrics *find_(const model_id_t &model_id) const {
+        auto it = models_.find(model_id);
+        return it == models_.end() ? nullptr : it->second.get();
+    }
+
+    // label set of a model (with label values escaped)
+    static std::string labels_(const model_id_t &model_id) {
+        return "model=\"" + escape_(model_id.first) + "\",language_code=\"" + escape_(model_id.second) + "\"";
+    }
+
+    static std::string escape_(const std::string &value) {
+        std::string escaped;
+        for (const char c : value) {
+            if (c == '\\' || c == '"') escaped += '\\';
+            if (c == '\n') {
+                escaped += "\\n";
+                continue;
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+};
+
+
+// MetricsServer ::
+// Minimal HTTP server exposing a registry on `GET /metrics` for Prometheus
+// to scrape. Scrapes are served one at a time on a thread of its own, each
+// bounded by an I/O timeout so a slow client can't hold the others up.
+class MetricsServer final {
+
+  public:
+    MetricsServer(const MetricsRegistry *const registry, const int &port) : registry_(registry) {
+        socket_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (socket_ < 0) {
+            throw std::runtime_error("metrics server :: could not create socket");
+        }
+
+        int reuse = 1;
+        ::setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address;
+        std::memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(uint16_t(port));
+
+        if (::bind(socket_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || ::listen(socket_, 16) < 0) {
+            ::close(socket_);
+            throw std::runtime_error("metrics server :: could not listen on port " + std::to_string(port));
+        }
+
+        thread_ = std::thread(&MetricsServer::serve_, this);
+        log_info("kaldi-serve metrics listening on 0.0.0.0:%d/metrics", port);
+    }
+
+    MetricsServer(const MetricsServer &) = delete; // disable copying
+
+    MetricsServer &operator=(const MetricsServer &) = delete; // disable assignment
+
+    ~MetricsServer() {
+        stopped_ = true;
+        // wakes up the blocked accept
+        ::shutdown(socket_, SHUT_RDWR);
+        thread_.join();
+        ::close(socket_);
+    }
+
+  private:
+    const MetricsRegistry *registry_;
+    int socket_;
+    std::atomic<bool> stopped_{false};
+    std::thread thread_;
+
+    void serve_() {
+        int backoff_ms = 0;
+        while (!stopped_) {
+            const int client = ::accept(socket_, nullptr, nullptr);
+            if (client < 0) {
+                if (stopped_ || errno == EINTR || errno == ECONNABORTED) continue;
+                // persistent failures (EMFILE, ENOBUFS, ...) would otherwise spin the thread
+                backoff_ms = std::min(std::max(2 * backoff_ms, METRICS_ACCEPT_BACKOFF_MIN_MS), METRICS_ACCEPT_BACKOFF_MAX_MS);
+                std::this_thread::sleep_for(std::chrono::milliseconds(backoff_ms));
+                continue;
+            }
+            backoff_ms = 0;
+
+            // a stalled scraper must neither block the next scrape nor our shutdown
+            timeval timeout;
+            timeout.tv_sec = METRICS_IO_TIMEOUT_SECS;
+            timeout.tv_usec = 0;
+            ::setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            ::setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(METRICS_IO_TIMEOUT_SECS);
+
+            // request line and headers (we don't expect a body)
+            std::string request;
+            char buffer[1024];
+            while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192 &&
+                   std::chrono::steady_clock::now() < deadline) {
+                const ssize_t n = ::recv(client, buffer, sizeof(buffer), 0);
+                if (n <= 0) break;
+                request.append(buffer, std::size_t(n));
+            }
+
+            std::string status = "200 OK", body;
+            if (request.compare(0, 13, "GET /metrics ") == 0 || request.compare(0, 13, "GET /metrics?") == 0) {
+                body = registry_->render();
+            } else {
+                status = "404 Not Found";
+                body = "not found\n";
+            }
+
+            const std::string response = "HTTP/1.1 " + status + "\r\n"
+                                         "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                                         "Content-Length: " + std::to_string(body.size()) + "\r\n"
+                                         "Connection: close\r\n\r\n" + body;
+            std::size_t sent = 0;
+            while (sent < response.size()) {
+                const ssize_t n = ::send(client, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+                if (n <= 0) break;
+                sent += std::size_t(n);
+            }
+            ::close(client);
+        }
+    }
+};
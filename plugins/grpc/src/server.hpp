@@ -8,9 +8,18 @@
 #include <string>
 #include <exception>
 #include <chrono>
+#include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 // lib includes
 #include <kaldiserve/decoder.hpp>
+#include <kaldiserve/utils.hpp>
 
 // kaldi includes
 #include <base/kaldi-error.h>
@@ -23,17 +32,27 @@
 #include <grpcpp/server_context.h>
 
 // local includes
+#include "admission.hpp"
 #include "config.hpp"
+#include "metrics.hpp"
+#include "tracing.hpp"
 #include "kaldi_serve.grpc.pb.h"
 
+// posix includes
+#include <unistd.h>
+
 using namespace kaldiserve;
 
 
 void add_alternatives_to_response(const utterance_results_t &results,
+                                  const DecodingStats &stats,
                                   kaldi_serve::RecognizeResponse *response,
-                                  const kaldi_serve::RecognitionConfig &config) noexcept {
+                                  const kaldi_serve::RecognitionConfig &config,
+                                  const bool &is_final = true) noexcept {
 
     kaldi_serve::SpeechRecognitionResult *sr_result = response->add_results();
+    sr_result->set_is_final(is_final);
+    if (is_final) sr_result->set_stability(1.0);
     kaldi_serve::SpeechRecognitionAlternative *alternative;
     kaldi_serve::Word *word;
 
@@ -56,6 +75,215 @@ void add_alternatives_to_response(const utterance_results_t &results,
             }
         }
     }
+
+    // resources used by the utterance so far
+    if (config.report_usage()) {
+        kaldi_serve::ResourceUsage *usage = response->mutable_usage();
+        usage->set_audio_secs(stats.audio_secs);
+        usage->set_cpu_secs(stats.cpu_secs);
+    }
+}
+
+
+// InterimResults ::
+// Tracks the interim results of a bidi stream: estimates their stability
+// as the share of the best transcript's words that held since the previous
+// interim result, and tells if one is worth sending at all.
+class InterimResults final {
+
+  public:
+    // Sets the stability of the interim result in the response, returns false
+    // if it can be skipped (the best transcript is the same as that of the
+    // last one sent and the client only wants changes).
+    bool update(kaldi_serve::RecognizeResponse *const response, const bool &on_change) {
+        kaldi_serve::SpeechRecognitionResult *result = response->mutable_results(0);
+        const std::string transcript = result->alternatives_size() > 0 ? result->alternatives(0).transcript() : "";
+
+        std::vector<std::string> words;
+        std::istringstream stream(transcript);
+        for (std::string word; stream >> word;) words.push_back(word);
+
+        std::size_t n_stable = 0;
+        while (n_stable < words.size() && n_stable < last_words_.size() && words[n_stable] == last_words_[n_stable]) {
+            n_stable++;
+        }
+        result->set_stability(words.empty() ? 0.0 : float(n_stable) / words.size());
+        last_words_ = std::move(words);
+
+        if (on_change && transcript == last_sent_) return false;
+        last_sent_ = transcript;
+        return true;
+    }
+
+  private:
+    // best transcript of the last interim result (split into words) and of the last one sent
+    std::vector<std::string> last_words_;
+    std::string last_sent_;
+};
+
+
+// SegmentHelpers ::
+// Idle decoders of a model taken to decode the segments of a long audio on
+// along with a request's own decoder, given back when done. They are taken
+// without waiting and at low priority (so the reserved decoders stay free),
+// hence only spare capacity goes into a request. A request gets no more
+// decoders than there are cores, as each one keeps a core busy.
+class SegmentHelpers final {
+
+  public:
+    SegmentHelpers(DecoderQueue *const queue, const int &parallel_segments, const std::string &tenant) : queue_(queue) {
+        const int n_cores = std::max(int(std::thread::hardware_concurrency()), 1);
+        const int n_helpers = std::min(parallel_segments, n_cores) - 1;
+        for (int i = 0; i < n_helpers; i++) {
+            Decoder *decoder = queue_->try_acquire(RequestPriority::LOW, tenant);
+            if (decoder == nullptr) break;
+            decoders_.push_back(decoder);
+        }
+    }
+
+    SegmentHelpers(const SegmentHelpers &) = delete; // disable copying
+
+    SegmentHelpers &operator=(const SegmentHelpers &) = delete; // disable assignment
+
+    ~SegmentHelpers() {
+        for (Decoder *decoder : decoders_) {
+            decoder->free_decoder();
+            queue_->release(decoder);
+        }
+    }
+
+    inline const std::vector<Decoder *> &decoders() const noexcept {
+        return decoders_;
+    }
+
+  private:
+    DecoderQueue *const queue_;
+    std::vector<Decoder *> decoders_;
+};
+
+
+// Priority of a request for decoder acquisition, falling back to the RPC's default.
+inline RequestPriority request_priority(const kaldi_serve::RecognitionConfig &config,
+                                        const RequestPriority &rpc_default) noexcept {
+    switch (config.priority()) {
+        case kaldi_serve::RecognitionConfig::LOW:
+            return RequestPriority::LOW;
+        case kaldi_serve::RecognitionConfig::HIGH:
+            return RequestPriority::HIGH;
+        default:
+            return rpc_default;
+    }
+}
+
+
+// Tenant a request is accounted to for fair-sharing decoders: the request's
+// `tenant` field, falling back to the `x-tenant-id` client metadata.
+template <typename Request>
+inline std::string request_tenant(const grpc::ServerContext *const context,
+                                  const Request &request) noexcept {
+    if (!request.tenant().empty()) return request.tenant();
+
+    const auto &metadata = context->client_metadata();
+    auto it = metadata.find("x-tenant-id");
+    if (it != metadata.end()) return std::string(it->second.data(), it->second.size());
+
+    return "";
+}
+
+
+// Decodes a whole audio with an acquired decoder into the response, pinned to
+// the decoder's NUMA node (CANCELLED if `is_cancelled` reports the client gone,
+// INVALID_ARGUMENT for audio that couldn't be decoded).
+grpc::Status recognize_audio(Decoder *const decoder,
+                             const std::vector<int> &affinity,
+                             const kaldi_serve::RecognitionConfig &config,
+                             const kaldi_serve::RecognitionAudio &audio,
+                             const std::string &uuid,
+                             const std::function<bool()> &is_cancelled,
+                             const bool &tracing,
+                             kaldi_serve::RecognizeResponse *const response) noexcept {
+    ScopedThreadAffinity thread_affinity(affinity);
+
+    try {
+        std::stringstream input_stream(audio.content());
+        decoder->start_decoding(uuid, is_cancelled, tracing);
+        if (config.raw()) {
+            decoder->decode_raw_wav_audio(input_stream, config.sample_rate_hertz(), config.data_bytes());
+        } else {
+            decoder->decode_wav_audio(input_stream);
+        }
+
+        utterance_results_t k_results_;
+        decoder->get_decoded_results(config.max_alternatives(), k_results_, config.word_level());
+        add_alternatives_to_response(k_results_, decoder->stats(), response, config);
+    } catch (DecodingCancelledError &e) {
+        return grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding");
+    } catch (kaldi::KaldiFatalError &e) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, std::string(e.what()) + " :: " + std::string(e.KaldiMessage()));
+    } catch (std::exception &e) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+    }
+    return grpc::Status::OK;
+}
+
+
+// No. of audios of a batch decoded at a time: the model's decoders free right
+// now (idle or yet to be grown, at least 1), capped by the request. A busy
+// model thus gets fewer lanes instead of lanes that only queue for decoders.
+inline std::size_t batch_parallelism(const kaldi_serve::BatchRecognizeRequest &request,
+                                     DecoderQueue &queue) {
+    const std::size_t n_alive = std::min(queue.size(), queue.capacity());
+    std::size_t n_parallel = std::max(queue.idle() + queue.capacity() - n_alive, std::size_t(1));
+    if (request.max_parallel() > 0) n_parallel = std::min(n_parallel, std::size_t(request.max_parallel()));
+    return std::min(n_parallel, std::size_t(request.audios_size()));
+}
+
+
+// Resident memory of the server process in bytes (0 if unknown).
+inline int64 process_rss_bytes() noexcept {
+    std::FILE *file = std::fopen("/proc/self/statm", "r");
+    if (file == nullptr) return 0;
+
+    unsigned long long size = 0, resident = 0;
+    const int n = std::fscanf(file, "%llu %llu", &size, &resident);
+    std::fclose(file);
+    if (n < 2) return 0;
+
+    return int64(resident) * sysconf(_SC_PAGESIZE);
+}
+
+
+// Fills in the live load of the served models (for load-aware routing).
+void add_server_stats(const std::unordered_map<model_id_t, std::unique_ptr<DecoderQueue>, model_id_hash> &decoder_queue_map,
+                      const std::unordered_map<model_id_t, std::unique_ptr<AdmissionController>, model_id_hash> &admission_map,
+                      kaldi_serve::ServerStats *const server_stats) noexcept {
+
+    for (auto const &entry : decoder_queue_map) {
+        DecoderQueue &queue = *entry.second;
+        AdmissionController &admission = *admission_map.at(entry.first);
+
+        kaldi_serve::ModelStats *model_stats = server_stats->add_models();
+        model_stats->mutable_model()->set_name(entry.first.first);
+        model_stats->mutable_model()->set_language_code(entry.first.second);
+        model_stats->set_decoders(queue.size());
+        model_stats->set_idle_decoders(queue.idle());
+        model_stats->set_max_decoders(queue.capacity());
+        model_stats->set_waiting_requests(queue.waiting());
+        model_stats->set_real_time_factor(admission.rtf());
+        model_stats->set_decoder_hold_secs(admission.hold_secs());
+
+        const ModelMemory memory = queue.model_memory();
+        kaldi_serve::ModelMemory *model_memory = model_stats->mutable_memory();
+        model_memory->set_hclg_bytes(memory.hclg_bytes);
+        model_memory->set_am_nnet_bytes(memory.am_nnet_bytes);
+        model_memory->set_ivector_extractor_bytes(memory.ivector_extractor_bytes);
+        model_memory->set_rnnlm_bytes(memory.rnnlm_bytes);
+        model_memory->set_word_embedding_bytes(memory.word_embedding_bytes);
+        model_memory->set_lm_fst_bytes(memory.lm_fst_bytes);
+        model_memory->set_word_syms_bytes(memory.word_syms_bytes);
+        model_memory->set_total_bytes(memory.total_bytes());
+    }
+    server_stats->set_memory_rss_bytes(process_rss_bytes());
 }
 
 
@@ -69,17 +297,61 @@ class KaldiServeImpl final : public kaldi_serve::KaldiServe::Service {
   private:
     // Map of Thread-safe Decoder MPMC Queues for diff languages/models
     std::unordered_map<model_id_t, std::unique_ptr<DecoderQueue>, model_id_hash> decoder_queue_map_;
+    // Admission controllers shedding load per model before it piles up in the queues
+    std::unordered_map<model_id_t, std::unique_ptr<AdmissionController>, model_id_hash> admission_map_;
+
+    // Per model metrics of the requests served
+    MetricsRegistry metrics_;
+
+    // Exporter of per-request traces (nullptr if tracing is disabled)
+    TraceExporter *tracer_;
 
     // Tells if a given model name and language code is available for use.
     inline bool is_model_present(const model_id_t &) const noexcept;
 
+    // Acquires a decoder for the model within the call's deadline. Fails fast
+    // with UNAVAILABLE if the model is overloaded (unless `admit` is off, for
+    // requests already admitted), RESOURCE_EXHAUSTED on expiry (and CANCELLED
+    // if the client went away).
+    grpc::Status acquire_decoder(grpc::ServerContext *const, const model_id_t &,
+                                 const RequestPriority &, const std::string &, Decoder *&,
+                                 RequestTrace *const, const bool &admit = true) noexcept;
+
+    // Decoder Release :: records the request's metrics (and the decoder's spans),
+    // frees up the decoder and pushes it back into the queue for the next request.
+    void release_decoder(const model_id_t &, Decoder *const,
+                         const std::chrono::steady_clock::time_point &acquired_at,
+                         RequestTrace *const) noexcept;
+
+    // Starts tracing a request (nullptr if tracing is disabled).
+    inline std::unique_ptr<RequestTrace> start_trace(const grpc::ServerContext *const, const std::string &rpc,
+                                                     const std::string &uuid, const model_id_t &) const;
+
+    // Counts the outcome of a request for the model and exports its trace,
+    // passing its status through.
+    inline grpc::Status request_status(const model_id_t &, std::unique_ptr<RequestTrace> &,
+                                       const grpc::Status &) noexcept;
+
   public:
-    explicit KaldiServeImpl(const std::vector<ModelSpec> &) noexcept;
+    explicit KaldiServeImpl(const std::vector<ModelSpec> &,
+                            const std::vector<TenantSpec> &tenant_specs = {},
+                            TraceExporter *const tracer = nullptr) noexcept;
 
     grpc::Status ListModels(grpc::ServerContext *const,
                             const google::protobuf::Empty *const,
                             kaldi_serve::ModelList *const) override;
 
+    // Live load of the served models: pool sizes, waiting requests,
+    // recent real-time factor and the process' memory
+    grpc::Status GetServerStats(grpc::ServerContext *const,
+                                const google::protobuf::Empty *const,
+                                kaldi_serve::ServerStats *const) override;
+
+    // Metrics of the served models (to be exported)
+    inline const MetricsRegistry &metrics() const noexcept {
+        return metrics_;
+    }
+
     // Non-Streaming Request Handler RPC service
     // Accepts a single `RecognizeRequest` message
     // Returns a single `RecognizeResponse` message
@@ -99,12 +371,23 @@ class KaldiServeImpl final : public kaldi_serve::KaldiServe::Service {
     // Returns a stream of `RecognizeResponse` messages
     grpc::Status BidiStreamingRecognize(grpc::ServerContext *const,
                                         grpc::ServerReaderWriter<kaldi_serve::RecognizeResponse, kaldi_serve::RecognizeRequest>*) override;
+
+    // Batch Request Handler RPC service
+    // Accepts a single `BatchRecognizeRequest` message
+    // Returns a stream of `BatchRecognizeResponse` messages (one per audio, as they finish)
+    grpc::Status BatchRecognize(grpc::ServerContext *const,
+                                const kaldi_serve::BatchRecognizeRequest *const,
+                                grpc::ServerWriter<kaldi_serve::BatchRecognizeResponse> *const) override;
 };
 
-KaldiServeImpl::KaldiServeImpl(const std::vector<ModelSpec> &model_specs) noexcept {
+KaldiServeImpl::KaldiServeImpl(const std::vector<ModelSpec> &model_specs,
+                               const std::vector<TenantSpec> &tenant_specs,
+                               TraceExporter *const tracer) noexcept : tracer_(tracer) {
     for (auto const &model_spec : model_specs) {
         model_id_t model_id = std::make_pair(model_spec.name, model_spec.language_code);
-        decoder_queue_map_[model_id] = std::unique_ptr<DecoderQueue>(new DecoderQueue(model_spec));
+        decoder_queue_map_[model_id] = std::unique_ptr<DecoderQueue>(new DecoderQueue(model_spec, tenant_specs));
+        admission_map_[model_id] = std::unique_ptr<AdmissionController>(new AdmissionController(model_spec));
+        metrics_.add_model(model_id, decoder_queue_map_[model_id].get());
     }
 }
 
@@ -112,6 +395,71 @@ inline bool KaldiServeImpl::is_model_present(const model_id_t &model_id) const n
     return decoder_queue_map_.find(model_id) != decoder_queue_map_.end();
 }
 
+grpc::Status KaldiServeImpl::acquire_decoder(grpc::ServerContext *const context,
+                                             const model_id_t &model_id,
+                                             const RequestPriority &priority,
+                                             const std::string &tenant,
+                                             Decoder *&decoder,
+                                             RequestTrace *const trace,
+                                             const bool &admit) noexcept {
+    ScopedSpan span(trace ? &trace->spans : nullptr, "acquire_decoder");
+
+    // shed the request early rather than letting it wait behind a backlog
+    if (admit) {
+        grpc::Status admission_status = admission_map_[model_id]->admit(*decoder_queue_map_[model_id]);
+        if (!admission_status.ok()) return admission_status;
+    }
+
+    AcquireOptions options;
+    options.deadline = context->deadline();
+    options.is_cancelled = [context]() { return context->IsCancelled(); };
+    options.priority = priority;
+    options.tenant = tenant;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    decoder = decoder_queue_map_[model_id]->acquire(options);
+
+    if (decoder != nullptr) {
+        metrics_.observe_wait(model_id, elapsed_secs(start_time));
+        return grpc::Status::OK;
+    }
+
+    if (context->IsCancelled()) {
+        return grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while waiting for a decoder");
+    }
+    return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                        "No decoder available for model " + model_id.first + " (" + model_id.second + ") before the deadline");
+}
+
+void KaldiServeImpl::release_decoder(const model_id_t &model_id,
+                                     Decoder *const decoder,
+                                     const std::chrono::steady_clock::time_point &acquired_at,
+                                     RequestTrace *const trace) noexcept {
+    admission_map_[model_id]->record(decoder, acquired_at);
+    metrics_.observe_utterance(model_id, decoder->stats());
+    metrics_.observe_decoder_memory(model_id, decoder->memory());
+    if (trace) trace->spans.insert(trace->spans.end(), decoder->spans().begin(), decoder->spans().end());
+
+    decoder->free_decoder();
+    decoder_queue_map_[model_id]->release(decoder);
+}
+
+inline std::unique_ptr<RequestTrace> KaldiServeImpl::start_trace(const grpc::ServerContext *const context,
+                                                                  const std::string &rpc,
+                                                                  const std::string &uuid,
+                                                                  const model_id_t &model_id) const {
+    if (tracer_ == nullptr) return nullptr;
+    return tracer_->start(context, rpc, uuid, model_id);
+}
+
+inline grpc::Status KaldiServeImpl::request_status(const model_id_t &model_id,
+                                                   std::unique_ptr<RequestTrace> &trace,
+                                                   const grpc::Status &status) noexcept {
+    metrics_.count_outcome(model_id, status.error_code());
+    if (trace) tracer_->finish(std::move(trace), status);
+    return status;
+}
+
 grpc::Status KaldiServeImpl::ListModels(grpc::ServerContext *const context,
                                         const google::protobuf::Empty *const request,
                                         kaldi_serve::ModelList *const model_list) {
@@ -127,6 +475,13 @@ grpc::Status KaldiServeImpl::ListModels(grpc::ServerContext *const context,
     return grpc::Status::OK;
 }
 
+grpc::Status KaldiServeImpl::GetServerStats(grpc::ServerContext *const context,
+                                            const google::protobuf::Empty *const request,
+                                            kaldi_serve::ServerStats *const server_stats) {
+    add_server_stats(decoder_queue_map_, admission_map_, server_stats);
+    return grpc::Status::OK;
+}
+
 grpc::Status KaldiServeImpl::Recognize(grpc::ServerContext *const context,
                                        const kaldi_serve::RecognizeRequest *const request,
                                        kaldi_serve::RecognizeResponse *const response) {
@@ -142,62 +497,97 @@ grpc::Status KaldiServeImpl::Recognize(grpc::ServerContext *const context,
         return grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + model_name + " (" + language_code + ") not found");
     }
 
+    std::unique_ptr<RequestTrace> trace = start_trace(context, "Recognize", uuid, model_id);
+
     std::chrono::system_clock::time_point start_time;
     if (DEBUG) start_time = std::chrono::system_clock::now();
 
     // Decoder Acquisition ::
     // - Tries to attain lock and obtain decoder from the queue.
-    // - Waits here until lock on queue is attained.
+    // - Waits here until lock on queue is attained (or the call's deadline expires).
     // - Each new audio stream gets separate decoder object.
-    Decoder *decoder_ = decoder_queue_map_[model_id]->acquire();
+    Decoder *decoder_ = nullptr;
+    grpc::Status acquire_status = acquire_decoder(context, model_id, request_priority(config, RequestPriority::LOW),
+                                                  request_tenant(context, *request), decoder_, trace.get());
+    if (!acquire_status.ok()) return request_status(model_id, trace, acquire_status);
+    const auto acquired_at = std::chrono::steady_clock::now();
+
+    // run the request on the cores of the decoder's NUMA node (if the pool is NUMA-aware)
+    ScopedThreadAffinity affinity(decoder_queue_map_[model_id]->affinity(decoder_));
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-        std::cout << "[" << timestamp_now() << "] uuid: " << uuid << " decoder acquired in: " << ms.count() << "ms" << ENDL;
+        log_debug("uuid: %s decoder acquired in: %lldms", uuid.c_str(), (long long) ms.count());
     }
 
     kaldi_serve::RecognitionAudio audio = request->audio();
     std::stringstream input_stream(audio.content());
 
     if (DEBUG) start_time = std::chrono::system_clock::now();
-    decoder_->start_decoding(uuid);
+    decoder_->start_decoding(uuid, [context]() { return context->IsCancelled(); }, trace != nullptr);
+
+    // a long audio gets split at silences and decoded on spare decoders too
+    const bool segmented = config.parallel_segments() > 1;
+    std::unique_ptr<SegmentHelpers> helpers;
+    if (segmented) {
+        // there's no worker pool here, so the helpers decode on a thread each
+        // (on top of the ones gRPC serves requests on, bounded by the cores)
+        helpers = make_uniq<SegmentHelpers>(decoder_queue_map_[model_id].get(), config.parallel_segments(),
+                                            request_tenant(context, *request));
+    }
+    utterance_results_t k_results_;
 
     // decode speech signals in chunks
     try {
-        if (config.raw()) {
+        if (segmented && config.raw()) {
+            decoder_->decode_segmented_raw_wav_audio(input_stream, sample_rate_hertz, config.data_bytes(),
+                                                     helpers->decoders(), n_best, k_results_, config.word_level());
+        } else if (segmented) {
+            decoder_->decode_segmented_wav_audio(input_stream, helpers->decoders(), n_best, k_results_, config.word_level());
+        } else if (config.raw()) {
             decoder_->decode_raw_wav_audio(input_stream, sample_rate_hertz, config.data_bytes());
         } else {
             decoder_->decode_wav_audio(input_stream);
         }
+    } catch (DecodingCancelledError &e) {
+        decoder_->free_decoder();
+        decoder_queue_map_[model_id]->release(decoder_);
+        return request_status(model_id, trace, grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding"));
     } catch (kaldi::KaldiFatalError &e) {
         decoder_queue_map_[model_id]->release(decoder_);
         std::string message = std::string(e.what()) + " :: " + std::string(e.KaldiMessage());
-        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message);
+        return request_status(model_id, trace, grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message));
     } catch (std::exception &e) {
         decoder_queue_map_[model_id]->release(decoder_);
-        return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+        return request_status(model_id, trace, grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
     }
 
-    utterance_results_t k_results_;
-    decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+    try {
+        // the segmented decoding got the results already
+        if (!segmented) decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+    } catch (DecodingCancelledError &e) {
+        // the client hung up, skip finalizing and lattice processing
+        decoder_->free_decoder();
+        decoder_queue_map_[model_id]->release(decoder_);
+        return request_status(model_id, trace, grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding"));
+    }
 
-    add_alternatives_to_response(k_results_, response, config);
+    add_alternatives_to_response(k_results_, decoder_->stats(), response, config);
 
     // Decoder Release ::
     // - Releases the lock on the decoder and pushes back into queue.
     // - Notifies another request handler thread of availability.
-    decoder_->free_decoder();
-    decoder_queue_map_[model_id]->release(decoder_);
+    release_decoder(model_id, decoder_, acquired_at, trace.get());
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
         // LOG REQUEST RESOLVE TIME --> END
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-        std::cout << "[" << timestamp_now() << "] uuid: " << uuid << " request resolved in: " << ms.count() << "ms" << ENDL;
+        log_debug("uuid: %s request resolved in: %lldms", uuid.c_str(), (long long) ms.count());
     }
 
-    return grpc::Status::OK;
+    return request_status(model_id, trace, grpc::Status::OK);
 }
 
 grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const context,
@@ -220,26 +610,35 @@ grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const conte
         return grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + model_name + " (" + language_code + ") not found");
     }
 
+    std::unique_ptr<RequestTrace> trace = start_trace(context, "StreamingRecognize", uuid, model_id);
+
     std::chrono::system_clock::time_point start_time, start_time_req;
     if (DEBUG) start_time = std::chrono::system_clock::now();
     
     // Decoder Acquisition ::
     // - Tries to attain lock and obtain decoder from the queue.
-    // - Waits here until lock on queue is attained.
+    // - Waits here until lock on queue is attained (or the call's deadline expires).
     // - Each new audio stream gets separate decoder object.
-    Decoder *decoder_ = decoder_queue_map_[model_id]->acquire();
+    Decoder *decoder_ = nullptr;
+    grpc::Status acquire_status = acquire_decoder(context, model_id, request_priority(config, RequestPriority::HIGH),
+                                                  request_tenant(context, request_), decoder_, trace.get());
+    if (!acquire_status.ok()) return request_status(model_id, trace, acquire_status);
+    const auto acquired_at = std::chrono::steady_clock::now();
+
+    // run the request on the cores of the decoder's NUMA node (if the pool is NUMA-aware)
+    ScopedThreadAffinity affinity(decoder_queue_map_[model_id]->affinity(decoder_));
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-        std::cout << "[" << timestamp_now() << "] uuid: " << uuid << " decoder acquired in: " << ms.count() << "ms" << ENDL;
+        log_debug("uuid: %s decoder acquired in: %lldms", uuid.c_str(), (long long) ms.count());
     }
 
     int i = 0;
     int bytes = 0;
 
     if (DEBUG) start_time_req = std::chrono::system_clock::now();
-    decoder_->start_decoding(uuid);
+    decoder_->start_decoding(uuid, [context]() { return context->IsCancelled(); }, trace != nullptr);
 
     // read chunks until end of stream
     do {
@@ -250,19 +649,11 @@ grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const conte
             i++;
             bytes += config.data_bytes();
 
-            std::stringstream debug_msg;
-            debug_msg << "[" 
-                      << timestamp_now() 
-                      << "] uuid: " << uuid 
-                      << " chunk #" << i
-                      << " received";
             if (config.raw()) {
-                debug_msg << " - " << config.data_bytes() 
-                          << " bytes (total " << bytes 
-                          << ")";
+                log_debug("uuid: %s chunk #%d received - %d bytes (total %d)", uuid.c_str(), i, config.data_bytes(), bytes);
+            } else {
+                log_debug("uuid: %s chunk #%d received", uuid.c_str(), i);
             }
-                      
-            std::cout << debug_msg.str() << ENDL;
         }
         config = request_.config();
         kaldi_serve::RecognitionAudio audio = request_.audio();
@@ -276,55 +667,56 @@ grpc::Status KaldiServeImpl::StreamingRecognize(grpc::ServerContext *const conte
             } else {
                 decoder_->decode_stream_wav_chunk(input_stream_chunk);
             }
+        } catch (DecodingCancelledError &e) {
+            decoder_->free_decoder();
+            decoder_queue_map_[model_id]->release(decoder_);
+            return request_status(model_id, trace, grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding"));
         } catch (kaldi::KaldiFatalError &e) {
             decoder_queue_map_[model_id]->release(decoder_);
             std::string message = std::string(e.what()) + " :: " + std::string(e.KaldiMessage());
-            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message);
+            return request_status(model_id, trace, grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message));
         } catch (std::exception &e) {
             decoder_queue_map_[model_id]->release(decoder_);
-            return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+            return request_status(model_id, trace, grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
         }
 
         if (DEBUG) {
             std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
             auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-
-            std::stringstream debug_msg;
-            debug_msg << "[" 
-                      << timestamp_now() 
-                      << "] uuid: " << uuid 
-                      << " chunk #" << i
-                      << " computed in "
-                      << ms.count() << "ms";
-
-            std::cout << debug_msg.str() << ENDL;
+            log_debug("uuid: %s chunk #%d computed in %lldms", uuid.c_str(), i, (long long) ms.count());
         }
     } while (reader->Read(&request_));
 
     if (DEBUG) start_time = std::chrono::system_clock::now();
 
     utterance_results_t k_results_;
-    decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+    try {
+        decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+    } catch (DecodingCancelledError &e) {
+        // the client hung up, skip finalizing and lattice processing
+        decoder_->free_decoder();
+        decoder_queue_map_[model_id]->release(decoder_);
+        return request_status(model_id, trace, grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding"));
+    }
 
-    add_alternatives_to_response(k_results_, response, config);
+    add_alternatives_to_response(k_results_, decoder_->stats(), response, config);
 
     // Decoder Release ::
     // - Releases the lock on the decoder and pushes back into queue.
     // - Notifies another request handler thread of availability.
-    decoder_->free_decoder();
-    decoder_queue_map_[model_id]->release(decoder_);
+    release_decoder(model_id, decoder_, acquired_at, trace.get());
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time_req = std::chrono::system_clock::now();
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_req - start_time);
-        std::cout << "[" << timestamp_now() << "] uuid: " << uuid << " found best paths in " << ms.count() << "ms" << ENDL;
+        log_debug("uuid: %s found best paths in %lldms", uuid.c_str(), (long long) ms.count());
 
         // LOG REQUEST RESOLVE TIME --> END
         auto ms_req = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_req - start_time_req);
-        std::cout << "[" << timestamp_now() << "] uuid: " << uuid << " request resolved in: " << ms_req.count() << "ms" << ENDL;
+        log_debug("uuid: %s request resolved in: %lldms", uuid.c_str(), (long long) ms_req.count());
     }
 
-    return grpc::Status::OK;
+    return request_status(model_id, trace, grpc::Status::OK);
 }
 
 grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const context,
@@ -346,26 +738,38 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
         return grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + model_name + " (" + language_code + ") not found");
     }
 
+    std::unique_ptr<RequestTrace> trace = start_trace(context, "BidiStreamingRecognize", uuid, model_id);
+
     std::chrono::system_clock::time_point start_time, start_time_req;
     if (DEBUG) start_time = std::chrono::system_clock::now();
     
     // Decoder Acquisition ::
     // - Tries to attain lock and obtain decoder from the queue.
-    // - Waits here until lock on queue is attained.
+    // - Waits here until lock on queue is attained (or the call's deadline expires).
     // - Each new audio stream gets separate decoder object.
-    Decoder *decoder_ = decoder_queue_map_[model_id]->acquire();
+    Decoder *decoder_ = nullptr;
+    grpc::Status acquire_status = acquire_decoder(context, model_id, request_priority(config, RequestPriority::HIGH),
+                                                  request_tenant(context, request_), decoder_, trace.get());
+    if (!acquire_status.ok()) return request_status(model_id, trace, acquire_status);
+    const auto acquired_at = std::chrono::steady_clock::now();
+
+    // run the request on the cores of the decoder's NUMA node (if the pool is NUMA-aware)
+    ScopedThreadAffinity affinity(decoder_queue_map_[model_id]->affinity(decoder_));
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-        std::cout << "[" << timestamp_now() << "] uuid: " << uuid << " decoder acquired in: " << ms.count() << "ms" << ENDL;
+        log_debug("uuid: %s decoder acquired in: %lldms", uuid.c_str(), (long long) ms.count());
     }
 
     int i = 0;
     int bytes = 0;
+    InterimResults interim_results;
+    // a continuous stream is cut into segments at endpoints, each with its final result
+    const bool continuous = config.continuous();
 
     if (DEBUG) start_time_req = std::chrono::system_clock::now();
-    decoder_->start_decoding(uuid);
+    decoder_->start_decoding(uuid, [context]() { return context->IsCancelled(); }, trace != nullptr);
 
     // read chunks until end of stream
     do {
@@ -375,19 +779,11 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
             i++;
             bytes += config.data_bytes();
 
-            std::stringstream debug_msg;
-            debug_msg << "[" 
-                      << timestamp_now() 
-                      << "] uuid: " << uuid 
-                      << " chunk #" << i
-                      << " received";
             if (config.raw()) {
-                debug_msg << " - " << config.data_bytes() 
-                          << " bytes (total " << bytes 
-                          << ")";
+                log_debug("uuid: %s chunk #%d received - %d bytes (total %d)", uuid.c_str(), i, config.data_bytes(), bytes);
+            } else {
+                log_debug("uuid: %s chunk #%d received", uuid.c_str(), i);
             }
-                      
-            std::cout << debug_msg.str() << ENDL;
         }
         config = request_.config();
         kaldi_serve::RecognitionAudio audio = request_.audio();
@@ -403,71 +799,187 @@ grpc::Status KaldiServeImpl::BidiStreamingRecognize(grpc::ServerContext *const c
             }
 
             utterance_results_t k_results_;
-            decoder_->get_decoded_results(n_best, k_results_, config.word_level(), true);
-
             kaldi_serve::RecognizeResponse response_;
-            add_alternatives_to_response(k_results_, &response_, config);
 
-            stream->Write(response_);
+            if (continuous && decoder_->endpoint_detected()) {
+                // the segment is over, send its final result and go on with the next one
+                decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+                add_alternatives_to_response(k_results_, decoder_->stats(), &response_, config);
+                decoder_->start_next_segment();
+                interim_results = InterimResults();
+                stream->Write(response_);
+            } else {
+                decoder_->get_decoded_results(n_best, k_results_, config.word_level(), true);
+                add_alternatives_to_response(k_results_, decoder_->stats(), &response_, config, false);
+
+                if (interim_results.update(&response_, config.interim_results_on_change())) {
+                    stream->Write(response_);
+                }
+            }
 
+        } catch (DecodingCancelledError &e) {
+            decoder_->free_decoder();
+            decoder_queue_map_[model_id]->release(decoder_);
+            return request_status(model_id, trace, grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding"));
         } catch (kaldi::KaldiFatalError &e) {
             decoder_queue_map_[model_id]->release(decoder_);
             std::string message = std::string(e.what()) + " :: " + std::string(e.KaldiMessage());
-            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message);
+            return request_status(model_id, trace, grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, message));
         } catch (std::exception &e) {
             decoder_queue_map_[model_id]->release(decoder_);
-            return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+            return request_status(model_id, trace, grpc::Status(grpc::StatusCode::INTERNAL, e.what()));
         }
 
         if (DEBUG) {
             std::chrono::system_clock::time_point end_time = std::chrono::system_clock::now();
             auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-
-            std::stringstream debug_msg;
-            debug_msg << "[" 
-                      << timestamp_now() 
-                      << "] uuid: " << uuid 
-                      << " chunk #" << i
-                      << " computed in "
-                      << ms.count() << "ms";
-
-            std::cout << debug_msg.str() << ENDL;
+            log_debug("uuid: %s chunk #%d computed in %lldms", uuid.c_str(), i, (long long) ms.count());
         }
     } while (stream->Read(&request_));
 
     if (DEBUG) start_time = std::chrono::system_clock::now();
 
     utterance_results_t k_results_;
-    decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+    try {
+        decoder_->get_decoded_results(n_best, k_results_, config.word_level());
+    } catch (DecodingCancelledError &e) {
+        // the client hung up, skip finalizing and lattice processing
+        decoder_->free_decoder();
+        decoder_queue_map_[model_id]->release(decoder_);
+        return request_status(model_id, trace, grpc::Status(grpc::StatusCode::CANCELLED, "Request cancelled while decoding"));
+    }
 
     kaldi_serve::RecognizeResponse response_;
-    add_alternatives_to_response(k_results_, &response_, config);
+    add_alternatives_to_response(k_results_, decoder_->stats(), &response_, config);
 
     stream->Write(response_);
 
     // Decoder Release ::
     // - Releases the lock on the decoder and pushes back into queue.
     // - Notifies another request handler thread of availability.
-    decoder_->free_decoder();
-    decoder_queue_map_[model_id]->release(decoder_);
+    release_decoder(model_id, decoder_, acquired_at, trace.get());
 
     if (DEBUG) {
         std::chrono::system_clock::time_point end_time_req = std::chrono::system_clock::now();
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_req - start_time);
-        std::cout << "[" << timestamp_now() << "] uuid: " << uuid << " found best paths in " << ms.count() << "ms" << ENDL;
+        log_debug("uuid: %s found best paths in %lldms", uuid.c_str(), (long long) ms.count());
 
         // LOG REQUEST RESOLVE TIME --> END
         auto ms_req = std::chrono::duration_cast<std::chrono::milliseconds>(end_time_req - start_time_req);
-        std::cout << "[" << timestamp_now() << "] uuid: " << uuid << " request resolved in: " << ms_req.count() << "ms" << ENDL;
+        log_debug("uuid: %s request resolved in: %lldms", uuid.c_str(), (long long) ms_req.count());
     }
 
-    return grpc::Status::OK;
+    return request_status(model_id, trace, grpc::Status::OK);
+}
+
+grpc::Status KaldiServeImpl::BatchRecognize(grpc::ServerContext *const context,
+                                            const kaldi_serve::BatchRecognizeRequest *const request,
+                                            grpc::ServerWriter<kaldi_serve::BatchRecognizeResponse> *const writer) {
+    const kaldi_serve::RecognitionConfig &config = request->config();
+    const std::string uuid = request->uuid();
+    const model_id_t model_id = std::make_pair(config.model(), config.language_code());
+
+    if (!is_model_present(model_id)) {
+        return grpc::Status(grpc::StatusCode::NOT_FOUND, "Model " + config.model() + " (" + config.language_code() + ") not found");
+    }
+    // the batch is already spread over the model's decoders
+    if (config.parallel_segments() > 1) {
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "parallel_segments is not supported by BatchRecognize");
+    }
+
+    std::unique_ptr<RequestTrace> trace = start_trace(context, "BatchRecognize", uuid, model_id);
+
+    // the batch is admitted (or shed) as a whole
+    DecoderQueue &queue = *decoder_queue_map_[model_id];
+    grpc::Status admission_status = admission_map_[model_id]->admit(queue);
+    if (!admission_status.ok()) return request_status(model_id, trace, admission_status);
+
+    const std::size_t n_audios = request->audios_size();
+    const RequestPriority priority = request_priority(config, RequestPriority::LOW);
+    const std::string tenant = request_tenant(context, *request);
+
+    std::atomic<std::size_t> next_audio(0);
+    // guards the writer and the batch status
+    std::mutex mutex;
+    // guards the trace (taking the decoders' spans), apart from the writer so
+    // that decoders go back to the pool without waiting on a slow client
+    std::mutex trace_mutex;
+    grpc::Status batch_status = grpc::Status::OK;
+
+    // each lane takes the next audio, decodes it on a decoder of its own and
+    // writes back the result, until the audios run out or the batch fails
+    auto run_lane = [&]() {
+        std::size_t index;
+        while ((index = next_audio++) < n_audios) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!batch_status.ok()) return;
+            }
+
+            Decoder *decoder = nullptr;
+            grpc::Status status = acquire_decoder(context, model_id, priority, tenant, decoder, nullptr, false);
+            if (!status.ok()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (batch_status.ok()) batch_status = status;
+                return;
+            }
+            const auto acquired_at = std::chrono::steady_clock::now();
+
+            kaldi_serve::BatchRecognizeResponse response;
+            response.set_index(int32(index));
+            status = recognize_audio(decoder, queue.affinity(decoder), config, request->audios(index),
+                                     uuid + ":" + std::to_string(index), [context]() { return context->IsCancelled(); },
+                                     trace != nullptr, response.mutable_response());
+
+            if (status.error_code() == grpc::StatusCode::CANCELLED) {
+                decoder->free_decoder();
+                queue.release(decoder);
+                std::lock_guard<std::mutex> lock(mutex);
+                if (batch_status.ok()) batch_status = status;
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(trace_mutex);
+                release_decoder(model_id, decoder, acquired_at, trace.get());
+            }
+
+            // a failed audio doesn't fail the batch
+            if (!status.ok()) {
+                response.clear_response();
+                response.set_error_code(int32(status.error_code()));
+                response.set_error_message(status.error_message());
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!writer->Write(response)) {
+                if (batch_status.ok()) batch_status = grpc::Status(grpc::StatusCode::CANCELLED, "Stream closed while writing results");
+                return;
+            }
+        }
+    };
+
+    const std::size_t n_lanes = batch_parallelism(*request, queue);
+    std::vector<std::thread> lanes;
+    for (std::size_t i = 1; i < n_lanes; i++) {
+        lanes.emplace_back(run_lane);
+    }
+    run_lane();
+    for (auto &lane : lanes) lane.join();
+
+    return request_status(model_id, trace, batch_status);
 }
 
 
 // Runs the Server with the Kaldi Service
-void run_server(const std::vector<ModelSpec> &model_specs) {
-    KaldiServeImpl service(model_specs);
+// (exporting metrics over HTTP on `metrics_port` unless it is 0
+// and request traces with `tracer` unless it is nullptr)
+void run_server(const std::vector<ModelSpec> &model_specs,
+                const std::vector<TenantSpec> &tenant_specs = {},
+                const int &metrics_port = 0,
+                TraceExporter *const tracer = nullptr) {
+    KaldiServeImpl service(model_specs, tenant_specs, tracer);
+
+    std::unique_ptr<MetricsServer> metrics_server;
+    if (metrics_port > 0) metrics_server = make_uniq<MetricsServer>(&service.metrics(), metrics_port);
 
     std::string server_address("0.0.0.0:5016");
 
@@ -477,7 +989,7 @@ void run_server(const std::vector<ModelSpec> &model_specs) {
 
     std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
 
-    std::cout << "kaldi-serve gRPC Streaming Server listening on " << server_address << ENDL;
+    log_info("kaldi-serve gRPC Streaming Server listening on %s", server_address.c_str());
     server->Wait();
 }
 
@@ -0,0 +1,344 @@
+// tracing.hpp - Per-Request Tracing & OpenTelemetry Exporter
+#pragma once
+
+// stl includes
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// posix includes
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// lib includes
+#include <kaldiserve/types.hpp>
+#include <kaldiserve/utils.hpp>
+
+// gRPC inludes
+#include <grpcpp/server_context.h>
+
+// local includes
+#include "config.hpp"
+
+using namespace kaldiserve;
+
+
+// max finished traces held for export, newer ones are dropped beyond it
+static const std::size_t MAX_PENDING_TRACES = 10000;
+// time (ms) connecting to, writing to or reading from the collector may take
+static const int COLLECTOR_TIMEOUT_MS = 2000;
+
+
+// A request being traced: a root span for the RPC with the server's and the
+// decoder's stages as child spans, keyed by the request's uuid.
+struct RequestTrace {
+    std::string rpc;
+    std::string uuid;
+    model_id_t model_id;
+
+    // W3C trace context (continues the client's trace if it sent a `traceparent`)
+    std::string trace_id;
+    std::string span_id;
+    std::string parent_span_id;
+
+    std::chrono::system_clock::time_point start_time;
+    std::chrono::system_clock::time_point end_time;
+    grpc::StatusCode status_code = grpc::StatusCode::OK;
+    std::string status_message;
+
+    std::vector<Span> spans;
+};
+
+
+// TraceExporter ::
+// Exports finished request traces as OpenTelemetry (OTLP/JSON) trace data to
+// a file (one export request per line, as read by the collector's
+// `otlpjsonfile` receiver) and/or an OTLP/HTTP collector endpoint. Traces are
+// exported in batches from a thread of its own, off the request path.
+class TraceExporter final {
+
+  public:
+    // `collector` is the `host:port` of an OTLP/HTTP receiver (traces go to /v1/traces)
+    TraceExporter(const std::string &file_path, const std::string &collector) {
+        if (!file_path.empty()) {
+            file_.open(file_path, std::ios::app);
+            if (!file_) throw std::runtime_error("tracing :: could not open " + file_path);
+        }
+        if (!collector.empty()) {
+            auto colon = collector.rfind(':');
+            if (colon == std::string::npos) throw std::runtime_error("tracing :: collector should be host:port");
+            collector_host_ = collector.substr(0, colon);
+            collector_port_ = collector.substr(colon + 1);
+        }
+        thread_ = std::thread(&TraceExporter::run_, this);
+    }
+
+    TraceExporter(const TraceExporter &) = delete; // disable copying
+
+    TraceExporter &operator=(const TraceExporter &) = delete; // disable assignment
+
+    ~TraceExporter() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = true;
+        }
+        cond_.notify_one();
+        thread_.join();
+    }
+
+    // starts tracing a request (continuing the client's trace if any)
+    std::unique_ptr<RequestTrace> start(const grpc::ServerContext *const context,
+                                        const std::string &rpc,
+                                        const std::string &uuid,
+                                        const model_id_t &model_id) const {
+        auto trace = make_uniq<RequestTrace>();
+        trace->rpc = rpc;
+        trace->uuid = uuid;
+        trace->model_id = model_id;
+        trace->start_time = std::chrono::system_clock::now();
+        trace->span_id = random_hex_(8);
+
+        // traceparent: version-trace_id-parent_id-flags
+        const auto &metadata = context->client_metadata();
+        auto it = metadata.find("traceparent");
+        if (it != metadata.end()) {
+            const std::string traceparent(it->second.data(), it->second.size());
+            if (traceparent.size() >= 55 && traceparent[2] == '-' && traceparent[35] == '-' && traceparent[52] == '-') {
+                trace->trace_id = traceparent.substr(3, 32);
+                trace->parent_span_id = traceparent.substr(36, 16);
+            }
+        }
+        if (trace->trace_id.empty()) trace->trace_id = random_hex_(16);
+
+        return trace;
+    }
+
+    // finishes a request's trace with its status and queues it for export
+    void finish(std::unique_ptr<RequestTrace> trace, const grpc::Status &status) {
+        trace->end_time = std::chrono::system_clock::now();
+        trace->status_code = status.error_code();
+        trace->status_message = status.error_message();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_.size() >= MAX_PENDING_TRACES) return;
+            pending_.push_back(std::move(trace));
+        }
+        cond_.notify_one();
+    }
+
+  private:
+    std::ofstream file_;
+    std::string collector_host_;
+    std::string collector_port_;
+    bool collector_ok_ = true;
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<std::unique_ptr<RequestTrace>> pending_;
+    bool stopped_ = false;
+    std::thread thread_;
+
+    void run_() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cond_.wait(lock, [this] { return stopped_ || !pending_.empty(); });
+            if (pending_.empty() && stopped_) break;
+
+            std::deque<std::unique_ptr<RequestTrace>> batch;
+            batch.swap(pending_);
+
+            lock.unlock();
+            const std::string payload = to_otlp_json_(batch);
+            if (file_.is_open()) {
+                file_ << payload << "\n";
+                file_.flush();
+            }
+            if (!collector_host_.empty()) post_(payload);
+            lock.lock();
+        }
+    }
+
+    // ExportTraceServiceRequest (OTLP/JSON) for a batch of traces
+    static std::string to_otlp_json_(const std::deque<std::unique_ptr<RequestTrace>> &traces) {
+        std::ostringstream out;
+        out << "{\"resourceSpans\":[{\"resource\":{\"attributes\":["
+            << string_attribute_("service.name", "kaldi-serve")
+            << "]},\"scopeSpans\":[{\"scope\":{\"name\":\"kaldiserve\"},\"spans\":[";
+
+        bool first = true;
+        for (auto const &trace : traces) {
+            const bool ok = trace->status_code == grpc::StatusCode::OK;
+
+            // root span of the RPC (kind: server)
+            if (!first) out << ",";
+            first = false;
+            out << "{\"traceId\":\"" << trace->trace_id << "\",\"spanId\":\"" << trace->span_id << "\"";
+            if (!trace->parent_span_id.empty()) out << ",\"parentSpanId\":\"" << trace->parent_span_id << "\"";
+            out << ",\"name\":\"kaldi_serve.KaldiServe/" << json_escape_(trace->rpc) << "\",\"kind\":2"
+                << ",\"startTimeUnixNano\":\"" << unix_nanos_(trace->start_time) << "\""
+                << ",\"endTimeUnixNano\":\"" << unix_nanos_(trace->end_time) << "\""
+                << ",\"attributes\":["
+                << string_attribute_("rpc.system", "grpc") << ","
+                << string_attribute_("rpc.method", trace->rpc) << ","
+                << "{\"key\":\"rpc.grpc.status_code\",\"value\":{\"intValue\":\"" << int(trace->status_code) << "\"}},"
+                << string_attribute_("kaldiserve.uuid", trace->uuid) << ","
+                << string_attribute_("kaldiserve.model", trace->model_id.first) << ","
+                << string_attribute_("kaldiserve.language_code", trace->model_id.second)
+                << "],\"status\":{\"code\":" << (ok ? 1 : 2);
+            if (!ok) out << ",\"message\":\"" << json_escape_(trace->status_message) << "\"";
+            out << "}}";
+
+            // stages (kind: internal)
+            for (auto const &span : trace->spans) {
+                out << ",{\"traceId\":\"" << trace->trace_id << "\",\"spanId\":\"" << random_hex_(8) << "\""
+                    << ",\"parentSpanId\":\"" << trace->span_id << "\""
+                    << ",\"name\":\"" << json_escape_(span.name) << "\",\"kind\":1"
+                    << ",\"startTimeUnixNano\":\"" << unix_nanos_(span.start_time) << "\""
+                    << ",\"endTimeUnixNano\":\"" << unix_nanos_(span.end_time) << "\""
+                    << ",\"attributes\":[" << string_attribute_("kaldiserve.uuid", trace->uuid) << "]}";
+            }
+        }
+        out << "]}]}]}";
+        return out.str();
+    }
+
+    // POSTs a payload to the collector's OTLP/HTTP traces endpoint
+    void post_(const std::string &payload) {
+        const std::string request = "POST /v1/traces HTTP/1.1\r\n"
+                                    "Host: " + collector_host_ + ":" + collector_port_ + "\r\n"
+                                    "Content-Type: application/json\r\n"
+                                    "Content-Length: " + std::to_string(payload.size()) + "\r\n"
+                                    "Connection: close\r\n\r\n" + payload;
+
+        bool ok = false;
+        addrinfo hints;
+        std::memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        addrinfo *addresses = nullptr;
+        if (::getaddrinfo(collector_host_.c_str(), collector_port_.c_str(), &hints, &addresses) == 0) {
+            for (addrinfo *address = addresses; address != nullptr && !ok; address = address->ai_next) {
+                const int sock = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+                if (sock < 0) continue;
+
+                if (connect_(sock, address)) {
+                    std::size_t sent = 0;
+                    while (sent < request.size()) {
+                        const ssize_t n = ::send(sock, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+                        if (n <= 0) break;
+                        sent += std::size_t(n);
+                    }
+                    // status line of the response, e.g. "HTTP/1.1 200 OK"
+                    char response[32] = {0};
+                    const ssize_t n = ::recv(sock, response, sizeof(response) - 1, 0);
+                    ok = sent == request.size() && n > 12 && response[9] == '2';
+                }
+                ::close(sock);
+            }
+            ::freeaddrinfo(addresses);
+        }
+
+        // log only when the collector goes down or comes back
+        if (ok != collector_ok_) {
+            if (ok) {
+                log_info("tracing :: exporting to %s:%s", collector_host_.c_str(), collector_port_.c_str());
+            } else {
+                log_warn("tracing :: failed to export to %s:%s", collector_host_.c_str(), collector_port_.c_str());
+            }
+            collector_ok_ = ok;
+        }
+    }
+
+    // connects with a timeout and bounds the socket's later sends and recvs,
+    // so an unreachable or stuck collector only delays the next export
+    static bool connect_(const int &sock, const addrinfo *const address) {
+        const int flags = ::fcntl(sock, F_GETFL, 0);
+        if (flags < 0 || ::fcntl(sock, F_SETFL, flags | O_NONBLOCK) < 0) return false;
+
+        if (::connect(sock, address->ai_addr, address->ai_addrlen) < 0) {
+            if (errno != EINPROGRESS) return false;
+
+            pollfd pending;
+            pending.fd = sock;
+            pending.events = POLLOUT;
+            pending.revents = 0;
+            int error = 0;
+            socklen_t error_len = sizeof(error);
+            if (::poll(&pending, 1, COLLECTOR_TIMEOUT_MS) != 1 ||
+                ::getsockopt(sock, SOL_SOCKET, SO_ERROR, &error, &error_len) < 0 || error != 0) {
+                return false;
+            }
+        }
+        if (::fcntl(sock, F_SETFL, flags) < 0) return false;
+
+        timeval timeout;
+        timeout.tv_sec = COLLECTOR_TIMEOUT_MS / 1000;
+        timeout.tv_usec = (COLLECTOR_TIMEOUT_MS % 1000) * 1000;
+        ::setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        ::setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        return true;
+    }
+
+    static std::string string_attribute_(const std::string &key, const std::string &value) {
+        return "{\"key\":\"" + key + "\",\"value\":{\"stringValue\":\"" + json_escape_(value) + "\"}}";
+    }
+
+    static std::string unix_nanos_(const std::chrono::system_clock::time_point &time) {
+        return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+    }
+
+    static std::string random_hex_(const std::size_t &n_bytes) {
+        static thread_local std::mt19937_64 rng(std::random_device{}());
+        static const char digits[] = "0123456789abcdef";
+
+        std::string hex;
+        uint64_t bits = 0;
+        for (std::size_t i = 0; i < 2 * n_bytes; i++) {
+            if (i % 16 == 0) bits = rng();
+            hex += digits[bits & 0xf];
+            bits >>= 4;
+        }
+        return hex;
+    }
+
+    static std::string json_escape_(const std::string &value) {
+        std::string escaped;
+        for (const char c : value) {
+            switch (c) {
+                case '"': escaped += "\\\""; break;
+                case '\\': escaped += "\\\\"; break;
+                case '\n': escaped += "\\n"; break;
+                case '\r': escaped += "\\r"; break;
+                case '\t': escaped += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char buffer[8];
+                        std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                        escaped += buffer;
+                    } else {
+                        escaped += c;
+                    }
+            }
+        }
+        return escaped;
+    }
+};
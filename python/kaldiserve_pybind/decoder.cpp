@@ -23,8 +23,14 @@ void pybind_decoder(py::module &m) {
     // kaldiserve.Decoder
     py::class_<Decoder>(m, "Decoder", "Decoder class.")
         .def(py::init<ChainModel *const>())
-        .def("start_decoding", &Decoder::start_decoding)
+        .def("start_decoding", [](Decoder &self, const std::string &uuid) {
+            self.start_decoding(uuid);
+        }, py::arg("uuid") = "")
         .def("free_decoder", &Decoder::free_decoder)
+        .def("memory", &Decoder::memory)
+        // continuous streams
+        .def("endpoint_detected", &Decoder::endpoint_detected)
+        .def("start_next_segment", &Decoder::start_next_segment)
         // wav stream chunk
         .def("decode_stream_wav_chunk", [](Decoder &self, py::bytes &wav_bytes) {
             std::string wav_bytes_str(wav_bytes);
@@ -65,6 +71,20 @@ void pybind_decoder(py::module &m) {
             }
         }, py::arg("wav_bytes"), py::arg("samp_freq"),
            py::arg("data_bytes"), py::arg("chunk_size") = 1.0)
+        // long wav audio split at silences and decoded in parallel -> list[Alternative]
+        .def("decode_segmented_wav_audio", [](Decoder &self, py::bytes &wav_bytes, const std::vector<Decoder *> &helpers,
+                                              const int &n_best, const bool &word_level, const float &chunk_size) {
+            std::string wav_bytes_str(wav_bytes);
+            std::vector<Alternative> alts;
+            {
+                py::gil_scoped_release release;
+                std::istringstream wav_stream(wav_bytes_str);
+                self.decode_segmented_wav_audio(wav_stream, helpers, n_best, alts, word_level, chunk_size);
+            }
+            py::list py_alts = py::cast(alts);
+            return py_alts;
+        }, py::arg("wav_bytes"), py::arg("helpers"), py::arg("n_best"),
+           py::arg("word_level") = false, py::arg("chunk_size") = 1.0)
         // get decoding results -> list[Alternative]
         .def("get_decoded_results", [](Decoder &self, const int &n_best,
                                        const bool &word_level, const bool &bidi_streaming) {
@@ -87,8 +107,10 @@ void pybind_decoder(py::module &m) {
     // kaldiserve.DecoderQueue
     py::class_<DecoderQueue>(m, "DecoderQueue", "Decoder Queue class.")
         .def(py::init<const ModelSpec &>())
-        .def("acquire", &DecoderQueue::acquire, py::call_guard<py::gil_scoped_release>(), py::return_value_policy::reference)
-        .def("release", &DecoderQueue::release);//, py::call_guard<py::gil_scoped_release>());
+        .def("acquire", static_cast<Decoder *(DecoderQueue::*)()>(&DecoderQueue::acquire), py::call_guard<py::gil_scoped_release>(), py::return_value_policy::reference)
+        .def("release", &DecoderQueue::release)//, py::call_guard<py::gil_scoped_release>());
+        .def("size", &DecoderQueue::size)
+        .def("model_memory", &DecoderQueue::model_memory);
 }
 
 } // namespace kaldiserve
\ No newline at end of file
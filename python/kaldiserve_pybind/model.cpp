@@ -11,7 +11,8 @@ namespace kaldiserve {
 void pybind_model(py::module &m) {
     // kaldiserve.ChainModel
     py::class_<ChainModel>(m, "ChainModel", "Chain model class.")
-        .def(py::init<const ModelSpec &>());
+        .def(py::init<const ModelSpec &>())
+        .def_readonly("memory", &ChainModel::memory);
 }
 
 } // namespace kaldiserve
\ No newline at end of file
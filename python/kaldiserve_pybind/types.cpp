@@ -22,6 +22,16 @@ void pybind_types(py::module &m) {
         .def_readonly("language_code", &ModelSpec::language_code)
         .def_readonly("path", &ModelSpec::path)
         .def_readonly("n_decoders", &ModelSpec::n_decoders)
+        .def_readonly("min_decoders", &ModelSpec::min_decoders)
+        .def_readonly("max_decoders", &ModelSpec::max_decoders)
+        .def_readonly("decoder_idle_timeout", &ModelSpec::decoder_idle_timeout)
+        .def_readonly("reserved_decoders", &ModelSpec::reserved_decoders)
+        .def_readonly("priority_aging", &ModelSpec::priority_aging)
+        .def_readonly("numa_aware", &ModelSpec::numa_aware)
+        .def_readonly("admission_max_waiting", &ModelSpec::admission_max_waiting)
+        .def_readonly("admission_max_wait", &ModelSpec::admission_max_wait)
+        .def_readonly("admission_max_rtf", &ModelSpec::admission_max_rtf)
+        .def_readonly("admission_max_cpu", &ModelSpec::admission_max_cpu)
         .def_readonly("min_active", &ModelSpec::min_active)
         .def_readonly("max_active", &ModelSpec::max_active)
         .def_readonly("frame_subsampling_factor", &ModelSpec::frame_subsampling_factor)
@@ -29,10 +39,16 @@ void pybind_types(py::module &m) {
         .def_readonly("lattice_beam", &ModelSpec::lattice_beam)
         .def_readonly("acoustic_scale", &ModelSpec::acoustic_scale)
         .def_readonly("silence_weight", &ModelSpec::silence_weight)
+        .def_readonly("silence_phones", &ModelSpec::silence_phones)
+        .def_readonly("max_segment_length", &ModelSpec::max_segment_length)
         .def_readonly("max_ngram_order", &ModelSpec::max_ngram_order)
         .def_readonly("rnnlm_weight", &ModelSpec::rnnlm_weight)
         .def_readonly("bos_index", &ModelSpec::bos_index)
         .def_readonly("eos_index", &ModelSpec::eos_index)
+        .def_readonly("batch_inference", &ModelSpec::batch_inference)
+        .def_readonly("batch_size", &ModelSpec::batch_size)
+        .def_readonly("batch_frames_per_chunk", &ModelSpec::batch_frames_per_chunk)
+        .def_readonly("batch_max_delay_ms", &ModelSpec::batch_max_delay_ms)
         .def("__repr__", [](const ModelSpec &ms) {
             return "<kaldiserve.ModelSpec {name: '" + ms.name +
                    "', language_code: '" + ms.language_code +
@@ -49,6 +65,25 @@ void pybind_types(py::module &m) {
         //               py::arg("silence_weight") = 1.0, py::arg("max_ngram_order") = 3,
         //               py::arg("rnnlm_weight") = 0.5, py::arg("bos_index") = "1", py::arg("eos_index") = "2");
 
+    // kaldiserve.ModelMemory
+    py::class_<ModelMemory>(m, "ModelMemory", "Model Memory struct.")
+        .def(py::init<>())
+        .def_readonly("hclg_bytes", &ModelMemory::hclg_bytes)
+        .def_readonly("am_nnet_bytes", &ModelMemory::am_nnet_bytes)
+        .def_readonly("ivector_extractor_bytes", &ModelMemory::ivector_extractor_bytes)
+        .def_readonly("rnnlm_bytes", &ModelMemory::rnnlm_bytes)
+        .def_readonly("word_embedding_bytes", &ModelMemory::word_embedding_bytes)
+        .def_readonly("lm_fst_bytes", &ModelMemory::lm_fst_bytes)
+        .def_readonly("word_syms_bytes", &ModelMemory::word_syms_bytes)
+        .def("total_bytes", &ModelMemory::total_bytes);
+
+    // kaldiserve.DecoderMemory
+    py::class_<DecoderMemory>(m, "DecoderMemory", "Decoder Memory struct.")
+        .def(py::init<>())
+        .def_readonly("feature_bytes", &DecoderMemory::feature_bytes)
+        .def_readonly("lattice_bytes", &DecoderMemory::lattice_bytes)
+        .def("total_bytes", &DecoderMemory::total_bytes);
+
     py::bind_vector<std::vector<Word>>(m, "_WordList");
 
     // kaldiserve.Word
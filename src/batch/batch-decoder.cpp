@@ -0,0 +1,184 @@
+// batch-decoder.cpp - Batched NNet3 Decodable & Decoder Implementation
+
+// stl includes
+#include <algorithm>
+#include <chrono>
+
+// local includes
+#include "batch.hpp"
+#include "config.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+
+namespace kaldiserve {
+
+DecodableNnetBatchedOnline::DecodableNnetBatchedOnline(const kaldi::TransitionModel &trans_model,
+                                                       NnetBatchScheduler *const scheduler,
+                                                       kaldi::OnlineFeatureInterface *input_features,
+                                                       kaldi::OnlineFeatureInterface *ivector_features,
+                                                       std::vector<Span> *const spans)
+    : trans_model_(trans_model), scheduler_(scheduler),
+      input_features_(input_features), ivector_features_(ivector_features), spans_(spans) {}
+
+kaldi::BaseFloat DecodableNnetBatchedOnline::LogLikelihood(int32 subsampled_frame, int32 index) {
+    if (subsampled_frame >= log_likes_offset_ + log_likes_.NumRows()) {
+        compute_ready_chunks_(subsampled_frame);
+    }
+    KALDI_ASSERT(subsampled_frame >= log_likes_offset_);
+    return log_likes_(subsampled_frame - log_likes_offset_, trans_model_.TransitionIdToPdfFast(index));
+}
+
+bool DecodableNnetBatchedOnline::IsLastFrame(int32 subsampled_frame) const {
+    const int32 features_ready = input_features_->NumFramesReady();
+    if (features_ready == 0) {
+        return subsampled_frame == -1 && input_features_->IsLastFrame(-1);
+    }
+    if (!input_features_->IsLastFrame(features_ready - 1)) {
+        return false;
+    }
+    const int32 sf = scheduler_->frame_subsampling_factor();
+    return subsampled_frame == (features_ready + sf - 1) / sf - 1;
+}
+
+int32 DecodableNnetBatchedOnline::NumFramesReady() const {
+    const int32 features_ready = input_features_->NumFramesReady();
+    if (features_ready == 0) return 0;
+
+    const int32 sf = scheduler_->frame_subsampling_factor();
+
+    // once the input has finished, the last chunk is padded with
+    // copies of the last frame to make up for the right context
+    if (input_features_->IsLastFrame(features_ready - 1)) {
+        return (features_ready + sf - 1) / sf;
+    }
+
+    const int32 frames_per_chunk = scheduler_->frames_per_chunk();
+    const int32 frames_ready = std::max<int32>(0, features_ready - scheduler_->right_context());
+    return (frames_ready / frames_per_chunk) * frames_per_chunk / sf;
+}
+
+void DecodableNnetBatchedOnline::compute_ready_chunks_(int32 subsampled_frame) {
+    const int32 sf = scheduler_->frame_subsampling_factor();
+    const int32 frames_per_chunk = scheduler_->frames_per_chunk();
+    const int32 left_context = scheduler_->left_context();
+    const int32 right_context = scheduler_->right_context();
+    const int32 outputs_per_chunk = frames_per_chunk / sf;
+
+    const int32 num_subsampled_ready = NumFramesReady();
+    KALDI_ASSERT(subsampled_frame < num_subsampled_ready);
+
+    const int32 begin_subsampled = num_chunks_computed_ * outputs_per_chunk;
+    const int32 num_chunks = (num_subsampled_ready - begin_subsampled + outputs_per_chunk - 1) / outputs_per_chunk;
+    KALDI_ASSERT(num_chunks > 0);
+
+    // every task has the same shape irrespective of where it lies in the
+    // utterance, which is what lets the computer batch tasks across decoders
+    const int32 num_input_rows = left_context + (outputs_per_chunk - 1) * sf + right_context + 1;
+    const int32 last_feature_frame = input_features_->NumFramesReady() - 1;
+
+    kaldi::Vector<kaldi::BaseFloat> ivector;
+    if (ivector_features_ != NULL) {
+        // use the most recent i-vector available, like the looped decodable does
+        const int32 end_input_frame = (num_chunks_computed_ + num_chunks) * frames_per_chunk + right_context;
+        const int32 ivector_frame = std::min(ivector_features_->NumFramesReady() - 1, end_input_frame - 1);
+        KALDI_ASSERT(ivector_frame >= 0);
+        ivector.Resize(ivector_features_->Dim());
+        ivector_features_->GetFrame(ivector_frame, &ivector);
+    }
+
+    const double priority = -std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    std::vector<kaldi::nnet3::NnetInferenceTask> tasks(num_chunks);
+    kaldi::Matrix<kaldi::BaseFloat> input(num_input_rows, input_features_->Dim(), kaldi::kUndefined);
+
+    for (int32 c = 0; c < num_chunks; c++) {
+        kaldi::nnet3::NnetInferenceTask &task = tasks[c];
+        const int32 first_output_frame = (num_chunks_computed_ + c) * frames_per_chunk;
+
+        for (int32 r = 0; r < num_input_rows; r++) {
+            int32 t = first_output_frame - left_context + r;
+            t = std::max<int32>(0, std::min(t, last_feature_frame));
+            kaldi::SubVector<kaldi::BaseFloat> row(input, r);
+            input_features_->GetFrame(t, &row);
+        }
+        task.input.Resize(num_input_rows, input.NumCols(), kaldi::kUndefined);
+        task.input.CopyFromMat(input);
+
+        task.first_input_t = -left_context;
+        task.output_t_stride = sf;
+        task.num_output_frames = outputs_per_chunk;
+        task.num_initial_unused_output_frames = 0;
+        task.num_used_output_frames = std::min(outputs_per_chunk, num_subsampled_ready - first_output_frame / sf);
+        task.first_used_output_frame_index = first_output_frame / sf;
+        task.is_edge = false;
+        task.is_irregular = false;
+        task.priority = priority;
+        task.output_to_cpu = true;
+
+        if (ivector.Dim() != 0) {
+            task.ivector.Resize(ivector.Dim(), kaldi::kUndefined);
+            task.ivector.CopyFromVec(ivector);
+        }
+    }
+
+    {
+        ScopedSpan span(spans_, "nnet3_evaluation");
+        scheduler_->compute(tasks);
+    }
+
+    // scatter the task outputs back into a contiguous frame range
+    const int32 num_rows = num_subsampled_ready - begin_subsampled;
+    log_likes_.Resize(num_rows, tasks[0].output_cpu.NumCols(), kaldi::kUndefined);
+    for (int32 c = 0; c < num_chunks; c++) {
+        const kaldi::nnet3::NnetInferenceTask &task = tasks[c];
+        log_likes_.RowRange(c * outputs_per_chunk, task.num_used_output_frames)
+            .CopyFromMat(task.output_cpu.RowRange(0, task.num_used_output_frames));
+    }
+
+    log_likes_offset_ = begin_subsampled;
+    num_chunks_computed_ += num_chunks;
+}
+
+
+BatchedNnet3Decoder::BatchedNnet3Decoder(const kaldi::LatticeFasterDecoderConfig &decoder_opts,
+                                         const kaldi::TransitionModel &trans_model,
+                                         NnetBatchScheduler *const scheduler,
+                                         const fst::Fst<fst::StdArc> &fst,
+                                         kaldi::OnlineNnet2FeaturePipeline *features,
+                                         std::vector<Span> *const spans)
+    : decoder_opts_(decoder_opts), trans_model_(trans_model),
+      decodable_(trans_model, scheduler, features->InputFeature(), features->IvectorFeature(), spans),
+      decoder_(fst, decoder_opts) {}
+
+void BatchedNnet3Decoder::InitDecoding() {
+    decoder_.InitDecoding();
+}
+
+void BatchedNnet3Decoder::AdvanceDecoding() {
+    decoder_.AdvanceDecoding(&decodable_);
+}
+
+void BatchedNnet3Decoder::FinalizeDecoding() {
+    decoder_.FinalizeDecoding();
+}
+
+int32 BatchedNnet3Decoder::NumFramesDecoded() const {
+    return decoder_.NumFramesDecoded();
+}
+
+void BatchedNnet3Decoder::GetLattice(bool end_of_utterance, kaldi::CompactLattice *clat) const {
+    if (NumFramesDecoded() == 0) {
+        KALDI_ERR << "You cannot get a lattice if you decoded no frames.";
+    }
+    kaldi::Lattice raw_lat;
+    decoder_.GetRawLattice(&raw_lat, end_of_utterance);
+
+    if (!decoder_opts_.determinize_lattice) {
+        KALDI_ERR << "--determinize-lattice=false option is not supported at the moment";
+    }
+    fst::DeterminizeLatticePhonePrunedWrapper(trans_model_, &raw_lat, decoder_opts_.lattice_beam,
+                                              clat, decoder_opts_.det_opts);
+}
+
+} // namespace kaldiserve
@@ -0,0 +1,83 @@
+// batch-scheduler.cpp - Batched NNet3 Inference Scheduler Implementation
+
+// stl includes
+#include <algorithm>
+
+// local includes
+#include "batch.hpp"
+#include "config.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+NnetBatchScheduler::NnetBatchScheduler(const ModelSpec &model_spec, const kaldi::nnet3::Nnet &nnet)
+    : max_delay_(model_spec.batch_max_delay_ms) {
+    frame_subsampling_factor_ = model_spec.frame_subsampling_factor;
+
+    // chunks need to produce a whole no. of subsampled output frames
+    const int32 sf = frame_subsampling_factor_;
+    frames_per_chunk_ = std::max(sf, ((model_spec.batch_frames_per_chunk + sf - 1) / sf) * sf);
+
+    kaldi::nnet3::ComputeSimpleNnetContext(nnet, &left_context_, &right_context_);
+
+    kaldi::nnet3::NnetBatchComputerOptions opts;
+    opts.acoustic_scale = model_spec.acoustic_scale;
+    opts.frame_subsampling_factor = frame_subsampling_factor_;
+    opts.frames_per_chunk = frames_per_chunk_;
+    // all our tasks are shaped the same, so edge chunks batch just as well
+    opts.minibatch_size = model_spec.batch_size;
+    opts.edge_minibatch_size = model_spec.batch_size;
+
+    computer_ = make_uniq<kaldi::nnet3::NnetBatchComputer>(opts, nnet, priors_);
+
+    thread_ = std::thread(&NnetBatchScheduler::run_, this);
+}
+
+NnetBatchScheduler::~NnetBatchScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    cond_.notify_one();
+    thread_.join();
+}
+
+void NnetBatchScheduler::compute(std::vector<kaldi::nnet3::NnetInferenceTask> &tasks) {
+    for (auto &task : tasks) {
+        computer_->AcceptTask(&task);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_ = true;
+    }
+    cond_.notify_one();
+
+    // the computer signals each task once its output has been written
+    for (auto &task : tasks) {
+        task.semaphore.Wait();
+    }
+}
+
+void NnetBatchScheduler::run_() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        cond_.wait(lock, [this] { return pending_ || stopped_; });
+        if (stopped_) break;
+
+        // hold a partial minibatch open for a short while so that chunks
+        // from other decoders get a chance to join it
+        cond_.wait_for(lock, max_delay_, [this] {
+            return stopped_ || computer_->NumFullPendingMinibatches() > 0;
+        });
+        pending_ = false;
+
+        lock.unlock();
+        // computes full minibatches first, then whatever is left over
+        while (computer_->Compute(true)) {}
+        lock.lock();
+    }
+}
+
+} // namespace kaldiserve
@@ -5,7 +5,7 @@
 #include <ctime>
 #include <string>
 #include <chrono>
-#include <sstream>
+#include <cstdio>
 
 // local includes
 #include "config.hpp"
@@ -21,11 +21,15 @@ void print_version() {
 std::string timestamp_now() {
     auto now = std::chrono::system_clock::now();
     std::time_t now_time = std::chrono::system_clock::to_time_t(now);
-    std::string now_str = std::string(std::asctime(std::localtime(&now_time)));
     auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
-    std::stringstream time_string;
-    time_string << now_str.substr(0, now_str.size() - 6) << "." << (millis % 1000);
-    return time_string.str();
+
+    // localtime_r & strftime instead of asctime(localtime()), which share static buffers across threads
+    std::tm now_tm;
+    localtime_r(&now_time, &now_tm);
+    char time_string[40];
+    std::size_t n = std::strftime(time_string, sizeof(time_string), "%a %b %e %H:%M:%S", &now_tm);
+    std::snprintf(time_string + n, sizeof(time_string) - n, ".%03d", int(millis % 1000));
+    return time_string;
 }
 
 } // namespace kaldiserve
\ No newline at end of file
@@ -1,24 +1,40 @@
 // decoder-common.cpp - Decoder Common methods Implementation
 
+// stl includes
+#include <algorithm>
+#include <tuple>
+
 // local includes
 #include "config.hpp"
 #include "decoder.hpp"
 #include "types.hpp"
+#include "utils.hpp"
 
 
 namespace kaldiserve {
 
+// length of the frames whose energy is measured to find silences
+static const float SILENCE_FRAME_SECS = 0.01;
+// no. of frames of the stretch a segment is cut in the middle of
+static const std::size_t SILENCE_WINDOW_FRAMES = 20;
+
 void find_alternatives(kaldi::CompactLattice &clat,
                        const std::size_t &n_best,
                        utterance_results_t &results,
                        const bool &word_level,
                        ChainModel *const model,
-                       const DecoderOptions &options) {
+                       const DecoderOptions &options,
+                       DecodingStats *const stats,
+                       std::vector<Span> *const spans) {
     if (clat.NumStates() == 0) {
         KALDI_LOG << "Empty lattice.";
     }
 
+    auto start_time = std::chrono::steady_clock::now();
+
     if (options.enable_rnnlm) {
+        ScopedSpan span(spans, "rnnlm_compose");
+
         // rnnlm.fst
         std::unique_ptr<kaldi::rnnlm::KaldiRnnlmDeterministicFst> lm_to_add_orig = 
             make_uniq<kaldi::rnnlm::KaldiRnnlmDeterministicFst>(model->model_spec.max_ngram_order, *model->rnnlm_info);
@@ -55,6 +71,9 @@ void find_alternatives(kaldi::CompactLattice &clat,
         } else {
             clat = composed_clat;
         }
+
+        if (stats) stats->rescore_secs += elapsed_secs(start_time);
+        start_time = std::chrono::steady_clock::now();
     }
 
     auto lat = make_uniq<kaldi::Lattice>();
@@ -63,11 +82,15 @@ void find_alternatives(kaldi::CompactLattice &clat,
     kaldi::Lattice nbest_lat;
     std::vector<kaldi::Lattice> nbest_lats;
 
-    fst::ShortestPath(*lat, &nbest_lat, n_best);
-    fst::ConvertNbestToVector(nbest_lat, &nbest_lats);
+    {
+        ScopedSpan span(spans, "shortest_path");
+        fst::ShortestPath(*lat, &nbest_lat, n_best);
+        fst::ConvertNbestToVector(nbest_lat, &nbest_lats);
+    }
 
     if (nbest_lats.empty()) {
         KALDI_WARN << "no N-best entries";
+        if (stats) stats->nbest_secs += elapsed_secs(start_time);
         return;
     }
 
@@ -95,8 +118,13 @@ void find_alternatives(kaldi::CompactLattice &clat,
         results.push_back(alt);
     }
 
-    if (!(options.enable_word_level && word_level))
-      return;
+    if (!(options.enable_word_level && word_level)) {
+        if (stats) stats->nbest_secs += elapsed_secs(start_time);
+        return;
+    }
+
+    // word alignment along with the confidences and times from MBR
+    ScopedSpan span(spans, "word_align_lattice");
 
     kaldi::CompactLattice aligned_clat;
     kaldi::BaseFloat max_expand = 0.0;
@@ -161,6 +189,117 @@ void find_alternatives(kaldi::CompactLattice &clat,
     if (!results.empty() and !words.empty()) {
         results[0].words = words;
     }
+
+    if (stats) stats->nbest_secs += elapsed_secs(start_time);
+}
+
+void split_at_silences(const kaldi::VectorBase<kaldi::BaseFloat> &data,
+                       const kaldi::BaseFloat &samp_freq,
+                       const float &max_segment_secs,
+                       std::vector<std::pair<int32, int32>> &segments) {
+    segments.clear();
+    const int32 n_samples = data.Dim();
+    if (n_samples == 0) return;
+
+    if (max_segment_secs <= 0) {
+        segments.emplace_back(0, n_samples);
+        return;
+    }
+    const int32 max_length = std::max(int32(max_segment_secs * samp_freq), 1);
+    const int32 frame_length = std::max(int32(SILENCE_FRAME_SECS * samp_freq), 1);
+
+    // energy of every frame
+    std::vector<double> energies((n_samples + frame_length - 1) / frame_length, 0.0);
+    for (int32 i = 0; i < n_samples; i++) energies[i / frame_length] += double(data(i)) * data(i);
+
+    int32 start = 0;
+    while (n_samples - start > max_length) {
+        // frames within the second half of the segment
+        const std::size_t first = (start + max_length / 2 + frame_length - 1) / frame_length;
+        const std::size_t last = (start + max_length) / frame_length;
+
+        int32 cut = start + max_length;
+        if (last >= first + SILENCE_WINDOW_FRAMES) {
+            // slide a window over them for the quietest stretch
+            double energy = 0;
+            for (std::size_t f = first; f < first + SILENCE_WINDOW_FRAMES; f++) energy += energies[f];
+
+            double min_energy = energy;
+            std::size_t best = first;
+            for (std::size_t f = first + 1; f + SILENCE_WINDOW_FRAMES <= last; f++) {
+                energy += energies[f + SILENCE_WINDOW_FRAMES - 1] - energies[f - 1];
+                if (energy < min_energy) {
+                    min_energy = energy;
+                    best = f;
+                }
+            }
+            cut = int32((best + SILENCE_WINDOW_FRAMES / 2) * frame_length);
+        }
+
+        segments.emplace_back(start, cut);
+        start = cut;
+    }
+    segments.emplace_back(start, n_samples);
+}
+
+void stitch_segment_results(const std::vector<utterance_results_t> &segment_results,
+                            const std::vector<double> &segment_secs,
+                            utterance_results_t &results) {
+    results.clear();
+
+    // joins the alternatives picked for each segment (by index) into one,
+    // with word timings only for the best picks (as only a segment's best
+    // alternative carries words)
+    auto join = [&](const std::vector<std::size_t> &picks, const bool &with_words) {
+        Alternative alternative;
+        alternative.confidence = 0;
+        alternative.am_score = alternative.lm_score = 0;
+
+        std::vector<std::string> transcripts;
+        double total_secs = 0;
+
+        for (std::size_t s = 0; s < segment_results.size(); s++) {
+            // nothing decoded off the segment
+            if (segment_results[s].empty()) continue;
+
+            const Alternative &part = segment_results[s][picks[s]];
+            if (!part.transcript.empty()) transcripts.push_back(part.transcript);
+
+            alternative.am_score += part.am_score;
+            alternative.lm_score += part.lm_score;
+            alternative.confidence += part.confidence * segment_secs[s];
+            total_secs += segment_secs[s];
+            if (with_words) alternative.words.insert(alternative.words.end(), part.words.begin(), part.words.end());
+        }
+        if (total_secs > 0) alternative.confidence /= total_secs;
+        string_join(transcripts, " ", alternative.transcript);
+        return alternative;
+    };
+
+    // the best of every segment first
+    std::vector<std::size_t> best_picks(segment_results.size(), 0);
+    results.push_back(join(best_picks, true));
+
+    // then the best with one segment swapped for one of its alternatives, by
+    // the cost it adds (the n-best lists of the segments are sorted by cost)
+    std::size_t n_alternatives = 0;
+    std::vector<std::tuple<float, std::size_t, std::size_t>> swaps;
+    for (std::size_t s = 0; s < segment_results.size(); s++) {
+        const utterance_results_t &alternatives = segment_results[s];
+        n_alternatives = std::max(n_alternatives, alternatives.size());
+        for (std::size_t a = 1; a < alternatives.size(); a++) {
+            const float extra_cost = (alternatives[a].am_score + alternatives[a].lm_score) -
+                                     (alternatives[0].am_score + alternatives[0].lm_score);
+            swaps.emplace_back(extra_cost, s, a);
+        }
+    }
+    std::sort(swaps.begin(), swaps.end());
+
+    for (std::size_t i = 0; i < swaps.size() && results.size() < n_alternatives; i++) {
+        std::vector<std::size_t> picks = best_picks;
+        picks[std::get<1>(swaps[i])] = std::get<2>(swaps[i]);
+        results.push_back(join(picks, false));
+    }
 }
 
-} // namespace kaldiserve
\ No newline at end of file
+} // namespace kaldiserve
@@ -13,4 +13,8 @@ DecoderFactory::DecoderFactory(const ModelSpec &model_spec) : model_spec(model_s
     model_ = make_uniq<ChainModel>(model_spec);
 }
 
+const ModelMemory &DecoderFactory::model_memory() const noexcept {
+    return model_->memory;
+}
+
 } // namespace kaldiserve
\ No newline at end of file
@@ -1,47 +1,511 @@
 // decoder-queue.cpp - Decoder Queue Implementation
 
+// stl includes
+#include <algorithm>
+#include <sched.h>
+
 // local includes
 #include "config.hpp"
 #include "decoder.hpp"
 #include "types.hpp"
+#include "utils.hpp"
 
 
 namespace kaldiserve {
 
-DecoderQueue::DecoderQueue(const ModelSpec &model_spec) {
-    std::cout << ":: Loading model from " << model_spec.path << ENDL;
+// interval at which waiting threads re-check if their caller has cancelled
+static const std::chrono::milliseconds CANCELLATION_POLL_INTERVAL(50);
+
+DecoderQueue::DecoderQueue(const ModelSpec &model_spec, const std::vector<TenantSpec> &tenant_specs) {
+    log_info("Loading model from %s", model_spec.path.c_str());
+
+    // unset bounds fall back to a fixed pool of `n_decoders`
+    min_decoders_ = model_spec.min_decoders >= 0 ? model_spec.min_decoders : model_spec.n_decoders;
+    max_decoders_ = model_spec.max_decoders > 0 ? model_spec.max_decoders : model_spec.n_decoders;
+    max_decoders_ = std::max(std::max(max_decoders_, min_decoders_), std::size_t(1));
+    idle_timeout_ = std::chrono::milliseconds(int64_t(model_spec.decoder_idle_timeout * 1000));
+
+    const std::size_t reserved = std::min(std::size_t(std::max(model_spec.reserved_decoders, 0)), max_decoders_);
+    max_low_busy_ = max_decoders_ - reserved;
+    priority_aging_ = std::chrono::milliseconds(int64_t(model_spec.priority_aging * 1000));
+
+    // fair-sharing across tenants only kicks in when tenants are configured,
+    // unknown tenant keys (and requests without one) share the "default" tenant
+    for (const auto &tenant_spec : tenant_specs) {
+        if (tenant_ids_.count(tenant_spec.name)) continue;
+        auto tenant = make_uniq<Tenant>();
+        tenant->name = tenant_spec.name;
+        tenant->weight = tenant_spec.weight > 0 ? tenant_spec.weight : 1.0;
+        tenant->max_concurrency = std::size_t(std::max(tenant_spec.max_concurrency, 0));
+        tenant_ids_[tenant->name] = int(tenants_.size());
+        tenants_.push_back(std::move(tenant));
+    }
+    if (!tenants_.empty()) {
+        if (!tenant_ids_.count("default")) {
+            auto tenant = make_uniq<Tenant>();
+            tenant->name = "default";
+            tenant->weight = 1.0;
+            tenant->max_concurrency = 0;
+            tenant_ids_[tenant->name] = int(tenants_.size());
+            tenants_.push_back(std::move(tenant));
+        }
+        default_tenant_ = tenant_ids_["default"];
+    }
+
+    std::vector<std::vector<int>> node_cpus;
+    if (model_spec.numa_aware) numa_node_cpus(node_cpus);
+    // nothing to split on a single node (or unknown topology)
+    if (node_cpus.size() < 2) node_cpus.assign(1, std::vector<int>());
 
-    decoder_factory_ = make_uniq<DecoderFactory>(model_spec);
-    for (size_t i = 0; i < model_spec.n_decoders; i++) {
-        queue_.push(decoder_factory_->produce());
+    nodes_.resize(node_cpus.size());
+    for (std::size_t node = 0; node < nodes_.size(); node++) {
+        nodes_[node].cpus = node_cpus[node];
+        for (auto cpu : node_cpus[node]) {
+            if (cpu >= int(cpu_nodes_.size())) cpu_nodes_.resize(cpu + 1, 0);
+            cpu_nodes_[cpu] = int(node);
+        }
     }
+
+    auto now = std::chrono::steady_clock::now();
+    for (std::size_t node = 0; node < nodes_.size(); node++) {
+        Node &numa_node = nodes_[node];
+
+        // no point in having more shards than cores or decoders
+        std::size_t n_cores = numa_node.cpus.empty() ? std::thread::hardware_concurrency() : numa_node.cpus.size();
+        std::size_t n_node_decoders = (max_decoders_ + nodes_.size() - 1) / nodes_.size();
+        std::size_t n_shards = std::max(std::min(n_cores, n_node_decoders), std::size_t(1));
+        for (std::size_t i = 0; i < n_shards; i++) {
+            numa_node.shards.push_back(shards_.size());
+            shards_.push_back(make_uniq<Shard>());
+        }
+
+        if (nodes_.size() > 1) {
+            log_info("Loading model replica for NUMA node %d", int(node));
+        }
+        {
+            // the model gets first touched (and so allocated) on the node's memory
+            ScopedThreadAffinity affinity(numa_node.cpus);
+            numa_node.decoder_factory = make_uniq<DecoderFactory>(model_spec);
+        }
+
+        // spread the initial decoders evenly across nodes
+        for (std::size_t i = node, j = 0; i < min_decoders_; i += nodes_.size(), j++) {
+            Shard &shard = *shards_[numa_node.shards[j % n_shards]];
+            shard.decoders.push_back(std::make_pair(produce_(int(node)), now));
+        }
+    }
+    n_decoders_ = min_decoders_;
+
+    reaper_ = std::thread(&DecoderQueue::reap_, this);
 }
 
 DecoderQueue::~DecoderQueue() {
-    while (!queue_.empty()) {
-        auto decoder = queue_.front();
-        queue_.pop();
-        delete decoder;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    reaper_cond_.notify_one();
+    if (reaper_.joinable()) reaper_.join();
+
+    // nobody is going to release decoders for the async waiters left anymore
+    for (auto waiter : waiters_) {
+        if (waiter->on_acquired) {
+            waiter->on_acquired(nullptr);
+            delete waiter;
+        }
+    }
+
+    for (auto &shard : shards_) {
+        for (auto &idle : shard->decoders) delete idle.first;
+        shard->decoders.clear();
+    }
+}
+
+std::size_t DecoderQueue::size() {
+    return n_decoders_.load();
+}
+
+std::size_t DecoderQueue::idle() {
+    std::size_t n_idle = 0;
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        n_idle += shard->decoders.size();
+    }
+    return n_idle;
+}
+
+int DecoderQueue::cpu_node_(const int &cpu) const {
+    return cpu >= 0 && cpu < int(cpu_nodes_.size()) ? cpu_nodes_[cpu] : 0;
+}
+
+Decoder *DecoderQueue::try_pop_() {
+    const int cpu = std::max(sched_getcpu(), 0);
+    const std::size_t home = cpu_node_(cpu);
+
+    // decoders of the local node first (remote memory makes for slower decoding)
+    for (std::size_t n = 0; n < nodes_.size(); n++) {
+        const Node &node = nodes_[(home + n) % nodes_.size()];
+        for (std::size_t i = 0; i < node.shards.size(); i++) {
+            Shard &shard = *shards_[node.shards[(cpu + i) % node.shards.size()]];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (!shard.decoders.empty()) {
+                // most recently released decoder first
+                auto item = shard.decoders.back().first;
+                shard.decoders.pop_back();
+                return item;
+            }
+        }
+    }
+    return nullptr;
+}
+
+Decoder *DecoderQueue::produce_(const int &node) {
+    // tagged with its node, so whoever decodes with it can run there
+    Decoder *item = nodes_[node].decoder_factory->produce();
+    item->numa_node_ = node;
+    item->cpus_ = nodes_[node].cpus;
+    return item;
+}
+
+void DecoderQueue::tenant_stats(std::vector<TenantStats> &stats) {
+    stats.clear();
+    for (const auto &tenant : tenants_) {
+        TenantStats tenant_stats;
+        tenant_stats.name = tenant->name;
+        tenant_stats.in_flight = tenant->in_flight.load();
+        tenant_stats.waiting = tenant->waiting.load();
+        tenant_stats.acquired = tenant->acquired.load();
+        tenant_stats.timed_out = tenant->timed_out.load();
+        tenant_stats.cancelled = tenant->cancelled.load();
+        stats.push_back(tenant_stats);
+    }
+}
+
+ModelMemory DecoderQueue::model_memory() const {
+    ModelMemory memory;
+    for (const auto &node : nodes_) {
+        const ModelMemory &replica = node.decoder_factory->model_memory();
+        memory.hclg_bytes += replica.hclg_bytes;
+        memory.am_nnet_bytes += replica.am_nnet_bytes;
+        memory.ivector_extractor_bytes += replica.ivector_extractor_bytes;
+        memory.rnnlm_bytes += replica.rnnlm_bytes;
+        memory.word_embedding_bytes += replica.word_embedding_bytes;
+        memory.lm_fst_bytes += replica.lm_fst_bytes;
+        memory.word_syms_bytes += replica.word_syms_bytes;
+    }
+    return memory;
+}
+
+int DecoderQueue::tenant_index_(const std::string &tenant) const {
+    if (tenants_.empty()) return -1;
+    auto it = tenant_ids_.find(tenant);
+    return it != tenant_ids_.end() ? it->second : default_tenant_;
+}
+
+bool DecoderQueue::try_reserve_low_() {
+    std::size_t n = n_low_busy_.load();
+    while (n < max_low_busy_) {
+        if (n_low_busy_.compare_exchange_weak(n, n + 1)) return true;
+    }
+    return false;
+}
+
+bool DecoderQueue::try_reserve_tenant_(const int &tenant) {
+    Tenant &state = *tenants_[tenant];
+    std::size_t n = state.in_flight.load();
+    while (state.max_concurrency == 0 || n < state.max_concurrency) {
+        if (state.in_flight.compare_exchange_weak(n, n + 1)) return true;
+    }
+    return false;
+}
+
+bool DecoderQueue::try_grow_() {
+    std::size_t n = n_decoders_.load();
+    while (n < max_decoders_) {
+        if (n_decoders_.compare_exchange_weak(n, n + 1)) return true;
+    }
+    return false;
+}
+
+Decoder *DecoderQueue::take_(const RequestPriority &priority, const int &tenant) {
+    const bool low = priority == RequestPriority::LOW;
+    if (low && !try_reserve_low_()) return nullptr;
+    if (tenant >= 0 && !try_reserve_tenant_(tenant)) {
+        if (low) n_low_busy_--;
+        return nullptr;
+    }
+
+    Decoder *item = try_pop_();
+    if (item == nullptr && try_grow_()) item = produce_(cpu_node_(sched_getcpu()));
+
+    if (item == nullptr) {
+        if (low) n_low_busy_--;
+        if (tenant >= 0) tenants_[tenant]->in_flight--;
+        return nullptr;
     }
+
+    item->low_priority_slot_ = low;
+    item->tenant_ = tenant;
+    if (tenant >= 0) tenants_[tenant]->acquired++;
+    return item;
 }
 
 void DecoderQueue::push_(Decoder *const item) {
+    if (item->low_priority_slot_) {
+        item->low_priority_slot_ = false;
+        n_low_busy_--;
+    }
+    if (item->tenant_ >= 0) {
+        tenants_[item->tenant_]->in_flight--;
+        item->tenant_ = -1;
+    }
+    {
+        // back onto the decoder's own node, in the shard of the releasing core
+        const Node &node = nodes_[item->numa_node_];
+        const int cpu = std::max(sched_getcpu(), 0);
+        Shard &shard = *shards_[node.shards[cpu % node.shards.size()]];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.decoders.push_back(std::make_pair(item, std::chrono::steady_clock::now()));
+    }
+    // pairs with the fence in `pop_`: either we see the waiter or it sees our decoder
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // only pay for the shared lock when someone is actually waiting
+    if (n_waiters_.load() > 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dispatch_();
+    }
+}
+
+DecoderQueue::Waiter *DecoderQueue::select_waiter_(const std::chrono::system_clock::time_point &now) {
+    Waiter *best = nullptr;
+    double best_share = 0;
+
+    for (auto waiter : waiters_) {
+        // aging: long waiting low priority requests compete as high priority
+        // ones (and may use the reserved decoders) so they don't starve
+        if (waiter->priority == RequestPriority::LOW && priority_aging_.count() > 0 && now >= waiter->promote_time) {
+            waiter->priority = RequestPriority::HIGH;
+        }
+
+        if (waiter->is_cancelled != nullptr && (*waiter->is_cancelled)()) continue;
+        if (waiter->priority == RequestPriority::LOW && n_low_busy_.load() >= max_low_busy_) continue;
+
+        double share = 0;
+        if (waiter->tenant >= 0) {
+            const Tenant &tenant = *tenants_[waiter->tenant];
+            if (tenant.max_concurrency > 0 && tenant.in_flight.load() >= tenant.max_concurrency) continue;
+            share = tenant.in_flight.load() / tenant.weight;
+        }
+
+        // higher class first, then the tenant furthest below its share, then arrival order
+        if (best == nullptr || waiter->priority > best->priority ||
+            (waiter->priority == best->priority && share < best_share)) {
+            best = waiter;
+            best_share = share;
+        }
+    }
+    return best;
+}
+
+void DecoderQueue::dispatch_() {
+    while (!waiters_.empty()) {
+        Waiter *waiter = select_waiter_(std::chrono::system_clock::now());
+        if (waiter == nullptr) return;
+
+        Decoder *item = take_(waiter->priority, waiter->tenant);
+        if (item == nullptr) return;
+
+        waiters_.remove(waiter);
+        n_waiters_--;
+        if (waiter->tenant >= 0) tenants_[waiter->tenant]->waiting--;
+
+        waiter->granted = item;
+        if (waiter->on_acquired) {
+            n_async_waiters_--;
+            waiter->on_acquired(item);
+            delete waiter;
+        } else {
+            waiter->cond.notify_one();
+        }
+    }
+}
+
+void DecoderQueue::expire_async_waiters_() {
+    const auto now = std::chrono::system_clock::now();
+
+    for (auto it = waiters_.begin(); it != waiters_.end();) {
+        Waiter *waiter = *it;
+        if (!waiter->on_acquired) {
+            ++it;
+            continue;
+        }
+
+        const bool cancelled = waiter->is_cancelled != nullptr && (*waiter->is_cancelled)();
+        if (!cancelled && now < waiter->deadline) {
+            ++it;
+            continue;
+        }
+
+        it = waiters_.erase(it);
+        n_waiters_--;
+        n_async_waiters_--;
+        if (waiter->tenant >= 0) {
+            tenants_[waiter->tenant]->waiting--;
+            if (cancelled) tenants_[waiter->tenant]->cancelled++;
+            else tenants_[waiter->tenant]->timed_out++;
+        }
+
+        waiter->on_acquired(nullptr);
+        delete waiter;
+    }
+}
+
+Decoder *DecoderQueue::try_acquire(const RequestPriority &priority, const std::string &tenant) {
+    // the fast path of `pop_` alone
+    if (n_waiters_.load() != 0) return nullptr;
+    return take_(priority, tenant_index_(tenant));
+}
+
+void DecoderQueue::acquire_async(const AcquireOptions &options, std::function<void(Decoder *)> on_acquired) {
+    const int tenant = tenant_index_(options.tenant);
+
+    // fast path: no waiters to overtake and a decoder (or room for one) is at hand
+    if (n_waiters_.load() == 0) {
+        Decoder *item = take_(options.priority, tenant);
+        if (item != nullptr) {
+            on_acquired(item);
+            return;
+        }
+    }
+
+    Waiter *waiter = new Waiter();
+    waiter->priority = options.priority;
+    waiter->tenant = tenant;
+    waiter->promote_time = std::chrono::system_clock::now() + priority_aging_;
+    waiter->deadline = options.deadline;
+    waiter->is_cancelled_fn = options.is_cancelled;
+    waiter->is_cancelled = waiter->is_cancelled_fn ? &waiter->is_cancelled_fn : nullptr;
+    waiter->on_acquired = std::move(on_acquired);
+
+    // same registration protocol as the blocking slow path in `pop_`
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        waiters_.push_back(waiter);
+        n_waiters_++;
+        n_async_waiters_++;
+        if (tenant >= 0) tenants_[tenant]->waiting++;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        dispatch_();
+    }
+    // start polling the waiter for expiry
+    reaper_cond_.notify_one();
+}
+
+Decoder *DecoderQueue::pop_(const AcquireOptions &options) {
+    const int tenant = tenant_index_(options.tenant);
+
+    // fast path: no waiters to overtake and a decoder (or room for one) is at hand
+    if (n_waiters_.load() == 0) {
+        Decoder *item = take_(options.priority, tenant);
+        if (item != nullptr) return item;
+    }
+
+    const bool has_deadline = options.deadline != std::chrono::system_clock::time_point::max();
+    const auto &is_cancelled = options.is_cancelled;
+
+    Waiter waiter;
+    waiter.priority = options.priority;
+    waiter.tenant = tenant;
+    waiter.promote_time = std::chrono::system_clock::now() + priority_aging_;
+    waiter.is_cancelled = is_cancelled ? &is_cancelled : nullptr;
+
+    // slow path: the waiter is registered before dispatching (under the lock)
+    // so that a concurrent `push_` either sees the waiter or has its decoder
+    // found by our own dispatch
     std::unique_lock<std::mutex> mlock(mutex_);
-    queue_.push(item);
-    mlock.unlock();
-    cond_.notify_one(); // condition var notifies another suspended thread (help up in `pop`)
+    waiters_.push_back(&waiter);
+    n_waiters_++;
+    if (tenant >= 0) tenants_[tenant]->waiting++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    dispatch_();
+
+    // waits until a decoder object is handed over
+    while (waiter.granted == nullptr) {
+        auto now = std::chrono::system_clock::now();
+        const bool cancelled = is_cancelled && is_cancelled();
+
+        if (cancelled || (has_deadline && now >= options.deadline)) {
+            waiters_.remove(&waiter);
+            n_waiters_--;
+            if (tenant >= 0) {
+                tenants_[tenant]->waiting--;
+                if (cancelled) tenants_[tenant]->cancelled++;
+                else tenants_[tenant]->timed_out++;
+            }
+            return nullptr;
+        }
+
+        // wake up at the deadline, for aging and periodically to find out about cancellations
+        auto wake_time = options.deadline;
+        if (waiter.priority == RequestPriority::LOW && priority_aging_.count() > 0) {
+            wake_time = std::min(wake_time, waiter.promote_time);
+        }
+        if (is_cancelled && wake_time - now > CANCELLATION_POLL_INTERVAL) {
+            wake_time = now + CANCELLATION_POLL_INTERVAL;
+        }
+
+        if (wake_time == std::chrono::system_clock::time_point::max()) {
+            // suspends current thread execution and awaits condition notification
+            waiter.cond.wait(mlock);
+        } else {
+            waiter.cond.wait_until(mlock, wake_time);
+        }
+
+        // aging or cancelled waiters might have made room for us
+        if (waiter.granted == nullptr) dispatch_();
+    }
+    return waiter.granted;
 }
 
-Decoder *DecoderQueue::pop_() {
+void DecoderQueue::reap_() {
     std::unique_lock<std::mutex> mlock(mutex_);
-    // waits until a decoder object is available
-    while (queue_.empty()) {
-        // suspends current thread execution and awaits condition notification
-        cond_.wait(mlock);
+
+    while (!stopped_) {
+        if (n_async_waiters_ > 0) {
+            reaper_cond_.wait_for(mlock, CANCELLATION_POLL_INTERVAL);
+        } else {
+            reaper_cond_.wait_for(mlock, std::max(idle_timeout_ / 2, std::chrono::milliseconds(100)));
+        }
+        if (stopped_) break;
+
+        if (n_async_waiters_ > 0) {
+            expire_async_waiters_();
+            // aging may have made some of them eligible
+            dispatch_();
+        }
+
+        // nothing to reap in a fixed size pool
+        if (max_decoders_ == min_decoders_) continue;
+        mlock.unlock();
+
+        // least recently released decoders sit at the front of each shard;
+        // the reaper is the only one shrinking the pool so check-then-decrement is safe
+        std::vector<Decoder*> idle_decoders;
+        auto now = std::chrono::steady_clock::now();
+        for (auto &shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            while (!shard->decoders.empty() && n_decoders_.load() > min_decoders_ &&
+                   now - shard->decoders.front().second >= idle_timeout_) {
+                idle_decoders.push_back(shard->decoders.front().first);
+                shard->decoders.pop_front();
+                n_decoders_--;
+            }
+        }
+        for (auto decoder : idle_decoders) delete decoder;
+
+        mlock.lock();
     }
-    auto item = queue_.front();
-    queue_.pop();
-    return item;
 }
 
-} // namespace kaldiserve
\ No newline at end of file
+} // namespace kaldiserve
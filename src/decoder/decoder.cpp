@@ -4,10 +4,23 @@
 #include "config.hpp"
 #include "decoder.hpp"
 #include "types.hpp"
+#include "utils.hpp"
 
 
 namespace kaldiserve {
 
+// bytes of a compact lattice's states, arcs and their transition id strings
+static std::size_t compact_lattice_bytes(const kaldi::CompactLattice &clat) {
+    std::size_t n_bytes = 0;
+    for (fst::StateIterator<kaldi::CompactLattice> siter(clat); !siter.Done(); siter.Next()) {
+        n_bytes += sizeof(fst::VectorState<kaldi::CompactLatticeArc>) + sizeof(void *);
+        for (fst::ArcIterator<kaldi::CompactLattice> aiter(clat, siter.Value()); !aiter.Done(); aiter.Next()) {
+            n_bytes += sizeof(kaldi::CompactLatticeArc) + aiter.Value().weight.String().size() * sizeof(int32);
+        }
+    }
+    return n_bytes;
+}
+
 Decoder::Decoder(ChainModel *const model) : model_(model) {
 
     if (model_->wb_info != nullptr) options.enable_word_level = true;
@@ -15,6 +28,7 @@ Decoder::Decoder(ChainModel *const model) : model_(model) {
 
     // decoder vars initialization
     decoder_ = NULL;
+    batched_decoder_ = NULL;
     feature_pipeline_ = NULL;
     silence_weighting_ = NULL;
     adaptation_state_ = NULL;
@@ -24,49 +38,85 @@ Decoder::~Decoder() noexcept {
     free_decoder();
 }
 
-void Decoder::start_decoding(const std::string &uuid) noexcept {
+void Decoder::start_decoding(const std::string &uuid,
+                             const std::function<bool()> &is_cancelled,
+                             const bool &tracing) noexcept {
     free_decoder();
 
+    tracing_ = tracing;
+    spans_.clear();
+
     adaptation_state_ = new kaldi::OnlineIvectorExtractorAdaptationState(model_->feature_info->ivector_extractor_info);
+    _init_segment();
 
+    uuid_ = uuid;
+    is_cancelled_ = is_cancelled;
+    stats_ = DecodingStats();
+    lattice_bytes_ = 0;
+    segment_start_secs_ = 0;
+}
+
+void Decoder::_init_segment() {
     feature_pipeline_ = new kaldi::OnlineNnet2FeaturePipeline(*model_->feature_info);
     feature_pipeline_->SetAdaptationState(*adaptation_state_);
 
-    decoder_ = new kaldi::SingleUtteranceNnet3Decoder(model_->lattice_faster_decoder_config,
-                                                      model_->trans_model, *model_->decodable_info,
-                                                      *model_->decode_fst, feature_pipeline_);
-    decoder_->InitDecoding();
+    if (model_->batch_scheduler != nullptr) {
+        batched_decoder_ = new BatchedNnet3Decoder(model_->lattice_faster_decoder_config,
+                                                   model_->trans_model, model_->batch_scheduler.get(),
+                                                   *model_->decode_fst, feature_pipeline_, _trace());
+        batched_decoder_->InitDecoding();
+    } else {
+        decoder_ = new kaldi::SingleUtteranceNnet3Decoder(model_->lattice_faster_decoder_config,
+                                                          model_->trans_model, *model_->decodable_info,
+                                                          *model_->decode_fst, feature_pipeline_);
+        decoder_->InitDecoding();
+    }
 
     silence_weighting_ = new kaldi::OnlineSilenceWeighting(model_->trans_model,
                                                            model_->feature_info->silence_weighting_config,
                                                            model_->decodable_opts.frame_subsampling_factor);
+}
 
-    uuid_ = uuid;
+bool Decoder::endpoint_detected() {
+    if (_num_frames_decoded() == 0) return false;
+
+    const kaldi::BaseFloat frame_shift = model_->feature_info->FrameShiftInSeconds() *
+                                         model_->decodable_opts.frame_subsampling_factor;
+    // kaldi's rules measure trailing silence (and assert there are silence
+    // phones to measure it by), so without them only the max length rule applies
+    if (model_->endpoint_config.silence_phones.empty()) {
+        return _num_frames_decoded() * frame_shift > model_->endpoint_config.rule5.max_utterance_length;
+    }
+    return kaldi::EndpointDetected(model_->endpoint_config, model_->trans_model, frame_shift, _search_decoder());
+}
+
+void Decoder::start_next_segment() {
+    // the speaker adaptation carries over, the features and search state don't
+    feature_pipeline_->GetAdaptationState(adaptation_state_);
+
+    _free_segment();
+    _init_segment();
+    segment_start_secs_ = stats_.audio_secs;
+    lattice_bytes_ = 0;
 }
 
 void Decoder::free_decoder() noexcept {
-    if (decoder_) {
-        delete decoder_;
-        decoder_ = NULL;
-    }
+    _free_segment();
     if (adaptation_state_) {
         delete adaptation_state_;
         adaptation_state_ = NULL;
     }
-    if (feature_pipeline_) {
-        delete feature_pipeline_; 
-        feature_pipeline_ = NULL;
-    }
-    if (silence_weighting_) {
-        delete silence_weighting_;
-        silence_weighting_ = NULL;
-    }
     uuid_ = "";
+    is_cancelled_ = nullptr;
 }
 
 void Decoder::decode_stream_wav_chunk(std::istream &wav_stream) {
+    ScopedCpuTimer cpu_timer(&stats_.cpu_secs);
     kaldi::WaveData wave_data;
-    wave_data.Read(wav_stream);
+    {
+        ScopedSpan span(_trace(), "wav_parse");
+        wave_data.Read(wav_stream);
+    }
 
     const kaldi::BaseFloat samp_freq = wave_data.SampFreq();
 
@@ -80,8 +130,12 @@ void Decoder::decode_stream_wav_chunk(std::istream &wav_stream) {
 void Decoder::decode_stream_raw_wav_chunk(std::istream &wav_stream,
                                           const float& samp_freq,
                                           const int &data_bytes) {
+    ScopedCpuTimer cpu_timer(&stats_.cpu_secs);
     kaldi::Matrix<kaldi::BaseFloat> wave_matrix;    
-    read_raw_wav_stream(wav_stream, data_bytes, wave_matrix);
+    {
+        ScopedSpan span(_trace(), "wav_parse");
+        read_raw_wav_stream(wav_stream, data_bytes, wave_matrix);
+    }
 
     // get the data for channel zero (if the signal is not mono, we only
     // take the first channel).
@@ -93,48 +147,172 @@ void Decoder::decode_stream_raw_wav_chunk(std::istream &wav_stream,
 
 void Decoder::decode_wav_audio(std::istream &wav_stream,
                                const float &chunk_size) {
+    ScopedCpuTimer cpu_timer(&stats_.cpu_secs);
     kaldi::WaveData wave_data;
-    wave_data.Read(wav_stream);
+    {
+        ScopedSpan span(_trace(), "wav_parse");
+        wave_data.Read(wav_stream);
+    }
 
     // get the data for channel zero (if the signal is not mono, we only
     // take the first channel).
     kaldi::SubVector<kaldi::BaseFloat> data(wave_data.Data(), 0);
     const kaldi::BaseFloat samp_freq = wave_data.SampFreq();
+    _decode_chunked(data, samp_freq, chunk_size);
+}
 
-    int32 chunk_length;
-    if (chunk_size > 0) {
-        chunk_length = int32(samp_freq * chunk_size);
-        if (chunk_length == 0)
-            chunk_length = 1;
-    } else {
-        chunk_length = std::numeric_limits<int32>::max();
+void Decoder::decode_raw_wav_audio(std::istream &wav_stream,
+                                   const float &samp_freq,
+                                   const int &data_bytes,
+                                   const float &chunk_size) {
+    ScopedCpuTimer cpu_timer(&stats_.cpu_secs);
+    kaldi::Matrix<kaldi::BaseFloat> wave_matrix;
+    {
+        ScopedSpan span(_trace(), "wav_parse");
+        read_raw_wav_stream(wav_stream, data_bytes, wave_matrix);
     }
 
-    int32 samp_offset = 0;
-    std::vector<std::pair<int32, kaldi::BaseFloat>> delta_weights;
-
-    while (samp_offset < data.Dim()) {
-        int32 samp_remaining = data.Dim() - samp_offset;
-        int32 num_samp = chunk_length < samp_remaining ? chunk_length : samp_remaining;
-
-        kaldi::SubVector<kaldi::BaseFloat> wave_part(data, samp_offset, num_samp);
-        _decode_wave(wave_part, delta_weights, samp_freq);
+    // get the data for channel zero (if the signal is not mono, we only
+    // take the first channel).
+    kaldi::SubVector<kaldi::BaseFloat> data(wave_matrix, 0);
+    _decode_chunked(data, samp_freq, chunk_size);
+}
 
-        samp_offset += num_samp;
+void Decoder::decode_segmented_wav_audio(std::istream &wav_stream,
+                                         const std::vector<Decoder *> &helpers,
+                                         const int &n_best,
+                                         utterance_results_t &results,
+                                         const bool &word_level,
+                                         const float &chunk_size,
+                                         const task_executor_t &executor) {
+    kaldi::WaveData wave_data;
+    {
+        ScopedCpuTimer cpu_timer(&stats_.cpu_secs);
+        ScopedSpan span(_trace(), "wav_parse");
+        wave_data.Read(wav_stream);
     }
+
+    // get the data for channel zero (if the signal is not mono, we only
+    // take the first channel).
+    kaldi::SubVector<kaldi::BaseFloat> data(wave_data.Data(), 0);
+    _decode_segmented(data, wave_data.SampFreq(), helpers, n_best, results, word_level, chunk_size, executor);
 }
 
-void Decoder::decode_raw_wav_audio(std::istream &wav_stream,
-                                   const float &samp_freq,
-                                   const int &data_bytes,
-                                   const float &chunk_size) {
+void Decoder::decode_segmented_raw_wav_audio(std::istream &wav_stream,
+                                             const float &samp_freq,
+                                             const int &data_bytes,
+                                             const std::vector<Decoder *> &helpers,
+                                             const int &n_best,
+                                             utterance_results_t &results,
+                                             const bool &word_level,
+                                             const float &chunk_size,
+                                             const task_executor_t &executor) {
     kaldi::Matrix<kaldi::BaseFloat> wave_matrix;
-    read_raw_wav_stream(wav_stream, data_bytes, wave_matrix);
+    {
+        ScopedCpuTimer cpu_timer(&stats_.cpu_secs);
+        ScopedSpan span(_trace(), "wav_parse");
+        read_raw_wav_stream(wav_stream, data_bytes, wave_matrix);
+    }
 
     // get the data for channel zero (if the signal is not mono, we only
     // take the first channel).
     kaldi::SubVector<kaldi::BaseFloat> data(wave_matrix, 0);
+    _decode_segmented(data, samp_freq, helpers, n_best, results, word_level, chunk_size, executor);
+}
 
+void Decoder::get_decoded_results(const int &n_best,
+                                  utterance_results_t &results,
+                                  const bool &word_level,
+                                  const bool &bidi_streaming) {
+    ScopedCpuTimer cpu_timer(&stats_.cpu_secs);
+    // no point in finalizing and processing the lattice for nobody
+    _check_cancelled();
+
+    if (!bidi_streaming) {
+        const auto start_time = std::chrono::steady_clock::now();
+        feature_pipeline_->InputFinished();
+        {
+            ScopedSpan span(_trace(), "advance_decoding");
+            _advance_decoding();
+        }
+        {
+            ScopedSpan span(_trace(), "finalize_decoding");
+            _finalize_decoding();
+        }
+        stats_.finalize_secs += elapsed_secs(start_time);
+    }
+
+    if (_num_frames_decoded() == 0) {
+        KALDI_WARN << "audio may be empty :: decoded no frames";
+        return;
+    }
+
+    _check_cancelled();
+
+    kaldi::CompactLattice clat;
+    try {
+        const auto start_time = std::chrono::steady_clock::now();
+        {
+            ScopedSpan span(_trace(), "get_lattice");
+            _get_lattice(clat);
+        }
+        stats_.lattice_secs += elapsed_secs(start_time);
+        lattice_bytes_ = compact_lattice_bytes(clat);
+
+        find_alternatives(clat, n_best, results, word_level, model_, options, &stats_, _trace());
+
+        // shift the word timings of later segments to the stream's timeline
+        if (segment_start_secs_ > 0) {
+            for (auto &alternative : results) {
+                for (auto &word : alternative.words) {
+                    word.start_time += segment_start_secs_;
+                    word.end_time += segment_start_secs_;
+                }
+            }
+        }
+    } catch (std::exception &e) {
+        KALDI_ERR << "unexpected error during decoding lattice :: " << e.what(); 
+    }
+}
+
+DecoderMemory Decoder::memory() const {
+    DecoderMemory memory;
+    if (feature_pipeline_) {
+        memory.feature_bytes = std::size_t(feature_pipeline_->NumFramesReady()) *
+                               feature_pipeline_->Dim() * sizeof(kaldi::BaseFloat);
+    }
+    memory.lattice_bytes = lattice_bytes_;
+    return memory;
+}
+
+void Decoder::_check_cancelled() const {
+    if (is_cancelled_ && is_cancelled_()) {
+        throw DecodingCancelledError();
+    }
+}
+
+void Decoder::_free_segment() noexcept {
+    if (decoder_) {
+        delete decoder_;
+        decoder_ = NULL;
+    }
+    if (batched_decoder_) {
+        delete batched_decoder_;
+        batched_decoder_ = NULL;
+    }
+    if (feature_pipeline_) {
+        delete feature_pipeline_;
+        feature_pipeline_ = NULL;
+    }
+    if (silence_weighting_) {
+        delete silence_weighting_;
+        silence_weighting_ = NULL;
+    }
+}
+
+void Decoder::_decode_chunked(const kaldi::VectorBase<kaldi::BaseFloat> &data,
+                              const kaldi::BaseFloat &samp_freq,
+                              const float &chunk_size) {
     int32 chunk_length;
     if (chunk_size > 0) {
         chunk_length = int32(samp_freq * chunk_size);
@@ -158,43 +336,159 @@ void Decoder::decode_raw_wav_audio(std::istream &wav_stream,
     }
 }
 
-void Decoder::get_decoded_results(const int &n_best,
-                                  utterance_results_t &results,
-                                  const bool &word_level,
-                                  const bool &bidi_streaming) {
-    if (!bidi_streaming) {
-        feature_pipeline_->InputFinished();
-        decoder_->AdvanceDecoding();
-        decoder_->FinalizeDecoding();
+void Decoder::_decode_segmented(const kaldi::VectorBase<kaldi::BaseFloat> &data,
+                                const kaldi::BaseFloat &samp_freq,
+                                const std::vector<Decoder *> &helpers,
+                                const int &n_best,
+                                utterance_results_t &results,
+                                const bool &word_level,
+                                const float &chunk_size,
+                                const task_executor_t &executor) {
+    std::vector<std::pair<int32, int32>> segments;
+    split_at_silences(data, samp_freq, model_->model_spec.max_segment_length, segments);
+
+    // the helpers work for the same utterance (untraced)
+    for (Decoder *const helper : helpers) helper->start_decoding(uuid_, is_cancelled_);
+
+    std::vector<utterance_results_t> segment_results(segments.size());
+    std::atomic<std::size_t> next(0);
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    // each decoder takes the next segment left until none are
+    auto work = [&](Decoder *const decoder) {
+        try {
+            std::size_t s;
+            while ((s = next++) < segments.size()) {
+                const int32 start = segments[s].first, end = segments[s].second;
+
+                // segments are decoded independently, the speaker adaptation included
+                decoder->_free_segment();
+                delete decoder->adaptation_state_;
+                decoder->adaptation_state_ = new kaldi::OnlineIvectorExtractorAdaptationState(
+                    model_->feature_info->ivector_extractor_info);
+                decoder->_init_segment();
+                decoder->segment_start_secs_ = start / samp_freq;
+                decoder->lattice_bytes_ = 0;
+
+                {
+                    ScopedCpuTimer cpu_timer(&decoder->stats_.cpu_secs);
+                    kaldi::SubVector<kaldi::BaseFloat> segment(data, start, end - start);
+                    decoder->_decode_chunked(segment, samp_freq, chunk_size);
+                }
+                decoder->get_decoded_results(n_best, segment_results[s], word_level);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) error = std::current_exception();
+            // stop the others early
+            next = segments.size();
+        }
+    };
+
+    // Helpers never get waited for before they start: once we run out of
+    // segments the job closes, tasks starting later (e.g. queued behind busy
+    // workers of the executor's pool) leave right away and the segments get
+    // decoded by whoever did start, us included. So a pool running us can't
+    // deadlock on the helpers' tasks.
+    struct HelperJob {
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool closed = false;
+        int n_running = 0;
+    };
+    auto job = std::make_shared<HelperJob>();
+    auto run_helper = [job, &work](Decoder *const helper) {
+        {
+            std::lock_guard<std::mutex> lock(job->mutex);
+            if (job->closed) return;
+            job->n_running++;
+        }
+        {
+            // on the helper's NUMA node like the caller's thread is on ours
+            ScopedThreadAffinity affinity(helper->cpus_);
+            work(helper);
+        }
+        std::lock_guard<std::mutex> lock(job->mutex);
+        if (--job->n_running == 0) job->finished.notify_all();
+    };
+
+    std::vector<std::thread> threads;
+    for (Decoder *const helper : helpers) {
+        if (executor) {
+            executor([run_helper, helper]() { run_helper(helper); });
+        } else {
+            threads.emplace_back(run_helper, helper);
+        }
     }
-
-    if (decoder_->NumFramesDecoded() == 0) {
-        KALDI_WARN << "audio may be empty :: decoded no frames";
-        return;
+    work(this);
+    {
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->closed = true;
+        job->finished.wait(lock, [&job]() { return job->n_running == 0; });
     }
+    for (auto &thread : threads) thread.join();
 
-    kaldi::CompactLattice clat;
-    try {
-        decoder_->GetLattice(true, &clat);
-        find_alternatives(clat, n_best, results, word_level, model_, options);
-    } catch (std::exception &e) {
-        KALDI_ERR << "unexpected error during decoding lattice :: " << e.what(); 
-    }
+    for (Decoder *const helper : helpers) stats_ += helper->stats_;
+    if (error) std::rethrow_exception(error);
+
+    std::vector<double> segment_secs;
+    for (auto const &segment : segments) segment_secs.push_back((segment.second - segment.first) / samp_freq);
+    stitch_segment_results(segment_results, segment_secs, results);
 }
 
 void Decoder::_decode_wave(kaldi::SubVector<kaldi::BaseFloat> &wave_part,
                            std::vector<std::pair<int32, kaldi::BaseFloat>> &delta_weights,
                            const kaldi::BaseFloat &samp_freq) {
-    feature_pipeline_->AcceptWaveform(samp_freq, wave_part);
+    // checked before every chunk of audio
+    _check_cancelled();
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    stats_.audio_secs += wave_part.Dim() / samp_freq;
+    {
+        ScopedSpan span(_trace(), "feature_extraction");
+        feature_pipeline_->AcceptWaveform(samp_freq, wave_part);
+
+        if (silence_weighting_->Active() && feature_pipeline_->IvectorFeature() != NULL) {
+            silence_weighting_->ComputeCurrentTraceback(_search_decoder());
+            silence_weighting_->GetDeltaWeights(feature_pipeline_->NumFramesReady(),
+                                                &delta_weights);
+            feature_pipeline_->IvectorFeature()->UpdateFrameWeights(delta_weights);
+        }
+    }
 
-    if (silence_weighting_->Active() && feature_pipeline_->IvectorFeature() != NULL) {
-        silence_weighting_->ComputeCurrentTraceback(decoder_->Decoder());
-        silence_weighting_->GetDeltaWeights(feature_pipeline_->NumFramesReady(),
-                                            &delta_weights);
-        feature_pipeline_->IvectorFeature()->UpdateFrameWeights(delta_weights);
+    // NOTE: the looped nnet3 decodable evaluates the acoustic model on demand
+    //       from within the search, so its time is part of this span (batched
+    //       inference records its own `nnet3_evaluation` spans)
+    {
+        ScopedSpan span(_trace(), "advance_decoding");
+        _advance_decoding();
     }
+    stats_.decode_secs += elapsed_secs(start_time);
+}
+
+void Decoder::_advance_decoding() {
+    if (batched_decoder_) batched_decoder_->AdvanceDecoding();
+    else decoder_->AdvanceDecoding();
+}
+
+void Decoder::_finalize_decoding() {
+    if (batched_decoder_) batched_decoder_->FinalizeDecoding();
+    else decoder_->FinalizeDecoding();
+}
+
+int32 Decoder::_num_frames_decoded() const {
+    return batched_decoder_ ? batched_decoder_->NumFramesDecoded() : decoder_->NumFramesDecoded();
+}
+
+void Decoder::_get_lattice(kaldi::CompactLattice &clat) const {
+    if (batched_decoder_) batched_decoder_->GetLattice(true, &clat);
+    else decoder_->GetLattice(true, &clat);
+}
 
-    decoder_->AdvanceDecoding();
+const kaldi::LatticeFasterOnlineDecoder &Decoder::_search_decoder() const {
+    return batched_decoder_ ? batched_decoder_->Decoder() : decoder_->Decoder();
 }
 
 } // namespace kaldiserve
\ No newline at end of file
@@ -3,6 +3,7 @@
 // stl includes
 #include <iostream>
 #include <string>
+#include <vector>
 
 // local includes
 #include "model.hpp"
@@ -12,6 +13,40 @@
 
 namespace kaldiserve {
 
+// bytes of an fst's states and arcs (as laid out by the const and vector fst types)
+static std::size_t fst_bytes(const fst::Fst<fst::StdArc> &fst) {
+    std::size_t n_states = 0, n_arcs = 0;
+    for (fst::StateIterator<fst::Fst<fst::StdArc>> siter(fst); !siter.Done(); siter.Next()) {
+        n_states++;
+        n_arcs += fst.NumArcs(siter.Value());
+    }
+    const std::size_t state_bytes = fst.Type() == "const" ? 5 * sizeof(int32)
+                                                          : sizeof(fst::VectorState<fst::StdArc>) + sizeof(void *);
+    return n_states * state_bytes + n_arcs * sizeof(fst::StdArc);
+}
+
+// bytes of a symbol table's strings and their entries in its id and symbol indices
+static std::size_t symbol_table_bytes(const fst::SymbolTable &syms) {
+    std::size_t n_bytes = 0;
+    for (fst::SymbolTableIterator siter(syms); !siter.Done(); siter.Next()) {
+        n_bytes += sizeof(std::string) + siter.Symbol().size() + 1 + 2 * sizeof(int64);
+    }
+    return n_bytes;
+}
+
+// bytes of the i-vector extractor's projections (and their precomputed
+// products with the inverse covariances) along with the diagonal UBM
+static std::size_t ivector_extractor_bytes(const kaldi::OnlineIvectorExtractionInfo &info) {
+    const std::size_t n_gauss = info.extractor.NumGauss();
+    const std::size_t feat_dim = info.extractor.FeatDim();
+    const std::size_t ivector_dim = info.extractor.IvectorDim();
+
+    std::size_t n_bytes = 2 * n_gauss * feat_dim * ivector_dim * sizeof(double);
+    n_bytes += n_gauss * ivector_dim * (ivector_dim + 1) / 2 * sizeof(double);
+    n_bytes += 2 * std::size_t(info.diag_ubm.NumGauss()) * info.diag_ubm.Dim() * sizeof(kaldi::BaseFloat);
+    return n_bytes;
+}
+
 ChainModel::ChainModel(const ModelSpec &model_spec) : model_spec(model_spec) {
     std::string model_dir = model_spec.path;
 
@@ -69,7 +104,7 @@ ChainModel::ChainModel(const ModelSpec &model_spec) : model_spec(model_spec) {
             KALDI_ASSERT(IsSimpleNnet(rnnlm));
             kaldi::ReadKaldiObject(join_path(rnnlm_dir, "word_embedding.mat"), &word_embedding_mat);
             
-            std::cout << "# Word Embeddings (RNNLM): " << word_embedding_mat.NumRows() << ENDL;
+            log_info("# Word Embeddings (RNNLM): %d", int(word_embedding_mat.NumRows()));
 
             rnnlm_info =
                 make_uniq<const kaldi::rnnlm::RnnlmComputeStateInfo>(rnnlm_opts, rnnlm, word_embedding_mat);
@@ -96,6 +131,27 @@ ChainModel::ChainModel(const ModelSpec &model_spec) : model_spec(model_spec) {
 
         feature_info->ivector_extractor_info.Init(ivector_extraction_opts);
         feature_info->silence_weighting_config.silence_weight = model_spec.silence_weight;
+        feature_info->silence_weighting_config.silence_phones_str = model_spec.silence_phones;
+
+        // kaldi only parses the silence phones (and asserts on an empty list)
+        // deep into decoding, so bad ones are caught here
+        if (!model_spec.silence_phones.empty()) {
+            std::vector<int32> silence_phones;
+            if (!kaldi::SplitStringToIntegers(model_spec.silence_phones, ":", false, &silence_phones)) {
+                KALDI_ERR << "Invalid silence_phones \"" << model_spec.silence_phones << "\" (expected colon separated phone ids)";
+            }
+            for (const int32 &phone : silence_phones) {
+                if (phone <= 0 || phone > trans_model.NumPhones()) {
+                    KALDI_ERR << "Silence phone " << phone << " is not a phone of the model";
+                }
+            }
+        }
+        if (model_spec.max_segment_length <= 0) {
+            KALDI_ERR << "max_segment_length must be positive, got " << model_spec.max_segment_length;
+        }
+
+        endpoint_config.silence_phones = model_spec.silence_phones;
+        endpoint_config.rule5.max_utterance_length = model_spec.max_segment_length;
 
         lattice_faster_decoder_config.min_active = model_spec.min_active;
         lattice_faster_decoder_config.max_active = model_spec.max_active;
@@ -105,6 +161,23 @@ ChainModel::ChainModel(const ModelSpec &model_spec) : model_spec(model_spec) {
         decodable_opts.acoustic_scale = model_spec.acoustic_scale;
         decodable_opts.frame_subsampling_factor = model_spec.frame_subsampling_factor;
         decodable_info = make_uniq<kaldi::nnet3::DecodableNnetSimpleLoopedInfo>(decodable_opts, &am_nnet);
+
+        if (model_spec.batch_inference) {
+            batch_scheduler = make_uniq<NnetBatchScheduler>(model_spec, am_nnet.GetNnet());
+        }
+
+        memory.hclg_bytes = fst_bytes(*decode_fst);
+        memory.am_nnet_bytes = std::size_t(kaldi::nnet3::NumParameters(am_nnet.GetNnet())) * sizeof(kaldi::BaseFloat);
+        memory.ivector_extractor_bytes = ivector_extractor_bytes(feature_info->ivector_extractor_info);
+        if (word_syms) memory.word_syms_bytes = symbol_table_bytes(*word_syms);
+        if (rnnlm_info) {
+            memory.rnnlm_bytes = std::size_t(kaldi::nnet3::NumParameters(rnnlm)) * sizeof(kaldi::BaseFloat);
+            memory.word_embedding_bytes = std::size_t(word_embedding_mat.NumRows()) * word_embedding_mat.Stride() * sizeof(kaldi::BaseFloat);
+            memory.lm_fst_bytes = fst_bytes(*lm_to_subtract_fst);
+        }
+        log_info("Model memory: %.1f MB (HCLG %.1f MB, AM %.1f MB, RNNLM %.1f MB)",
+                 memory.total_bytes() / 1048576.0, memory.hclg_bytes / 1048576.0, memory.am_nnet_bytes / 1048576.0,
+                 (memory.rnnlm_bytes + memory.word_embedding_bytes + memory.lm_fst_bytes) / 1048576.0);
     
     } catch (const std::exception &e) {
         KALDI_ERR << e.what();
@@ -44,6 +44,16 @@ void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &mod
         auto maybe_name = model->get_as<std::string>("name");
         auto maybe_language_code = model->get_as<std::string>("language_code");
         auto maybe_n_decoders = model->get_as<int>("n_decoders");
+        auto maybe_min_decoders = model->get_as<int>("min_decoders");
+        auto maybe_max_decoders = model->get_as<int>("max_decoders");
+        auto maybe_decoder_idle_timeout = model->get_as<double>("decoder_idle_timeout");
+        auto maybe_reserved_decoders = model->get_as<int>("reserved_decoders");
+        auto maybe_priority_aging = model->get_as<double>("priority_aging");
+        auto maybe_numa_aware = model->get_as<bool>("numa_aware");
+        auto maybe_admission_max_waiting = model->get_as<int>("admission_max_waiting");
+        auto maybe_admission_max_wait = model->get_as<double>("admission_max_wait");
+        auto maybe_admission_max_rtf = model->get_as<double>("admission_max_rtf");
+        auto maybe_admission_max_cpu = model->get_as<double>("admission_max_cpu");
 
         auto maybe_min_active = model->get_as<int>("min_active");
         auto maybe_max_active = model->get_as<int>("max_active");
@@ -52,10 +62,16 @@ void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &mod
         auto maybe_lattice_beam = model->get_as<double>("lattice_beam");
         auto maybe_acoustic_scale = model->get_as<double>("acoustic_scale");
         auto maybe_silence_weight = model->get_as<double>("silence_weight");
+        auto maybe_silence_phones = model->get_as<std::string>("silence_phones");
+        auto maybe_max_segment_length = model->get_as<double>("max_segment_length");
         auto maybe_max_ngram_order = model->get_as<int>("max_ngram_order");
         auto maybe_rnnlm_weight = model->get_as<double>("rnnlm_weight");
         auto maybe_bos_index = model->get_as<std::string>("bos_index");
         auto maybe_eos_index = model->get_as<std::string>("eos_index");
+        auto maybe_batch_inference = model->get_as<bool>("batch_inference");
+        auto maybe_batch_size = model->get_as<int>("batch_size");
+        auto maybe_batch_frames_per_chunk = model->get_as<int>("batch_frames_per_chunk");
+        auto maybe_batch_max_delay_ms = model->get_as<int>("batch_max_delay_ms");
 
         // TODO: Throw error in case of invalid toml
         spec.path = *maybe_path;
@@ -63,6 +79,16 @@ void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &mod
         spec.language_code = *maybe_language_code;
 
         if (maybe_n_decoders) spec.n_decoders = *maybe_n_decoders;
+        if (maybe_min_decoders) spec.min_decoders = *maybe_min_decoders;
+        if (maybe_max_decoders) spec.max_decoders = *maybe_max_decoders;
+        if (maybe_decoder_idle_timeout) spec.decoder_idle_timeout = *maybe_decoder_idle_timeout;
+        if (maybe_reserved_decoders) spec.reserved_decoders = *maybe_reserved_decoders;
+        if (maybe_priority_aging) spec.priority_aging = *maybe_priority_aging;
+        if (maybe_numa_aware) spec.numa_aware = *maybe_numa_aware;
+        if (maybe_admission_max_waiting) spec.admission_max_waiting = *maybe_admission_max_waiting;
+        if (maybe_admission_max_wait) spec.admission_max_wait = *maybe_admission_max_wait;
+        if (maybe_admission_max_rtf) spec.admission_max_rtf = *maybe_admission_max_rtf;
+        if (maybe_admission_max_cpu) spec.admission_max_cpu = *maybe_admission_max_cpu;
         if (maybe_beam) spec.beam = *maybe_beam;
         if (maybe_min_active) spec.min_active = *maybe_min_active;
         if (maybe_max_active) spec.max_active = *maybe_max_active;
@@ -70,15 +96,43 @@ void parse_model_specs(const std::string &toml_path, std::vector<ModelSpec> &mod
         if (maybe_acoustic_scale) spec.acoustic_scale = *maybe_acoustic_scale;
         if (maybe_frame_subsampling_factor) spec.frame_subsampling_factor = *maybe_frame_subsampling_factor;
         if (maybe_silence_weight) spec.silence_weight = *maybe_silence_weight;
+        if (maybe_silence_phones) spec.silence_phones = *maybe_silence_phones;
+        if (maybe_max_segment_length) spec.max_segment_length = *maybe_max_segment_length;
         if (maybe_max_ngram_order) spec.max_ngram_order = *maybe_max_ngram_order;
         if (maybe_rnnlm_weight) spec.rnnlm_weight = *maybe_rnnlm_weight;
         if (maybe_bos_index) spec.bos_index = *maybe_bos_index;
         if (maybe_eos_index) spec.eos_index = *maybe_eos_index;
+        if (maybe_batch_inference) spec.batch_inference = *maybe_batch_inference;
+        if (maybe_batch_size) spec.batch_size = *maybe_batch_size;
+        if (maybe_batch_frames_per_chunk) spec.batch_frames_per_chunk = *maybe_batch_frames_per_chunk;
+        if (maybe_batch_max_delay_ms) spec.batch_max_delay_ms = *maybe_batch_max_delay_ms;
 
         model_specs.push_back(spec);
     }
 }
 
+void parse_tenant_specs(const std::string &toml_path, std::vector<TenantSpec> &tenant_specs) {
+    auto config = cpptoml::parse_file(toml_path);
+    auto tenants = config->get_table_array("tenant");
+
+    // tenants are optional
+    if (!tenants) return;
+
+    for (const auto &tenant : *tenants) {
+        auto maybe_name = tenant->get_as<std::string>("name");
+        auto maybe_weight = tenant->get_as<double>("weight");
+        auto maybe_max_concurrency = tenant->get_as<int>("max_concurrency");
+
+        TenantSpec spec;
+        spec.name = *maybe_name;
+
+        if (maybe_weight) spec.weight = *maybe_weight;
+        if (maybe_max_concurrency) spec.max_concurrency = *maybe_max_concurrency;
+
+        tenant_specs.push_back(spec);
+    }
+}
+
 void string_join(const std::vector<std::string> &strings, std::string separator, std::string &output) {
     output.clear();
 
@@ -0,0 +1,210 @@
+// utils-log.cpp - Asynchronous Logging Implementation
+
+// stl includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <thread>
+
+// local includes
+#include "utils.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+// no. of slots in the ring buffer (power of 2)
+static const std::size_t LOG_RING_SIZE = 4096;
+// max length of a message (longer ones get truncated)
+static const std::size_t LOG_MESSAGE_SIZE = 256;
+// bounds of how long the flushing thread sleeps when there's nothing to write,
+// backing off exponentially while idle and starting over once messages come in
+static const std::chrono::milliseconds LOG_FLUSH_INTERVAL_MIN(1);
+static const std::chrono::milliseconds LOG_FLUSH_INTERVAL_MAX(50);
+
+static const char *const LOG_LEVEL_NAMES[] = {"DEBUG", "INFO", "WARN", "ERROR"};
+
+
+// Bounded multi-producer single-consumer ring buffer of log messages
+// (Vyukov's queue), drained by a thread that formats and writes them out.
+// Producers only pay for a clock read, a CAS and the message's vsnprintf.
+class Logger final {
+
+  public:
+    Logger() : base_wall_(std::chrono::system_clock::now()), base_steady_(std::chrono::steady_clock::now()) {
+        for (std::size_t i = 0; i < LOG_RING_SIZE; i++) slots_[i].sequence.store(i, std::memory_order_relaxed);
+        thread_ = std::thread(&Logger::run_, this);
+    }
+
+    Logger(const Logger &) = delete; // disable copying
+
+    Logger &operator=(const Logger &) = delete; // disable assignment
+
+    ~Logger() {
+        stopped_ = true;
+        thread_.join();
+    }
+
+    inline bool enabled(const LogLevel &level) const noexcept {
+        return int(level) >= level_.load(std::memory_order_relaxed);
+    }
+
+    inline void set_level(const LogLevel &level) noexcept {
+        level_.store(int(level), std::memory_order_relaxed);
+    }
+
+    void log(const LogLevel &level, const char *const format, va_list args) noexcept {
+        const auto time = std::chrono::steady_clock::now();
+
+        // claim a slot
+        Slot *slot;
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        while (true) {
+            slot = &slots_[pos & (LOG_RING_SIZE - 1)];
+            const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = intptr_t(sequence) - intptr_t(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                // full, the flushing thread is behind
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->level = level;
+        slot->time = time;
+        std::vsnprintf(slot->message, LOG_MESSAGE_SIZE, format, args);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+  private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        LogLevel level;
+        std::chrono::steady_clock::time_point time;
+        char message[LOG_MESSAGE_SIZE];
+    };
+
+    Slot slots_[LOG_RING_SIZE];
+    std::atomic<std::size_t> enqueue_pos_{0};
+    std::size_t dequeue_pos_ = 0;
+
+    std::atomic<int> level_{int(LogLevel::INFO)};
+    std::atomic<std::size_t> dropped_{0};
+    std::size_t dropped_reported_ = 0;
+
+    // wall clock time is derived from the (cheaper, monotonic) steady clock
+    const std::chrono::system_clock::time_point base_wall_;
+    const std::chrono::steady_clock::time_point base_steady_;
+    // formatted wall clock second of the last message written
+    std::time_t last_second_ = 0;
+    char second_str_[32] = {0};
+
+    std::atomic<bool> stopped_{false};
+    std::thread thread_;
+
+    void run_() {
+        std::string buffer;
+        std::chrono::milliseconds interval = LOG_FLUSH_INTERVAL_MIN;
+        while (true) {
+            // read before draining so that nothing logged before stopping is lost
+            const bool stopped = stopped_.load();
+
+            while (true) {
+                Slot &slot = slots_[dequeue_pos_ & (LOG_RING_SIZE - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != dequeue_pos_ + 1) break;
+
+                append_line_(buffer, slot.level, slot.time, slot.message);
+                slot.sequence.store(dequeue_pos_ + LOG_RING_SIZE, std::memory_order_release);
+                dequeue_pos_++;
+            }
+
+            const std::size_t dropped = dropped_.load(std::memory_order_relaxed);
+            if (dropped != dropped_reported_) {
+                const std::string message = "logger :: dropped " + std::to_string(dropped - dropped_reported_) + " messages";
+                append_line_(buffer, LogLevel::WARN, std::chrono::steady_clock::now(), message.c_str());
+                dropped_reported_ = dropped;
+            }
+
+            if (!buffer.empty()) {
+                std::fwrite(buffer.data(), 1, buffer.size(), stdout);
+                std::fflush(stdout);
+                buffer.clear();
+                interval = LOG_FLUSH_INTERVAL_MIN;
+            } else if (stopped) {
+                break;
+            } else {
+                std::this_thread::sleep_for(interval);
+                interval = std::min(2 * interval, LOG_FLUSH_INTERVAL_MAX);
+            }
+        }
+    }
+
+    // appends "[timestamp] LEVEL message\n"
+    void append_line_(std::string &buffer, const LogLevel &level,
+                      const std::chrono::steady_clock::time_point &time, const char *const message) {
+        const auto wall_time = base_wall_ + std::chrono::duration_cast<std::chrono::system_clock::duration>(time - base_steady_);
+        const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(wall_time.time_since_epoch()).count();
+
+        const std::time_t second = std::time_t(millis / 1000);
+        if (second != last_second_) {
+            std::tm tm;
+            localtime_r(&second, &tm);
+            std::strftime(second_str_, sizeof(second_str_), "%a %b %e %H:%M:%S", &tm);
+            last_second_ = second;
+        }
+
+        char prefix[64];
+        std::snprintf(prefix, sizeof(prefix), "[%s.%03d] %-5s ", second_str_, int(millis % 1000), LOG_LEVEL_NAMES[int(level)]);
+        buffer += prefix;
+        buffer += message;
+        buffer += '\n';
+    }
+};
+
+static Logger &logger() {
+    static Logger instance;
+    return instance;
+}
+
+
+void set_log_level(const LogLevel &level) noexcept {
+    logger().set_level(level);
+}
+
+#define KALDISERVE_LOG_VARARGS(level)   \
+    Logger &l = logger();               \
+    if (!l.enabled(level)) return;      \
+    va_list args;                       \
+    va_start(args, format);             \
+    l.log(level, format, args);         \
+    va_end(args);
+
+void log_debug(const char *const format, ...) noexcept {
+    KALDISERVE_LOG_VARARGS(LogLevel::DEBUG)
+}
+
+void log_info(const char *const format, ...) noexcept {
+    KALDISERVE_LOG_VARARGS(LogLevel::INFO)
+}
+
+void log_warn(const char *const format, ...) noexcept {
+    KALDISERVE_LOG_VARARGS(LogLevel::WARN)
+}
+
+void log_error(const char *const format, ...) noexcept {
+    KALDISERVE_LOG_VARARGS(LogLevel::ERROR)
+}
+
+#undef KALDISERVE_LOG_VARARGS
+
+} // namespace kaldiserve
@@ -0,0 +1,64 @@
+// utils-numa.cpp - NUMA Topology & Thread Affinity Utilities Implementation
+
+// stl includes
+#include <fstream>
+#include <sstream>
+#include <pthread.h>
+
+// local includes
+#include "utils.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+// parses a sysfs cpulist like "0-15,32-47"
+static void parse_cpulist(const std::string &cpulist, std::vector<int> &cpus) {
+    std::stringstream ss(cpulist);
+    std::string range;
+
+    while (std::getline(ss, range, ',')) {
+        if (range.empty()) continue;
+        auto dash = range.find('-');
+        int first = std::stoi(range.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+        for (int cpu = first; cpu <= last; cpu++) cpus.push_back(cpu);
+    }
+}
+
+void numa_node_cpus(std::vector<std::vector<int>> &node_cpus) {
+    node_cpus.clear();
+
+    // nodes are numbered contiguously from 0
+    for (int node = 0; ; node++) {
+        std::ifstream cpulist_file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!cpulist_file.is_open()) break;
+
+        std::string cpulist;
+        std::getline(cpulist_file, cpulist);
+
+        std::vector<int> cpus;
+        parse_cpulist(cpulist, cpus);
+        // memory-only nodes have no cpus to run on
+        if (!cpus.empty()) node_cpus.push_back(cpus);
+    }
+}
+
+ScopedThreadAffinity::ScopedThreadAffinity(const std::vector<int> &cpus) noexcept {
+    if (cpus.empty()) return;
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &previous_) != 0) return;
+
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) CPU_SET(cpu, &cpu_set);
+    }
+
+    pinned_ = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set) == 0;
+}
+
+ScopedThreadAffinity::~ScopedThreadAffinity() noexcept {
+    if (pinned_) pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &previous_);
+}
+
+} // namespace kaldiserve
@@ -0,0 +1,25 @@
+// utils-trace.cpp - Tracing Utilities Implementation
+
+// local includes
+#include "utils.hpp"
+#include "types.hpp"
+
+
+namespace kaldiserve {
+
+ScopedSpan::ScopedSpan(std::vector<Span> *const spans, const char *const name) noexcept
+    : spans_(spans), name_(name) {
+    if (spans_ != nullptr) start_time_ = std::chrono::system_clock::now();
+}
+
+ScopedSpan::~ScopedSpan() noexcept {
+    if (spans_ == nullptr) return;
+
+    Span span;
+    span.name = name_;
+    span.start_time = start_time_;
+    span.end_time = std::chrono::system_clock::now();
+    spans_->push_back(std::move(span));
+}
+
+} // namespace kaldiserve